@@ -0,0 +1,250 @@
+#include "Benchmark.h"
+#include "System/Serialization/JsonSerialization.h"
+#include "System/Math/Math.h"
+#include <EASTL/sort.h>
+#include <stdio.h>
+#include <math.h>
+
+//-------------------------------------------------------------------------
+
+namespace KRG::Benchmark
+{
+    Registration* Registration::s_pFirst = nullptr;
+
+    Registration::Registration( char const* pCategory, char const* pName, BenchmarkFunction pFunction )
+        : m_pCategory( pCategory )
+        , m_pName( pName )
+        , m_pFunction( pFunction )
+    {
+        KRG_ASSERT( pCategory != nullptr && pName != nullptr && pFunction != nullptr );
+        m_pNext = s_pFirst;
+        s_pFirst = this;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void State::StartTimer()
+    {
+        KRG_ASSERT( !m_isTimerRunning && !m_wasTimed );
+        m_isTimerRunning = true;
+        ClobberMemory();
+        m_startTime = PlatformClock::GetTime().ToU64();
+    }
+
+    void State::StopTimer()
+    {
+        uint64_t const endTime = PlatformClock::GetTime().ToU64();
+        ClobberMemory();
+
+        KRG_ASSERT( m_isTimerRunning );
+        m_elapsedTime = endTime - m_startTime;
+        m_isTimerRunning = false;
+        m_wasTimed = true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void Runner::RunAll()
+    {
+        m_results.clear();
+
+        // Gather and sort all benchmarks so that the output order doesnt depend on static initialization order
+        TVector<Registration const*> benchmarks;
+        for ( auto pBenchmark = Registration::GetFirst(); pBenchmark != nullptr; pBenchmark = pBenchmark->m_pNext )
+        {
+            if ( !m_settings.m_filter.empty() )
+            {
+                InlineString const fullName( InlineString::CtorSprintf(), "%s.%s", pBenchmark->m_pCategory, pBenchmark->m_pName );
+                if ( fullName.find( m_settings.m_filter.c_str() ) == InlineString::npos )
+                {
+                    continue;
+                }
+            }
+
+            benchmarks.emplace_back( pBenchmark );
+        }
+
+        auto SortPredicate = [] ( Registration const* pA, Registration const* pB )
+        {
+            int32_t const categoryComparison = strcmp( pA->m_pCategory, pB->m_pCategory );
+            if ( categoryComparison != 0 )
+            {
+                return categoryComparison < 0;
+            }
+
+            return strcmp( pA->m_pName, pB->m_pName ) < 0;
+        };
+
+        eastl::sort( benchmarks.begin(), benchmarks.end(), SortPredicate );
+
+        //-------------------------------------------------------------------------
+
+        for ( auto pBenchmark : benchmarks )
+        {
+            printf( "Running %s.%s...\n", pBenchmark->m_pCategory, pBenchmark->m_pName );
+            m_results.emplace_back( Run( *pBenchmark ) );
+        }
+    }
+
+    uint64_t Runner::RunSample( Registration const& benchmark, uint32_t numIterations, uint64_t& outBytesPerIteration ) const
+    {
+        State state;
+        state.m_numIterations = numIterations;
+        benchmark.m_pFunction( state );
+
+        KRG_ASSERT( state.m_wasTimed ); // Every benchmark needs to call StartTimer/StopTimer
+        outBytesPerIteration = state.m_bytesPerIteration;
+        return Math::Max( state.m_elapsedTime, uint64_t( 1 ) );
+    }
+
+    Result Runner::Run( Registration const& benchmark ) const
+    {
+        uint64_t const minSampleTime = uint64_t( m_settings.m_minSampleTimeMs * 1000000.0f );
+        uint64_t bytesPerIteration = 0;
+
+        // Calibrate the number of iterations per sample, this also acts as the warm-up
+        //-------------------------------------------------------------------------
+
+        uint32_t numIterations = 1;
+        while ( true )
+        {
+            uint64_t const elapsedTime = RunSample( benchmark, numIterations, bytesPerIteration );
+            if ( elapsedTime >= minSampleTime || numIterations >= ( 1u << 30 ) )
+            {
+                break;
+            }
+
+            // Grow by the estimated factor needed (with some slack), but never by more than 10x at once since the first iterations are usually unrepresentative
+            double const estimatedScale = ( double( minSampleTime ) / double( elapsedTime ) ) * 1.2;
+            double const scale = Math::Clamp( estimatedScale, 2.0, 10.0 );
+            numIterations = (uint32_t) Math::Min( double( numIterations ) * scale, double( 1u << 30 ) );
+        }
+
+        // Sample
+        //-------------------------------------------------------------------------
+
+        uint32_t const numSamples = Math::Max( m_settings.m_numSamples, 1u );
+
+        TVector<double> sampleTimes;
+        sampleTimes.reserve( numSamples );
+        for ( uint32_t i = 0; i < numSamples; i++ )
+        {
+            uint64_t const elapsedTime = RunSample( benchmark, numIterations, bytesPerIteration );
+            sampleTimes.emplace_back( double( elapsedTime ) / numIterations );
+        }
+
+        eastl::sort( sampleTimes.begin(), sampleTimes.end() );
+
+        // Summarize
+        //-------------------------------------------------------------------------
+
+        Result result;
+        result.m_category = benchmark.m_pCategory;
+        result.m_name = benchmark.m_pName;
+        result.m_numIterations = numIterations;
+        result.m_numSamples = numSamples;
+        result.m_min = sampleTimes.front();
+        result.m_median = ( numSamples % 2 == 1 ) ? sampleTimes[numSamples / 2] : ( sampleTimes[numSamples / 2 - 1] + sampleTimes[numSamples / 2] ) / 2;
+
+        double sum = 0.0;
+        for ( auto sampleTime : sampleTimes )
+        {
+            sum += sampleTime;
+        }
+        result.m_mean = sum / numSamples;
+
+        if ( numSamples > 1 )
+        {
+            double sumOfSquaredDeviations = 0.0;
+            for ( auto sampleTime : sampleTimes )
+            {
+                sumOfSquaredDeviations += ( sampleTime - result.m_mean ) * ( sampleTime - result.m_mean );
+            }
+            result.m_stdDev = sqrt( sumOfSquaredDeviations / ( numSamples - 1 ) );
+        }
+
+        if ( bytesPerIteration > 0 )
+        {
+            result.m_bytesPerSecond = double( bytesPerIteration ) / ( result.m_median / 1000000000.0 );
+        }
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void Runner::PrintResults() const
+    {
+        printf( "\n%-48s %12s %14s %14s %14s %14s %14s\n", "Benchmark", "Iterations", "Min (ns)", "Median (ns)", "Mean (ns)", "StdDev (ns)", "MB/s" );
+        printf( "------------------------------------------------------------------------------------------------------------------------------------------\n" );
+
+        for ( auto const& result : m_results )
+        {
+            InlineString const fullName( InlineString::CtorSprintf(), "%s.%s", result.m_category.c_str(), result.m_name.c_str() );
+            printf( "%-48s %12u %14.2f %14.2f %14.2f %14.2f", fullName.c_str(), result.m_numIterations, result.m_min, result.m_median, result.m_mean, result.m_stdDev );
+
+            if ( result.m_bytesPerSecond > 0 )
+            {
+                printf( " %14.1f\n", result.m_bytesPerSecond / ( 1024.0 * 1024.0 ) );
+            }
+            else
+            {
+                printf( " %14s\n", "-" );
+            }
+        }
+    }
+
+    bool Runner::WriteResultsToJson( char const* pFilePath ) const
+    {
+        KRG_ASSERT( pFilePath != nullptr );
+
+        Serialization::JsonStringBuffer stringBuffer;
+        Serialization::JsonWriter writer( stringBuffer );
+
+        writer.StartObject();
+        writer.Key( "NumSamples" );
+        writer.Uint( m_settings.m_numSamples );
+        writer.Key( "MinSampleTimeMs" );
+        writer.Double( m_settings.m_minSampleTimeMs );
+
+        writer.Key( "Benchmarks" );
+        writer.StartArray();
+        for ( auto const& result : m_results )
+        {
+            writer.StartObject();
+            writer.Key( "Category" );
+            writer.String( result.m_category.c_str() );
+            writer.Key( "Name" );
+            writer.String( result.m_name.c_str() );
+            writer.Key( "Iterations" );
+            writer.Uint( result.m_numIterations );
+            writer.Key( "Samples" );
+            writer.Uint( result.m_numSamples );
+            writer.Key( "MinNs" );
+            writer.Double( result.m_min );
+            writer.Key( "MedianNs" );
+            writer.Double( result.m_median );
+            writer.Key( "MeanNs" );
+            writer.Double( result.m_mean );
+            writer.Key( "StdDevNs" );
+            writer.Double( result.m_stdDev );
+            writer.Key( "BytesPerSecond" );
+            writer.Double( result.m_bytesPerSecond );
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+
+        //-------------------------------------------------------------------------
+
+        FILE* fp = fopen( pFilePath, "wb" );
+        if ( fp == nullptr )
+        {
+            return false;
+        }
+
+        size_t const numBytesWritten = fwrite( stringBuffer.GetString(), 1, stringBuffer.GetSize(), fp );
+        fclose( fp );
+        return numBytesWritten == stringBuffer.GetSize();
+    }
+}
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "System/Types/Arrays.h"
+#include "System/Types/String.h"
+#include "System/Time/Time.h"
+
+#if _MSC_VER
+#include <intrin.h>
+#endif
+
+//-------------------------------------------------------------------------
+// Micro-benchmarks
+//-------------------------------------------------------------------------
+// Benchmarks are registered statically with KRG_BENCHMARK and are executed by the benchmark application
+// Each benchmark is first calibrated so that a single sample runs for at least the minimum sample time,
+// it is then timed over a fixed number of samples and reported as the time per iteration (min/median/mean/stddev)
+//
+// Only the code between StartTimer and StopTimer is measured, so any setup should happen before StartTimer
+// All benchmarks must be deterministic (fixed RNG seeds) so that results are comparable across versions
+//
+// Platform support: this application does NOT run on linux yet, it is built on windows from its visual studio project (KRG.Applications.Benchmark)
+// None of the benchmarks need a GPU (the render replay only runs on the null backend) and the benchmark code itself has no win32 dependencies,
+// but the System module only has win32 platform implementations (memory, threading, file system) and the tree has no build for any other platform
+// The entity serialization benchmarks also need the Engine, and are not System-only
+
+namespace KRG::Benchmark
+{
+    class State
+    {
+        friend class Runner;
+
+    public:
+
+        // The number of times the benchmarked operation needs to be executed
+        inline uint32_t GetNumIterations() const { return m_numIterations; }
+
+        void StartTimer();
+        void StopTimer();
+
+        // Optional: the number of bytes processed per iteration, used to report throughput
+        inline void SetBytesPerIteration( uint64_t numBytes ) { m_bytesPerIteration = numBytes; }
+
+    private:
+
+        uint64_t                    m_startTime = 0;            // Nanoseconds
+        uint64_t                    m_elapsedTime = 0;          // Nanoseconds
+        uint64_t                    m_bytesPerIteration = 0;
+        uint32_t                    m_numIterations = 1;
+        bool                        m_isTimerRunning = false;
+        bool                        m_wasTimed = false;
+    };
+
+    //-------------------------------------------------------------------------
+
+    using BenchmarkFunction = void( * )( State& state );
+
+    // Static registration record, this is an intrusive list so that no allocations are needed before the memory system is initialized
+    struct Registration
+    {
+        Registration( char const* pCategory, char const* pName, BenchmarkFunction pFunction );
+
+        static Registration const* GetFirst() { return s_pFirst; }
+
+    public:
+
+        char const*                 m_pCategory = nullptr;
+        char const*                 m_pName = nullptr;
+        BenchmarkFunction           m_pFunction = nullptr;
+        Registration const*         m_pNext = nullptr;
+
+    private:
+
+        static Registration*        s_pFirst;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct Result
+    {
+        String                      m_category;
+        String                      m_name;
+        uint32_t                    m_numIterations = 0;
+        uint32_t                    m_numSamples = 0;
+
+        // Time per iteration in nanoseconds
+        double                      m_min = 0.0;
+        double                      m_median = 0.0;
+        double                      m_mean = 0.0;
+        double                      m_stdDev = 0.0;
+
+        // Only set if the benchmark reported the number of bytes processed
+        double                      m_bytesPerSecond = 0.0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class Runner
+    {
+    public:
+
+        struct Settings
+        {
+            String                  m_filter;                   // Only run benchmarks whose "Category.Name" contains this string
+            uint32_t                m_numSamples = 15;
+            float                   m_minSampleTimeMs = 10.0f;
+        };
+
+    public:
+
+        Runner( Settings const& settings ) : m_settings( settings ) {}
+
+        void RunAll();
+
+        inline TVector<Result> const& GetResults() const { return m_results; }
+        void PrintResults() const;
+        bool WriteResultsToJson( char const* pFilePath ) const;
+
+    private:
+
+        Result Run( Registration const& benchmark ) const;
+        uint64_t RunSample( Registration const& benchmark, uint32_t numIterations, uint64_t& outBytesPerIteration ) const;
+
+    private:
+
+        Settings                    m_settings;
+        TVector<Result>             m_results;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Prevent the compiler from optimizing away the value (i.e. the work needed to produce it)
+    template<typename T>
+    KRG_FORCE_INLINE void DoNotOptimize( T const& value )
+    {
+        #if _MSC_VER
+        static_cast<void>( *reinterpret_cast<char const volatile*>( &value ) );
+        _ReadWriteBarrier();
+        #else
+        asm volatile( "" : : "r,m"( value ) : "memory" );
+        #endif
+    }
+
+    // Force all pending writes to memory
+    KRG_FORCE_INLINE void ClobberMemory()
+    {
+        #if _MSC_VER
+        _ReadWriteBarrier();
+        #else
+        asm volatile( "" : : : "memory" );
+        #endif
+    }
+}
+
+//-------------------------------------------------------------------------
+
+#define KRG_BENCHMARK( Category, Name ) \
+    static void Benchmark_##Category##_##Name( KRG::Benchmark::State& state ); \
+    static KRG::Benchmark::Registration const g_benchmarkRegistration_##Category##_##Name( #Category, #Name, Benchmark_##Category##_##Name ); \
+    static void Benchmark_##Category##_##Name( KRG::Benchmark::State& state )
@@ -0,0 +1,197 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Math/FloatCurve.h"
+#include "System/Math/MathRandom.h"
+#include <EASTL/sort.h>
+
+//-------------------------------------------------------------------------
+// Float curve evaluation
+//-------------------------------------------------------------------------
+// Compares the original linear segment scan against the binary search, the batch evaluation and the baked table
+// Each iteration evaluates a fixed set of parameters, both in random order and sorted (i.e. sweeping through the curve)
+//
+// Tolerances (checked at setup against the linear scan reference):
+//  * Evaluate/batch Evaluate: 1e-5, the only difference is which segment gets picked for a parameter exactly on an interior point
+//  * BakedFloatCurve: the max error calculated when baking (+10% to absorb float rounding, the bake finds the exact max including at the source points)
+
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    static constexpr uint32_t const g_numParameters = 4096;
+    static constexpr uint32_t const g_seed = 12345;
+    static constexpr float const g_exactTolerance = 1e-5f;
+
+    // The original evaluation: scan all segments until we find the one containing the parameter
+    static float EvaluateLinearScan( FloatCurve const& curve, float parameter )
+    {
+        int32_t const numPoints = curve.GetNumPoints();
+        if ( numPoints == 0 )
+        {
+            return 0.0f;
+        }
+
+        FloatRange const parameterRange = curve.GetParameterRange();
+        if ( numPoints == 1 || !parameterRange.ContainsExclusive( parameter ) )
+        {
+            return ( parameter <= parameterRange.m_begin ) ? curve.GetPoint( 0 ).m_value : curve.GetPoint( numPoints - 1 ).m_value;
+        }
+
+        for ( int32_t i = 0; i < numPoints - 1; i++ )
+        {
+            auto const& start = curve.GetPoint( i );
+            auto const& end = curve.GetPoint( i + 1 );
+            if ( parameter >= start.m_parameter && parameter <= end.m_parameter )
+            {
+                float const T = ( parameter - start.m_parameter ) / ( end.m_parameter - start.m_parameter );
+                return Math::CubicHermite::Evaluate( start.m_value, start.m_outTangent, end.m_value, end.m_inTangent, T );
+            }
+        }
+
+        return 0.0f;
+    }
+
+    struct CurveScene
+    {
+        CurveScene( int32_t numPoints, bool sortParameters )
+        {
+            Math::RNG rng( g_seed );
+
+            float parameter = 0.0f;
+            for ( int32_t i = 0; i < numPoints; i++ )
+            {
+                m_curve.AddPoint( parameter, rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -2.0f, 2.0f ), rng.GetFloat( -2.0f, 2.0f ) );
+                parameter += rng.GetFloat( 0.1f, 1.0f );
+            }
+
+            // Include some parameters outside of the curve range
+            FloatRange const range = m_curve.GetParameterRange();
+            m_parameters.resize( g_numParameters );
+            for ( auto& p : m_parameters )
+            {
+                p = rng.GetFloat( range.m_begin - 0.5f, range.m_end + 0.5f );
+            }
+
+            if ( sortParameters )
+            {
+                eastl::sort( m_parameters.begin(), m_parameters.end() );
+            }
+
+            m_results.resize( g_numParameters );
+            m_bakedCurve.Bake( m_curve );
+
+            Validate();
+        }
+
+        // Check that all evaluation paths match the reference within the stated tolerances
+        void Validate()
+        {
+            m_curve.Evaluate( m_parameters.data(), m_results.data(), g_numParameters );
+
+            for ( uint32_t i = 0; i < g_numParameters; i++ )
+            {
+                float const reference = EvaluateLinearScan( m_curve, m_parameters[i] );
+                float const exactError = Math::Abs( m_curve.Evaluate( m_parameters[i] ) - reference );
+                float const batchError = Math::Abs( m_results[i] - reference );
+                float const bakedError = Math::Abs( m_bakedCurve.Evaluate( m_parameters[i] ) - reference );
+
+                if ( exactError > g_exactTolerance || batchError > g_exactTolerance || bakedError > m_bakedCurve.GetMaxError() * 1.1f + g_exactTolerance )
+                {
+                    printf( "Curve evaluation mismatch at %f: exact error %f, batch error %f, baked error %f (max: %f)\n", m_parameters[i], exactError, batchError, bakedError, m_bakedCurve.GetMaxError() );
+                    KRG_HALT();
+                }
+            }
+        }
+
+    public:
+
+        FloatCurve          m_curve;
+        BakedFloatCurve     m_bakedCurve;
+        TVector<float>      m_parameters;
+        TVector<float>      m_results;
+    };
+
+    //-------------------------------------------------------------------------
+
+    static void RunLinearScan( Benchmark::State& state, int32_t numPoints, bool sortParameters )
+    {
+        CurveScene scene( numPoints, sortParameters );
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            for ( uint32_t p = 0; p < g_numParameters; p++ )
+            {
+                scene.m_results[p] = EvaluateLinearScan( scene.m_curve, scene.m_parameters[p] );
+            }
+            Benchmark::DoNotOptimize( scene.m_results.data() );
+        }
+        state.StopTimer();
+    }
+
+    static void RunEvaluate( Benchmark::State& state, int32_t numPoints, bool sortParameters )
+    {
+        CurveScene scene( numPoints, sortParameters );
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            for ( uint32_t p = 0; p < g_numParameters; p++ )
+            {
+                scene.m_results[p] = scene.m_curve.Evaluate( scene.m_parameters[p] );
+            }
+            Benchmark::DoNotOptimize( scene.m_results.data() );
+        }
+        state.StopTimer();
+    }
+
+    static void RunBatch( Benchmark::State& state, int32_t numPoints, bool sortParameters )
+    {
+        CurveScene scene( numPoints, sortParameters );
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            scene.m_curve.Evaluate( scene.m_parameters.data(), scene.m_results.data(), g_numParameters );
+            Benchmark::DoNotOptimize( scene.m_results.data() );
+        }
+        state.StopTimer();
+    }
+
+    static void RunBaked( Benchmark::State& state, int32_t numPoints, bool sortParameters )
+    {
+        CurveScene scene( numPoints, sortParameters );
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            scene.m_bakedCurve.Evaluate( scene.m_parameters.data(), scene.m_results.data(), g_numParameters );
+            Benchmark::DoNotOptimize( scene.m_results.data() );
+        }
+        state.StopTimer();
+    }
+}
+
+//-------------------------------------------------------------------------
+// Typical small curve (easing/remapping)
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Curves, LinearScan_4Points ) { RunLinearScan( state, 4, false ); }
+KRG_BENCHMARK( Curves, Evaluate_4Points ) { RunEvaluate( state, 4, false ); }
+KRG_BENCHMARK( Curves, Batch_4Points ) { RunBatch( state, 4, false ); }
+KRG_BENCHMARK( Curves, Baked_4Points ) { RunBaked( state, 4, false ); }
+
+//-------------------------------------------------------------------------
+// Large curves
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Curves, LinearScan_64Points ) { RunLinearScan( state, 64, false ); }
+KRG_BENCHMARK( Curves, Evaluate_64Points ) { RunEvaluate( state, 64, false ); }
+KRG_BENCHMARK( Curves, Batch_64Points ) { RunBatch( state, 64, false ); }
+KRG_BENCHMARK( Curves, Baked_64Points ) { RunBaked( state, 64, false ); }
+
+KRG_BENCHMARK( Curves, LinearScan_64Points_Sorted ) { RunLinearScan( state, 64, true ); }
+KRG_BENCHMARK( Curves, Evaluate_64Points_Sorted ) { RunEvaluate( state, 64, true ); }
+KRG_BENCHMARK( Curves, Batch_64Points_Sorted ) { RunBatch( state, 64, true ); }
+KRG_BENCHMARK( Curves, Baked_64Points_Sorted ) { RunBaked( state, 64, true ); }
@@ -0,0 +1,80 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Drawing/DebugDrawingSystem.h"
+#include <thread>
+#include <cstdio>
+
+//-------------------------------------------------------------------------
+// Debug drawing thread stress test
+//-------------------------------------------------------------------------
+// Each iteration is one frame: a set of short lived threads all draw into the same drawing system, which is then reflected into the frame buffer
+// Running more threads than there are per-thread buffers exercises the shared buffer fallback, and since all threads exit before the
+// frame end, all per-thread buffers need to be reclaimed by the reflect. Both the number of commands and the number of buffers are validated
+
+#if KRG_DEVELOPMENT_TOOLS
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    static constexpr uint32_t const g_numLinesPerThread = 256;
+
+    static uint32_t GetNumLineCommands( Drawing::FrameCommandBuffer const& frameCommands )
+    {
+        return (uint32_t) ( frameCommands.m_opaqueDepthOn.m_lineCommands.size() + frameCommands.m_opaqueDepthOff.m_lineCommands.size() + frameCommands.m_transparentDepthOn.m_lineCommands.size() + frameCommands.m_transparentDepthOff.m_lineCommands.size() );
+    }
+
+    static void RunThreadStress( Benchmark::State& state, uint32_t numThreads )
+    {
+        Drawing::DrawingSystem drawingSystem;
+        Drawing::FrameCommandBuffer frameCommands;
+
+        TVector<std::thread> threads;
+        threads.reserve( numThreads );
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            for ( uint32_t t = 0; t < numThreads; t++ )
+            {
+                threads.emplace_back( [t, &drawingSystem] ()
+                {
+                    auto drawingContext = drawingSystem.GetDrawingContext();
+                    for ( uint32_t l = 0; l < g_numLinesPerThread; l++ )
+                    {
+                        Float3 const start( (float) t, (float) l, 0.0f );
+                        drawingContext.DrawLine( start, start + Float3( 0.0f, 0.0f, 1.0f ), Float4( 1.0f, 0.0f, 0.0f, 1.0f ) );
+                    }
+                } );
+            }
+
+            // All thread exit handlers have run once the threads are joined
+            for ( auto& thread : threads )
+            {
+                thread.join();
+            }
+            threads.clear();
+
+            drawingSystem.ReflectFrameCommandBuffer( 0.0f, frameCommands );
+
+            // Validate
+            //-------------------------------------------------------------------------
+
+            uint32_t const numLineCommands = GetNumLineCommands( frameCommands );
+            uint32_t const numThreadBuffers = drawingSystem.GetNumThreadCommandBuffers();
+            if ( numLineCommands != numThreads * g_numLinesPerThread || numThreadBuffers != 0 )
+            {
+                printf( "Debug drawing stress test failed: %u line commands (expected %u), %u thread buffers still in use (expected 0)\n", numLineCommands, numThreads * g_numLinesPerThread, numThreadBuffers );
+                KRG_HALT();
+            }
+        }
+        state.StopTimer();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( DebugDrawing, ThreadStress_8Threads ) { RunThreadStress( state, 8 ); }
+KRG_BENCHMARK( DebugDrawing, ThreadStress_64Threads ) { RunThreadStress( state, 64 ); }
+KRG_BENCHMARK( DebugDrawing, ThreadStress_128Threads ) { RunThreadStress( state, 128 ); }
+#endif
\ No newline at end of file
@@ -0,0 +1,260 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "Engine/_Module/EngineModule.h"
+#include "Engine/Entity/EntitySerialization.h"
+#include "Engine/Entity/EntityDescriptors.h"
+#include "Engine/Entity/EntitySpatialComponent.h"
+#include "System/TypeSystem/TypeRegistry.h"
+#include "System/TypeSystem/CoreTypeConversions.h"
+#include "System/Threading/TaskSystem.h"
+
+//-------------------------------------------------------------------------
+// Entity collection serialization
+//-------------------------------------------------------------------------
+// A synthetic collection of spatial entities (two components each) is written to and read from json, serially and across the task system
+// Only the descriptor reads are timed, parsing the json document is shared by both read paths
+// Before timing, the parallel write is checked to be byte-identical to the serial write, and both reads to produce the generated descriptors
+//
+// These need the engine types to be registered and the entity serializer only exists with the development tools
+
+#if KRG_DEVELOPMENT_TOOLS
+
+using namespace KRG;
+using namespace KRG::EntityModel;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    // Registers the engine types and runs the task system for the duration of a single sample
+    class EntitySerializationContext
+    {
+    public:
+
+        EntitySerializationContext()
+        {
+            EngineModule::RegisterTypes( m_typeRegistry );
+            m_taskSystem.Initialize();
+        }
+
+        ~EntitySerializationContext()
+        {
+            m_taskSystem.Shutdown();
+            EngineModule::UnregisterTypes( m_typeRegistry );
+        }
+
+    public:
+
+        TypeSystem::TypeRegistry            m_typeRegistry;
+        TaskSystem                          m_taskSystem;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Component names need to be unique across the whole collection
+    static void CreateCollection( TypeSystem::TypeRegistry const& typeRegistry, uint32_t numEntities, EntityCollectionDescriptor& outCollection )
+    {
+        TypeSystem::PropertyPath const transformPropertyPath( "m_transform" );
+        TypeSystem::TypeID const transformTypeID = TypeSystem::GetCoreTypeID( TypeSystem::CoreTypeID::Transform );
+
+        outCollection.Reserve( (int32_t) numEntities );
+
+        InlineString nameBuffer;
+        String transformString;
+        for ( uint32_t i = 0; i < numEntities; i++ )
+        {
+            EntityDescriptor entityDesc;
+            nameBuffer.sprintf( "Entity_%u", i );
+            entityDesc.m_name = StringID( nameBuffer.c_str() );
+
+            for ( uint32_t c = 0; c < 2; c++ )
+            {
+                ComponentDescriptor componentDesc;
+                nameBuffer.sprintf( "Entity_%u_Component_%u", i, c );
+                componentDesc.m_name = StringID( nameBuffer.c_str() );
+                componentDesc.m_typeID = SpatialEntityComponent::GetStaticTypeID();
+                componentDesc.m_isSpatialComponent = true;
+
+                if ( c > 0 )
+                {
+                    componentDesc.m_spatialParentName = entityDesc.m_components[0].m_name;
+                }
+
+                Transform const transform( Quaternion::Identity, Vector( (float) ( i % 1000 ), (float) ( i / 1000 ), (float) c ) );
+                TypeSystem::Conversion::ConvertNativeTypeToString( typeRegistry, transformTypeID, TypeSystem::TypeID(), &transform, transformString );
+                componentDesc.m_properties.emplace_back( TypeSystem::PropertyDescriptor( typeRegistry, transformPropertyPath, transformTypeID, TypeSystem::TypeID(), transformString ) );
+
+                entityDesc.m_components.emplace_back( componentDesc );
+                entityDesc.m_numSpatialComponents++;
+            }
+
+            outCollection.AddEntity( eastl::move( entityDesc ) );
+        }
+    }
+
+    static bool AreEntityDescriptorsEqual( EntityDescriptor const& a, EntityDescriptor const& b )
+    {
+        if ( a.m_name != b.m_name || a.m_spatialParentName != b.m_spatialParentName || a.m_attachmentSocketID != b.m_attachmentSocketID || a.m_numSpatialComponents != b.m_numSpatialComponents )
+        {
+            return false;
+        }
+
+        if ( a.m_systems.size() != b.m_systems.size() || a.m_components.size() != b.m_components.size() )
+        {
+            return false;
+        }
+
+        for ( auto i = 0u; i < a.m_systems.size(); i++ )
+        {
+            if ( a.m_systems[i].m_typeID != b.m_systems[i].m_typeID )
+            {
+                return false;
+            }
+        }
+
+        for ( auto i = 0u; i < a.m_components.size(); i++ )
+        {
+            ComponentDescriptor const& componentA = a.m_components[i];
+            ComponentDescriptor const& componentB = b.m_components[i];
+
+            if ( componentA.m_name != componentB.m_name || componentA.m_typeID != componentB.m_typeID || componentA.m_spatialParentName != componentB.m_spatialParentName || componentA.m_attachmentSocketID != componentB.m_attachmentSocketID )
+            {
+                return false;
+            }
+
+            if ( componentA.m_properties.size() != componentB.m_properties.size() )
+            {
+                return false;
+            }
+
+            for ( auto p = 0u; p < componentA.m_properties.size(); p++ )
+            {
+                if ( componentA.m_properties[p].m_path != componentB.m_properties[p].m_path || componentA.m_properties[p].m_byteValue != componentB.m_properties[p].m_byteValue )
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    static void ValidateReadCollection( EntityCollectionDescriptor const& collection, EntityCollectionDescriptor const& readCollection, char const* pPathName )
+    {
+        uint32_t const numEntities = (uint32_t) collection.GetNumEntityDescriptors();
+        if ( readCollection.GetNumEntityDescriptors() != collection.GetNumEntityDescriptors() )
+        {
+            printf( "Entity serialization validation failed (%u entities): the %s read produced %d entities\n", numEntities, pPathName, readCollection.GetNumEntityDescriptors() );
+            KRG_HALT();
+        }
+
+        for ( uint32_t i = 0; i < numEntities; i++ )
+        {
+            if ( !AreEntityDescriptorsEqual( collection.GetEntityDescriptors()[i], readCollection.GetEntityDescriptors()[i] ) )
+            {
+                printf( "Entity serialization validation failed (%u entities): the %s read produced a different descriptor for entity %u\n", numEntities, pPathName, i );
+                KRG_HALT();
+            }
+        }
+    }
+
+    // Writes the collection both ways and reads it back both ways, the serial write is returned for the read benchmarks
+    static void ValidateSerialization( EntitySerializationContext& context, EntityCollectionDescriptor const& collection, Serialization::JsonArchiveWriter& outSerialWriter )
+    {
+        uint32_t const numEntities = (uint32_t) collection.GetNumEntityDescriptors();
+
+        Serialization::JsonArchiveWriter parallelWriter;
+        if ( !Serializer::WriteEntityCollectionToJson( context.m_typeRegistry, collection, *outSerialWriter.GetWriter() ) || !Serializer::WriteEntityCollectionToJson( context.m_typeRegistry, collection, *parallelWriter.GetWriter(), &context.m_taskSystem ) )
+        {
+            printf( "Entity serialization validation failed (%u entities): failed to write the collection\n", numEntities );
+            KRG_HALT();
+        }
+
+        if ( strcmp( outSerialWriter.GetStringBuffer().GetString(), parallelWriter.GetStringBuffer().GetString() ) != 0 )
+        {
+            printf( "Entity serialization validation failed (%u entities): the parallel write differs from the serial write\n", numEntities );
+            KRG_HALT();
+        }
+
+        Serialization::JsonArchiveReader reader;
+        if ( !reader.ReadFromString( outSerialWriter.GetStringBuffer().GetString() ) || !reader.GetDocument().HasMember( "Entities" ) )
+        {
+            printf( "Entity serialization validation failed (%u entities): the written collection could not be parsed\n", numEntities );
+            KRG_HALT();
+        }
+
+        EntityCollectionDescriptor serialCollection;
+        EntityCollectionDescriptor parallelCollection;
+        if ( !Serializer::ReadEntityCollectionFromJson( context.m_typeRegistry, reader.GetDocument()["Entities"], serialCollection ) || !Serializer::ReadEntityCollectionFromJson( context.m_typeRegistry, reader.GetDocument()["Entities"], parallelCollection, &context.m_taskSystem ) )
+        {
+            printf( "Entity serialization validation failed (%u entities): failed to read the collection\n", numEntities );
+            KRG_HALT();
+        }
+
+        ValidateReadCollection( collection, serialCollection, "serial" );
+        ValidateReadCollection( collection, parallelCollection, "parallel" );
+    }
+
+    //-------------------------------------------------------------------------
+
+    static void RunWrite( Benchmark::State& state, uint32_t numEntities, bool isParallel )
+    {
+        EntitySerializationContext context;
+        TaskSystem* pTaskSystem = isParallel ? &context.m_taskSystem : nullptr;
+
+        EntityCollectionDescriptor collection;
+        CreateCollection( context.m_typeRegistry, numEntities, collection );
+
+        Serialization::JsonArchiveWriter validatedWriter;
+        ValidateSerialization( context, collection, validatedWriter );
+        state.SetBytesPerIteration( validatedWriter.GetStringBuffer().GetSize() );
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            Serialization::JsonArchiveWriter writer;
+            Serializer::WriteEntityCollectionToJson( context.m_typeRegistry, collection, *writer.GetWriter(), pTaskSystem );
+            Benchmark::DoNotOptimize( writer.GetStringBuffer().GetString() );
+        }
+        state.StopTimer();
+    }
+
+    static void RunRead( Benchmark::State& state, uint32_t numEntities, bool isParallel )
+    {
+        EntitySerializationContext context;
+        TaskSystem* pTaskSystem = isParallel ? &context.m_taskSystem : nullptr;
+
+        EntityCollectionDescriptor collection;
+        CreateCollection( context.m_typeRegistry, numEntities, collection );
+
+        Serialization::JsonArchiveWriter writer;
+        ValidateSerialization( context, collection, writer );
+        state.SetBytesPerIteration( writer.GetStringBuffer().GetSize() );
+
+        Serialization::JsonArchiveReader reader;
+        reader.ReadFromString( writer.GetStringBuffer().GetString() );
+        Serialization::JsonValue const& entitiesArrayValue = reader.GetDocument()["Entities"];
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            EntityCollectionDescriptor readCollection;
+            Serializer::ReadEntityCollectionFromJson( context.m_typeRegistry, entitiesArrayValue, readCollection, pTaskSystem );
+            Benchmark::DoNotOptimize( readCollection.GetEntityDescriptors().data() );
+        }
+        state.StopTimer();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( EntitySerialization, Write_1000Entities ) { RunWrite( state, 1000, false ); }
+KRG_BENCHMARK( EntitySerialization, WriteParallel_1000Entities ) { RunWrite( state, 1000, true ); }
+KRG_BENCHMARK( EntitySerialization, Read_1000Entities ) { RunRead( state, 1000, false ); }
+KRG_BENCHMARK( EntitySerialization, ReadParallel_1000Entities ) { RunRead( state, 1000, true ); }
+
+KRG_BENCHMARK( EntitySerialization, Write_50000Entities ) { RunWrite( state, 50000, false ); }
+KRG_BENCHMARK( EntitySerialization, WriteParallel_50000Entities ) { RunWrite( state, 50000, true ); }
+KRG_BENCHMARK( EntitySerialization, Read_50000Entities ) { RunRead( state, 50000, false ); }
+KRG_BENCHMARK( EntitySerialization, ReadParallel_50000Entities ) { RunRead( state, 50000, true ); }
+
+#endif
\ No newline at end of file
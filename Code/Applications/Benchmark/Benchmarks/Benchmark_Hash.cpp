@@ -0,0 +1,63 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Algorithm/Hash.h"
+#include "System/Math/MathRandom.h"
+
+//-------------------------------------------------------------------------
+
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    static constexpr size_t const g_smallInputSize = 16;
+    static constexpr size_t const g_largeInputSize = 64 * 1024;
+
+    static void CreateRandomData( Blob& outData, size_t size )
+    {
+        Math::RNG rng( 12345 );
+        outData.resize( size );
+        for ( auto& byte : outData )
+        {
+            byte = (uint8_t) rng.GetUInt( 0, 255 );
+        }
+    }
+
+    template<typename HashFunction>
+    static void RunHashBenchmark( Benchmark::State& state, size_t inputSize, HashFunction&& hashFunction )
+    {
+        Blob data;
+        CreateRandomData( data, inputSize );
+        state.SetBytesPerIteration( inputSize );
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            auto const hash = hashFunction( data.data(), data.size() );
+            Benchmark::DoNotOptimize( hash );
+        }
+        state.StopTimer();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Hash, GetHash32_Small )
+{
+    RunHashBenchmark( state, g_smallInputSize, [] ( void const* pData, size_t size ) { return Hash::XXHash::GetHash32( pData, size ); } );
+}
+
+KRG_BENCHMARK( Hash, GetHash32_Large )
+{
+    RunHashBenchmark( state, g_largeInputSize, [] ( void const* pData, size_t size ) { return Hash::XXHash::GetHash32( pData, size ); } );
+}
+
+KRG_BENCHMARK( Hash, GetHash64_Small )
+{
+    RunHashBenchmark( state, g_smallInputSize, [] ( void const* pData, size_t size ) { return Hash::XXHash::GetHash64( pData, size ); } );
+}
+
+KRG_BENCHMARK( Hash, GetHash64_Large )
+{
+    RunHashBenchmark( state, g_largeInputSize, [] ( void const* pData, size_t size ) { return Hash::XXHash::GetHash64( pData, size ); } );
+}
@@ -0,0 +1,130 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Log.h"
+#include "System/Threading/Threading.h"
+#include <thread>
+#include <ctime>
+
+//-------------------------------------------------------------------------
+// Logging producer cost
+//-------------------------------------------------------------------------
+// Measures the time the calling threads spend adding log entries, console output is disabled so that we only measure the logging pipeline
+// The multi-threaded tests include the thread creation, so each thread logs a large burst to amortize it
+// The mutex baseline reproduces the previous synchronous path (minus the printing) for comparison
+
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    static constexpr uint32_t const g_numEntriesPerThread = 2048;
+
+    // Disable the console output for the duration of a benchmark and make sure all entries are processed before the next one
+    struct ScopedQuietLog
+    {
+        ScopedQuietLog() { Log::SetConsoleOutputEnabled( false ); }
+        ~ScopedQuietLog() { Log::Flush(); Log::SetConsoleOutputEnabled( true ); }
+    };
+
+    // The previous implementation: everything is done by the producer while holding the lock
+    struct MutexLog
+    {
+        void AddEntry( Log::Severity severity, char const* pChannel, char const* pFilename, int lineNumber, char const* pMessageFormat, ... )
+        {
+            char msgbuffer[1024];
+            va_list args;
+            va_start( args, pMessageFormat );
+            VPrintf( msgbuffer, 1024, pMessageFormat, args );
+            va_end( args );
+
+            Threading::ScopeLock lock( m_mutex );
+
+            auto& entry = m_entries.emplace_back( Log::LogEntry() );
+            entry.m_message = msgbuffer;
+            entry.m_channel = pChannel;
+            entry.m_filename = pFilename;
+            entry.m_lineNumber = lineNumber;
+            entry.m_severity = severity;
+            entry.m_timestamp.resize( 9 );
+
+            auto t = std::time( nullptr );
+            strftime( entry.m_timestamp.data(), 9, "%H:%M:%S", std::localtime( &t ) );
+
+            Printf( msgbuffer, 1024, "[%s][%s] %s", entry.m_timestamp.c_str(), entry.m_channel.c_str(), entry.m_message.c_str() );
+            Benchmark::DoNotOptimize( msgbuffer );
+        }
+
+    public:
+
+        Threading::Mutex            m_mutex;
+        TVector<Log::LogEntry>      m_entries;
+    };
+
+    //-------------------------------------------------------------------------
+
+    template<typename LogFunction>
+    static void RunOnThreads( uint32_t numThreads, LogFunction&& logFunction )
+    {
+        TVector<std::thread> threads;
+        threads.reserve( numThreads );
+        for ( uint32_t t = 0; t < numThreads; t++ )
+        {
+            threads.emplace_back( [t, &logFunction] ()
+            {
+                for ( uint32_t i = 0; i < g_numEntriesPerThread; i++ )
+                {
+                    logFunction( t, i );
+                }
+            } );
+        }
+
+        for ( auto& thread : threads )
+        {
+            thread.join();
+        }
+    }
+
+    static void RunLog( Benchmark::State& state, uint32_t numThreads )
+    {
+        ScopedQuietLog const quietLog;
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            RunOnThreads( numThreads, [] ( uint32_t threadIdx, uint32_t entryIdx )
+            {
+                Log::AddEntry( Log::Severity::Message, "Benchmark", __FILE__, __LINE__, "Thread %u reporting entry %u: %.3f", threadIdx, entryIdx, entryIdx * 0.5f );
+            } );
+        }
+        state.StopTimer();
+    }
+
+    static void RunMutexLog( Benchmark::State& state, uint32_t numThreads )
+    {
+        MutexLog mutexLog;
+        mutexLog.m_entries.reserve( numThreads * g_numEntriesPerThread );
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            RunOnThreads( numThreads, [&mutexLog] ( uint32_t threadIdx, uint32_t entryIdx )
+            {
+                mutexLog.AddEntry( Log::Severity::Message, "Benchmark", __FILE__, __LINE__, "Thread %u reporting entry %u: %.3f", threadIdx, entryIdx, entryIdx * 0.5f );
+            } );
+
+            // Keep the history size comparable to the bounded one
+            mutexLog.m_entries.clear();
+        }
+        state.StopTimer();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Log, AddEntry_1Thread ) { RunLog( state, 1 ); }
+KRG_BENCHMARK( Log, AddEntry_4Threads ) { RunLog( state, 4 ); }
+KRG_BENCHMARK( Log, AddEntry_8Threads ) { RunLog( state, 8 ); }
+
+KRG_BENCHMARK( Log, MutexBaseline_1Thread ) { RunMutexLog( state, 1 ); }
+KRG_BENCHMARK( Log, MutexBaseline_4Threads ) { RunMutexLog( state, 4 ); }
+KRG_BENCHMARK( Log, MutexBaseline_8Threads ) { RunMutexLog( state, 8 ); }
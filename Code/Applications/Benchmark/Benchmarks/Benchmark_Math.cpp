@@ -0,0 +1,222 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Math/Transform.h"
+#include "System/Math/MathRandom.h"
+
+//-------------------------------------------------------------------------
+
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    static constexpr uint32_t const g_numElements = 256;
+    static constexpr uint32_t const g_seed = 12345;
+
+    static Vector GetRandomVector( Math::RNG const& rng, float min, float max )
+    {
+        return Vector( rng.GetFloat( min, max ), rng.GetFloat( min, max ), rng.GetFloat( min, max ), 0.0f );
+    }
+
+    static Quaternion GetRandomRotation( Math::RNG const& rng )
+    {
+        Vector axis = GetRandomVector( rng, -1.0f, 1.0f );
+        if ( axis.IsNearZero3() )
+        {
+            axis = Vector::UnitZ;
+        }
+
+        return Quaternion( axis.GetNormalized3(), Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ) );
+    }
+
+    static void CreateRandomTransforms( TVector<Transform>& outTransforms )
+    {
+        Math::RNG rng( g_seed );
+        outTransforms.reserve( g_numElements );
+        for ( uint32_t i = 0; i < g_numElements; i++ )
+        {
+            outTransforms.emplace_back( GetRandomRotation( rng ), GetRandomVector( rng, -100.0f, 100.0f ), Vector( 1, 1, 1, 0 ) );
+        }
+    }
+
+    static void CreateRandomRotations( TVector<Quaternion>& outRotations )
+    {
+        Math::RNG rng( g_seed );
+        outRotations.reserve( g_numElements );
+        for ( uint32_t i = 0; i < g_numElements; i++ )
+        {
+            outRotations.emplace_back( GetRandomRotation( rng ) );
+        }
+    }
+
+    static void CreateRandomMatrices( TVector<Matrix>& outMatrices )
+    {
+        Math::RNG rng( g_seed );
+        outMatrices.reserve( g_numElements );
+        for ( uint32_t i = 0; i < g_numElements; i++ )
+        {
+            outMatrices.emplace_back( GetRandomRotation( rng ), GetRandomVector( rng, -100.0f, 100.0f ) );
+        }
+    }
+
+    static void CreateRandomPoints( TVector<Vector>& outPoints )
+    {
+        Math::RNG rng( g_seed + 1 );
+        outPoints.reserve( g_numElements );
+        for ( uint32_t i = 0; i < g_numElements; i++ )
+        {
+            outPoints.emplace_back( GetRandomVector( rng, -100.0f, 100.0f ).GetWithW1() );
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+// Transform
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Transform, Multiply )
+{
+    TVector<Transform> transforms;
+    CreateRandomTransforms( transforms );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        uint32_t const idx = i % g_numElements;
+        Transform const result = transforms[idx] * transforms[( idx + 1 ) % g_numElements];
+        Benchmark::DoNotOptimize( result );
+    }
+    state.StopTimer();
+}
+
+KRG_BENCHMARK( Transform, Inverse )
+{
+    TVector<Transform> transforms;
+    CreateRandomTransforms( transforms );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        Transform const result = transforms[i % g_numElements].GetInverse();
+        Benchmark::DoNotOptimize( result );
+    }
+    state.StopTimer();
+}
+
+KRG_BENCHMARK( Transform, TransformPoint )
+{
+    TVector<Transform> transforms;
+    CreateRandomTransforms( transforms );
+
+    TVector<Vector> points;
+    CreateRandomPoints( points );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        uint32_t const idx = i % g_numElements;
+        Vector const result = transforms[idx].TransformPoint( points[idx] );
+        Benchmark::DoNotOptimize( result );
+    }
+    state.StopTimer();
+}
+
+//-------------------------------------------------------------------------
+// Quaternion
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Quaternion, Multiply )
+{
+    TVector<Quaternion> rotations;
+    CreateRandomRotations( rotations );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        uint32_t const idx = i % g_numElements;
+        Quaternion const result = rotations[idx] * rotations[( idx + 1 ) % g_numElements];
+        Benchmark::DoNotOptimize( result );
+    }
+    state.StopTimer();
+}
+
+KRG_BENCHMARK( Quaternion, RotateVector )
+{
+    TVector<Quaternion> rotations;
+    CreateRandomRotations( rotations );
+
+    TVector<Vector> points;
+    CreateRandomPoints( points );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        uint32_t const idx = i % g_numElements;
+        Vector const result = rotations[idx].RotateVector( points[idx] );
+        Benchmark::DoNotOptimize( result );
+    }
+    state.StopTimer();
+}
+
+KRG_BENCHMARK( Quaternion, NLerp )
+{
+    TVector<Quaternion> rotations;
+    CreateRandomRotations( rotations );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        uint32_t const idx = i % g_numElements;
+        Quaternion const result = Quaternion::NLerp( rotations[idx], rotations[( idx + 1 ) % g_numElements], 0.35f );
+        Benchmark::DoNotOptimize( result );
+    }
+    state.StopTimer();
+}
+
+KRG_BENCHMARK( Quaternion, SLerp )
+{
+    TVector<Quaternion> rotations;
+    CreateRandomRotations( rotations );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        uint32_t const idx = i % g_numElements;
+        Quaternion const result = Quaternion::SLerp( rotations[idx], rotations[( idx + 1 ) % g_numElements], 0.35f );
+        Benchmark::DoNotOptimize( result );
+    }
+    state.StopTimer();
+}
+
+//-------------------------------------------------------------------------
+// Matrix
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Matrix, Multiply )
+{
+    TVector<Matrix> matrices;
+    CreateRandomMatrices( matrices );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        uint32_t const idx = i % g_numElements;
+        Matrix const result = matrices[idx] * matrices[( idx + 1 ) % g_numElements];
+        Benchmark::DoNotOptimize( result );
+    }
+    state.StopTimer();
+}
+
+KRG_BENCHMARK( Matrix, Inverse )
+{
+    TVector<Matrix> matrices;
+    CreateRandomMatrices( matrices );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        Matrix const result = matrices[i % g_numElements].GetInverse();
+        Benchmark::DoNotOptimize( result );
+    }
+    state.StopTimer();
+}
@@ -0,0 +1,127 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Math/MathRandom.h"
+#include <thread>
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    static uint32_t GetNumContentionThreads()
+    {
+        return Math::Clamp( std::thread::hardware_concurrency(), 2u, 8u );
+    }
+
+    // Runs the generator function on multiple threads at once, each thread performs the full number of iterations
+    // Reports the wall clock time for all threads to complete, so an uncontended generator should report roughly the single threaded time
+    template<typename GeneratorFunction>
+    static void RunContendedBenchmark( Benchmark::State& state, GeneratorFunction&& generatorFunction )
+    {
+        uint32_t const numThreads = GetNumContentionThreads();
+        uint32_t const numIterations = state.GetNumIterations();
+
+        std::atomic<bool> startFlag = false;
+        std::atomic<uint32_t> numReadyThreads = 0;
+
+        TVector<std::thread> threads;
+        threads.reserve( numThreads );
+        for ( uint32_t t = 0; t < numThreads; t++ )
+        {
+            threads.emplace_back( [&, t] ()
+            {
+                numReadyThreads++;
+                while ( !startFlag.load( std::memory_order_acquire ) )
+                {
+                    std::this_thread::yield();
+                }
+
+                for ( uint32_t i = 0; i < numIterations; i++ )
+                {
+                    Benchmark::DoNotOptimize( generatorFunction( t ) );
+                }
+            } );
+        }
+
+        // Wait for all threads to be spun up so that we dont measure thread creation
+        while ( numReadyThreads.load() != numThreads )
+        {
+            std::this_thread::yield();
+        }
+
+        state.StartTimer();
+        startFlag.store( true, std::memory_order_release );
+        for ( auto& thread : threads )
+        {
+            thread.join();
+        }
+        state.StopTimer();
+    }
+}
+
+//-------------------------------------------------------------------------
+// Single threaded
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Random, GlobalGetRandomFloat )
+{
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        Benchmark::DoNotOptimize( Math::GetRandomFloat() );
+    }
+    state.StopTimer();
+}
+
+KRG_BENCHMARK( Random, ThreadRNGGetFloat )
+{
+    Math::RNG const& rng = Math::GetThreadRNG();
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        Benchmark::DoNotOptimize( rng.GetFloat() );
+    }
+    state.StopTimer();
+}
+
+KRG_BENCHMARK( Random, StreamRNGGetFloat )
+{
+    Math::RNG const rng( 12345ull, 1ull );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        Benchmark::DoNotOptimize( rng.GetFloat() );
+    }
+    state.StopTimer();
+}
+
+//-------------------------------------------------------------------------
+// Contended
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Random, Contended_GlobalGetRandomFloat )
+{
+    RunContendedBenchmark( state, [] ( uint32_t threadIdx ) { return Math::GetRandomFloat(); } );
+}
+
+KRG_BENCHMARK( Random, Contended_ThreadRNGGetFloat )
+{
+    RunContendedBenchmark( state, [] ( uint32_t threadIdx ) { return Math::GetThreadRNG().GetFloat(); } );
+}
+
+KRG_BENCHMARK( Random, Contended_StreamRNGGetFloat )
+{
+    // One stream per thread, this is the per-entity use case
+    TVector<Math::RNG> rngs;
+    for ( uint32_t t = 0; t < GetNumContentionThreads(); t++ )
+    {
+        rngs.emplace_back( 12345ull, uint64_t( t ) );
+    }
+
+    RunContendedBenchmark( state, [&rngs] ( uint32_t threadIdx ) { return rngs[threadIdx].GetFloat(); } );
+}
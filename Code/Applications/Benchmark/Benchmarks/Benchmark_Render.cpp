@@ -0,0 +1,229 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Render/RenderDevice.h"
+#include "System/Math/MathRandom.h"
+#include "System/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+// Render command replay
+//-------------------------------------------------------------------------
+// Measures the CPU-side submission cost of a captured frame using the null/recording render backend
+// A synthetic scene is captured once at setup, each iteration replays the captured command list through the immediate context
+// The replayed command log is checked against the capture (command counts, draw calls, vertices, bytes written)
+//
+// Only available when the null backend is compiled in, build the benchmark application with /p:KRG_RENDER_NULL=true
+
+#if !_WIN32 || KRG_RENDER_NULL
+
+using namespace KRG;
+using namespace KRG::Render;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    static constexpr uint32_t const g_numMeshes = 512;
+    static constexpr uint32_t const g_numSectionsPerMesh = 3;
+    static constexpr uint32_t const g_vertexStride = 32;
+    static constexpr uint32_t const g_constantBufferSize = sizeof( Float4 ) * 8;
+    static constexpr uint32_t const g_seed = 12345;
+
+    struct ReplayScene
+    {
+        ReplayScene()
+        {
+            m_device.Initialize();
+
+            Math::RNG rng( g_seed );
+
+            m_constantBuffer.m_type = RenderBuffer::Type::Constant;
+            m_constantBuffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+            m_constantBuffer.m_byteStride = g_constantBufferSize;
+            m_constantBuffer.m_byteSize = g_constantBufferSize;
+            m_device.CreateBuffer( m_constantBuffer );
+            m_buffers.insert( TPair<void const*, RenderBuffer const*>( m_constantBuffer.GetResourceHandle().m_pData, &m_constantBuffer ) );
+
+            m_constantData.resize( g_constantBufferSize );
+            for ( auto& byte : m_constantData )
+            {
+                byte = (uint8_t) rng.GetUInt( 0, 255 );
+            }
+
+            m_meshes.resize( g_numMeshes );
+            for ( auto& mesh : m_meshes )
+            {
+                uint32_t const numVertices = rng.GetUInt( 64, 4096 );
+                mesh.m_vertexBuffer.m_byteStride = g_vertexStride;
+                mesh.m_vertexBuffer.m_byteSize = numVertices * g_vertexStride;
+                m_device.CreateBuffer( mesh.m_vertexBuffer );
+                m_buffers.insert( TPair<void const*, RenderBuffer const*>( mesh.m_vertexBuffer.GetResourceHandle().m_pData, &mesh.m_vertexBuffer ) );
+
+                mesh.m_indexBuffer.m_type = RenderBuffer::Type::Index;
+                mesh.m_indexBuffer.m_byteStride = 2;
+                mesh.m_indexBuffer.m_byteSize = numVertices * 3 * 2;
+                m_device.CreateBuffer( mesh.m_indexBuffer );
+                m_buffers.insert( TPair<void const*, RenderBuffer const*>( mesh.m_indexBuffer.GetResourceHandle().m_pData, &mesh.m_indexBuffer ) );
+            }
+
+            Capture();
+        }
+
+        ~ReplayScene()
+        {
+            for ( auto& mesh : m_meshes )
+            {
+                m_device.DestroyBuffer( mesh.m_vertexBuffer );
+                m_device.DestroyBuffer( mesh.m_indexBuffer );
+            }
+            m_device.DestroyBuffer( m_constantBuffer );
+            m_device.Shutdown();
+        }
+
+        // Record a frame: per mesh, bind the geometry, write the per-object constants and draw each section
+        void Capture()
+        {
+            auto& commandLog = m_device.GetCommandLog();
+            commandLog.SetRecordingEnabled( true );
+            commandLog.Reset();
+
+            auto const& context = m_device.GetImmediateContext();
+            context.SetPrimitiveTopology( Topology::TriangleList );
+            for ( auto const& mesh : m_meshes )
+            {
+                context.SetVertexBuffer( mesh.m_vertexBuffer );
+                context.SetIndexBuffer( mesh.m_indexBuffer );
+                context.WriteToBuffer( m_constantBuffer, m_constantData.data(), g_constantBufferSize );
+
+                uint32_t const numIndices = mesh.m_indexBuffer.GetNumElements();
+                uint32_t const numIndicesPerSection = numIndices / g_numSectionsPerMesh;
+                for ( uint32_t s = 0; s < g_numSectionsPerMesh; s++ )
+                {
+                    context.DrawIndexed( numIndicesPerSection, s * numIndicesPerSection );
+                }
+            }
+
+            m_capturedCommands = commandLog.GetCommands();
+            m_numCapturedDrawCalls = commandLog.GetNumDrawCalls();
+            m_numCapturedVertices = commandLog.GetNumVerticesSubmitted();
+            m_numCapturedBytesWritten = commandLog.GetNumBytesWritten();
+            KRG_ASSERT( m_numCapturedDrawCalls == g_numMeshes * g_numSectionsPerMesh );
+        }
+
+        // Re-issue the captured commands through the immediate context
+        void Replay() const
+        {
+            auto const& context = m_device.GetImmediateContext();
+            for ( auto const& cmd : m_capturedCommands )
+            {
+                switch ( cmd.m_type )
+                {
+                    case RecordedCommandType::SetPrimitiveTopology:
+                    context.SetPrimitiveTopology( (Topology) cmd.m_args[0] );
+                    break;
+
+                    case RecordedCommandType::SetVertexBuffer:
+                    context.SetVertexBuffer( *GetBuffer( cmd.m_pResource ), cmd.m_args[0] );
+                    break;
+
+                    case RecordedCommandType::SetIndexBuffer:
+                    context.SetIndexBuffer( *GetBuffer( cmd.m_pResource ), cmd.m_args[0] );
+                    break;
+
+                    case RecordedCommandType::WriteToBuffer:
+                    context.WriteToBuffer( *GetBuffer( cmd.m_pResource ), m_constantData.data(), cmd.m_args[0] );
+                    break;
+
+                    case RecordedCommandType::Draw:
+                    context.Draw( cmd.m_args[0], cmd.m_args[1] );
+                    break;
+
+                    case RecordedCommandType::DrawIndexed:
+                    context.DrawIndexed( cmd.m_args[0], cmd.m_args[1], cmd.m_args[2] );
+                    break;
+
+                    default:
+                    KRG_UNREACHABLE_CODE();
+                    break;
+                }
+            }
+        }
+
+        // Check that the replayed frame matches the capture
+        void Validate() const
+        {
+            auto const& commandLog = m_device.GetCommandLog();
+
+            bool isValid = commandLog.GetNumDrawCalls() == m_numCapturedDrawCalls;
+            isValid &= commandLog.GetNumVerticesSubmitted() == m_numCapturedVertices;
+            isValid &= commandLog.GetNumBytesWritten() == m_numCapturedBytesWritten;
+            isValid &= commandLog.GetCommandCount( RecordedCommandType::WriteToBuffer ) == g_numMeshes;
+            isValid &= commandLog.GetCommandCount( RecordedCommandType::MapBuffer ) == 0;
+
+            if ( !isValid )
+            {
+                printf( "Render replay mismatch: %u draw calls (expected %u), %llu vertices (expected %llu), %llu bytes written (expected %llu)\n", commandLog.GetNumDrawCalls(), m_numCapturedDrawCalls, commandLog.GetNumVerticesSubmitted(), m_numCapturedVertices, commandLog.GetNumBytesWritten(), m_numCapturedBytesWritten );
+                KRG_HALT();
+            }
+        }
+
+    private:
+
+        RenderBuffer const* GetBuffer( void const* pResource ) const
+        {
+            auto iter = m_buffers.find( pResource );
+            KRG_ASSERT( iter != m_buffers.end() );
+            return iter->second;
+        }
+
+    public:
+
+        struct Mesh
+        {
+            VertexBuffer                                m_vertexBuffer;
+            RenderBuffer                                m_indexBuffer;
+        };
+
+        RenderDevice                                    m_device;
+        TVector<Mesh>                                   m_meshes;
+        RenderBuffer                                    m_constantBuffer;
+        Blob                                            m_constantData;
+        THashMap<void const*, RenderBuffer const*>      m_buffers;
+
+        TVector<RecordedCommand>                        m_capturedCommands;
+        uint32_t                                        m_numCapturedDrawCalls = 0;
+        uint64_t                                        m_numCapturedVertices = 0;
+        uint64_t                                        m_numCapturedBytesWritten = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    static void RunReplay( Benchmark::State& state, bool recordCommands )
+    {
+        ReplayScene scene;
+        auto& commandLog = scene.m_device.GetCommandLog();
+        commandLog.SetRecordingEnabled( recordCommands );
+
+        // Validate a single replay before timing
+        commandLog.Reset();
+        scene.Replay();
+        scene.Validate();
+
+        state.SetBytesPerIteration( scene.m_numCapturedBytesWritten );
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            commandLog.Reset();
+            scene.Replay();
+            Benchmark::ClobberMemory();
+        }
+        state.StopTimer();
+
+        scene.Validate();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Render, Replay_Recording ) { RunReplay( state, true ); }
+KRG_BENCHMARK( Render, Replay_StatsOnly ) { RunReplay( state, false ); }
+
+#endif
\ No newline at end of file
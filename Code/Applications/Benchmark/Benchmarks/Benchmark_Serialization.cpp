@@ -0,0 +1,217 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Serialization/BinarySerialization.h"
+#include "System/Math/MathRandom.h"
+#include "System/Math/Math.h"
+
+//-------------------------------------------------------------------------
+// Binary serialization of plain data arrays
+//-------------------------------------------------------------------------
+// Plain data arrays are written as a single raw block, the elementwise benchmarks run the same payload through the original path
+// where every array element is encoded/decoded individually by mpack, so the two can be compared directly
+
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    // A representative compiled-resource-like payload: a large plain data array, a string and some scalars
+    struct SerializationPayload
+    {
+        KRG_SERIALIZE( m_name, m_points, m_indices, m_flags, m_scale );
+
+        String                  m_name;
+        TVector<Float3>         m_points;
+        TVector<uint16_t>       m_indices;
+        uint32_t                m_flags = 0;
+        float                   m_scale = 1.0f;
+    };
+
+    static void CreatePayload( SerializationPayload& outPayload )
+    {
+        constexpr static uint32_t const numPoints = 1024;
+
+        Math::RNG rng( 12345 );
+        outPayload.m_name = "Benchmark Serialization Payload";
+        outPayload.m_flags = rng.GetUInt();
+        outPayload.m_scale = rng.GetFloat( 0.5f, 2.0f );
+
+        outPayload.m_points.reserve( numPoints );
+        outPayload.m_indices.reserve( numPoints * 3 );
+        for ( uint32_t i = 0; i < numPoints; i++ )
+        {
+            outPayload.m_points.emplace_back( rng.GetFloat( -100.0f, 100.0f ), rng.GetFloat( -100.0f, 100.0f ), rng.GetFloat( -100.0f, 100.0f ) );
+            outPayload.m_indices.emplace_back( (uint16_t) rng.GetUInt( 0, numPoints - 1 ) );
+            outPayload.m_indices.emplace_back( (uint16_t) rng.GetUInt( 0, numPoints - 1 ) );
+            outPayload.m_indices.emplace_back( (uint16_t) rng.GetUInt( 0, numPoints - 1 ) );
+        }
+    }
+
+    // The same payload serialized with the original element by element array encoding
+    struct ElementwiseSerializationPayload : public SerializationPayload
+    {
+        KRG_CUSTOM_SERIALIZE_WRITE_FUNCTION( archive )
+        {
+            archive << m_name;
+
+            uint64_t numPoints = m_points.size();
+            archive << numPoints;
+            for ( auto const& point : m_points )
+            {
+                archive << point;
+            }
+
+            uint64_t numIndices = m_indices.size();
+            archive << numIndices;
+            for ( auto const& index : m_indices )
+            {
+                archive << index;
+            }
+
+            archive << m_flags;
+            archive << m_scale;
+            return archive;
+        }
+
+        KRG_CUSTOM_SERIALIZE_READ_FUNCTION( archive )
+        {
+            archive << m_name;
+
+            uint64_t numPoints = 0;
+            archive << numPoints;
+            m_points.resize( numPoints );
+            for ( auto& point : m_points )
+            {
+                archive << point;
+            }
+
+            uint64_t numIndices = 0;
+            archive << numIndices;
+            m_indices.resize( numIndices );
+            for ( auto& index : m_indices )
+            {
+                archive << index;
+            }
+
+            archive << m_flags;
+            archive << m_scale;
+            return archive;
+        }
+    };
+
+    static bool ArePayloadsEqual( SerializationPayload const& a, SerializationPayload const& b )
+    {
+        if ( a.m_name != b.m_name || a.m_flags != b.m_flags || a.m_scale != b.m_scale )
+        {
+            return false;
+        }
+
+        if ( a.m_points.size() != b.m_points.size() || memcmp( a.m_points.data(), b.m_points.data(), a.m_points.size() * sizeof( Float3 ) ) != 0 )
+        {
+            return false;
+        }
+
+        return a.m_indices == b.m_indices;
+    }
+
+    // Both paths need to read back exactly what was written
+    template<typename PayloadType>
+    static void ValidateRoundTrip( char const* pPathName )
+    {
+        PayloadType payload;
+        CreatePayload( payload );
+
+        Blob data;
+        {
+            Serialization::BinaryOutputArchive archive;
+            archive << payload;
+            archive.GetAsBinaryBlob( data );
+        }
+
+        PayloadType readPayload;
+        Serialization::BinaryInputArchive archive;
+        archive.ReadFromBlob( data );
+        archive << readPayload;
+
+        if ( !ArePayloadsEqual( payload, readPayload ) )
+        {
+            printf( "Serialization validation failed: the %s path did not read back the written payload\n", pPathName );
+            KRG_HALT();
+        }
+    }
+
+    template<typename PayloadType>
+    static void RunWriteBenchmark( Benchmark::State& state )
+    {
+        PayloadType payload;
+        CreatePayload( payload );
+
+        // Measure the size of the output once so that we can report throughput
+        {
+            Serialization::BinaryOutputArchive archive;
+            archive << payload;
+            state.SetBytesPerIteration( archive.GetBinaryDataSize() );
+        }
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            Serialization::BinaryOutputArchive archive;
+            archive << payload;
+            Benchmark::DoNotOptimize( archive.GetBinaryData() );
+        }
+        state.StopTimer();
+    }
+
+    template<typename PayloadType>
+    static void RunReadBenchmark( Benchmark::State& state, char const* pPathName )
+    {
+        ValidateRoundTrip<PayloadType>( pPathName );
+
+        PayloadType payload;
+        CreatePayload( payload );
+
+        Blob data;
+        {
+            Serialization::BinaryOutputArchive archive;
+            archive << payload;
+            archive.GetAsBinaryBlob( data );
+        }
+        state.SetBytesPerIteration( data.size() );
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            PayloadType readPayload;
+            Serialization::BinaryInputArchive archive;
+            archive.ReadFromBlob( data );
+            archive << readPayload;
+            Benchmark::DoNotOptimize( readPayload.m_points.data() );
+        }
+        state.StopTimer();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// Plain data arrays as single raw blocks
+KRG_BENCHMARK( BinarySerialization, Write )
+{
+    RunWriteBenchmark<SerializationPayload>( state );
+}
+
+KRG_BENCHMARK( BinarySerialization, Read )
+{
+    RunReadBenchmark<SerializationPayload>( state, "raw block" );
+}
+
+// The original element by element mpack path, on the same data
+KRG_BENCHMARK( BinarySerialization, WriteElementwise )
+{
+    RunWriteBenchmark<ElementwiseSerializationPayload>( state );
+}
+
+KRG_BENCHMARK( BinarySerialization, ReadElementwise )
+{
+    RunReadBenchmark<ElementwiseSerializationPayload>( state, "elementwise" );
+}
\ No newline at end of file
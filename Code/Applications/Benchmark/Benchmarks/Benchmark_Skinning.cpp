@@ -0,0 +1,249 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Animation/AnimationSkinning.h"
+#include "System/Render/RenderVertexFormats.h"
+#include "System/Math/MathRandom.h"
+
+//-------------------------------------------------------------------------
+// Skinning palette generation for a crowd of characters
+//-------------------------------------------------------------------------
+// Each iteration generates the full skinning palette for every character in the crowd
+// All characters share the same mesh (inverse bind pose) but have their own pose
+// The skinned bounds tests merge the per-bone vertex bounds of a synthetic mesh for every character
+// Before timing, every CPU skinned vertex is checked to be contained in the computed bounds
+
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    static constexpr uint32_t const g_numCharacters = 256;
+    static constexpr uint32_t const g_numPoseBones = 96;
+    static constexpr uint32_t const g_numMeshBones = 80;
+    static constexpr uint32_t const g_numMeshVertices = 4096;
+    static constexpr uint32_t const g_seed = 12345;
+    static constexpr float const g_boundsTolerance = 0.001f;
+
+    static Transform CreateRandomTransform( Math::RNG& rng )
+    {
+        Quaternion const rotation( EulerAngles( rng.GetFloat( -180.0f, 180.0f ), rng.GetFloat( -180.0f, 180.0f ), rng.GetFloat( -180.0f, 180.0f ) ) );
+        Vector const translation( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( 0.0f, 2.0f ) );
+        return Transform( rotation, translation );
+    }
+
+    struct Crowd
+    {
+        Crowd()
+        {
+            Math::RNG rng( g_seed );
+
+            // Shared mesh data: the first mesh bones map to the skeleton in order, the remaining skeleton bones are unmapped
+            for ( uint32_t i = 0; i < g_numMeshBones; i++ )
+            {
+                m_inverseBindPose.emplace_back( CreateRandomTransform( rng ).GetInverse() );
+                m_inverseBindPoseMatrices.emplace_back( m_inverseBindPose.back().ToMatrix() );
+            }
+
+            for ( uint32_t i = 0; i < g_numPoseBones; i++ )
+            {
+                m_poseToMeshBoneMap.emplace_back( i < g_numMeshBones ? (int32_t) i : InvalidIndex );
+            }
+
+            // Per character data
+            m_poseTransforms.resize( g_numCharacters * g_numPoseBones );
+            for ( auto& transform : m_poseTransforms )
+            {
+                transform = CreateRandomTransform( rng );
+            }
+
+            m_meshBoneTransforms.resize( g_numCharacters * g_numMeshBones, Transform::Identity );
+            m_skinningTransforms.resize( g_numCharacters * g_numMeshBones, Matrix::Identity );
+        }
+
+    public:
+
+        TVector<Transform>      m_inverseBindPose;
+        TVector<Matrix>         m_inverseBindPoseMatrices;
+        TVector<int32_t>        m_poseToMeshBoneMap;
+        TVector<Transform>      m_poseTransforms;
+        TVector<Transform>      m_meshBoneTransforms;
+        TVector<Matrix>         m_skinningTransforms;
+    };
+
+    // A crowd sharing a randomly weighted mesh, each character's skinning palette is generated from its pose
+    struct SkinnedMeshCrowd : public Crowd
+    {
+        SkinnedMeshCrowd()
+        {
+            Math::RNG rng( g_seed + 1 );
+
+            m_vertices.resize( g_numMeshVertices );
+            for ( auto& vertex : m_vertices )
+            {
+                vertex = Render::SkeletalMeshVertex();
+                vertex.m_position = Float3( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( 0.0f, 2.0f ) );
+
+                // Between one and four influences, the weights always sum to 255
+                uint32_t const numInfluences = rng.GetUInt( 1, 4 );
+                uint32_t remainingWeight = 255;
+                for ( uint32_t i = 0; i < numInfluences; i++ )
+                {
+                    bool const isLastInfluence = ( i == numInfluences - 1 ) || remainingWeight == 0;
+                    uint8_t const weight = (uint8_t) ( isLastInfluence ? remainingWeight : rng.GetUInt( 0, remainingWeight ) );
+                    vertex.m_boneIndices[i] = (uint8_t) rng.GetUInt( 0, g_numMeshBones - 1 );
+                    vertex.m_boneWeights[i] = weight;
+                    remainingWeight -= weight;
+                }
+            }
+
+            Render::CalculateBoneVertexBounds( m_vertices.data(), g_numMeshVertices, g_numMeshBones, m_boneVertexBounds );
+
+            // The first pose bones map to the mesh bones in order
+            for ( uint32_t c = 0; c < g_numCharacters; c++ )
+            {
+                Animation::CalculateSkinningTransforms( m_inverseBindPoseMatrices.data(), &m_poseTransforms[c * g_numPoseBones], &m_skinningTransforms[c * g_numMeshBones], g_numMeshBones );
+            }
+
+            m_skinnedBounds.resize( g_numCharacters );
+        }
+
+    public:
+
+        TVector<Render::SkeletalMeshVertex>     m_vertices;
+        TVector<AABB>                           m_boneVertexBounds;
+        TVector<AABB>                           m_skinnedBounds;
+    };
+
+    // Every CPU skinned vertex needs to be contained in the skinned bounds, otherwise meshes will get incorrectly culled
+    static void ValidateSkinnedBounds( SkinnedMeshCrowd const& crowd )
+    {
+        Vector const tolerance( g_boundsTolerance );
+
+        for ( uint32_t c = 0; c < g_numCharacters; c++ )
+        {
+            Matrix const* pSkinningTransforms = &crowd.m_skinningTransforms[c * g_numMeshBones];
+
+            AABB skinnedBounds;
+            if ( !Animation::CalculateSkinnedBounds( crowd.m_boneVertexBounds.data(), pSkinningTransforms, g_numMeshBones, skinnedBounds ) )
+            {
+                printf( "Skinned bounds validation failed (character %u): no valid bone bounds\n", c );
+                KRG_HALT();
+            }
+
+            Vector const min = skinnedBounds.GetMin() - tolerance;
+            Vector const max = skinnedBounds.GetMax() + tolerance;
+            for ( uint32_t v = 0; v < g_numMeshVertices; v++ )
+            {
+                Vector const skinnedPosition = Render::CalculateSkinnedVertexPosition( crowd.m_vertices[v], pSkinningTransforms );
+                if ( !skinnedPosition.IsGreaterThanEqual3( min ) || !skinnedPosition.IsLessThanEqual3( max ) )
+                {
+                    printf( "Skinned bounds validation failed (character %u): vertex %u is outside of the bounds\n", c, v );
+                    KRG_HALT();
+                }
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// The original per-component path: copy the pose into the mesh bones, then multiply the transforms and convert each one to a matrix
+KRG_BENCHMARK( Skinning, PerBoneTransformMultiply )
+{
+    Crowd crowd;
+    state.SetBytesPerIteration( g_numCharacters * g_numMeshBones * sizeof( Matrix ) );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        for ( uint32_t c = 0; c < g_numCharacters; c++ )
+        {
+            Transform const* pPose = &crowd.m_poseTransforms[c * g_numPoseBones];
+            Transform* pMeshBones = &crowd.m_meshBoneTransforms[c * g_numMeshBones];
+            Matrix* pSkinningTransforms = &crowd.m_skinningTransforms[c * g_numMeshBones];
+
+            for ( uint32_t b = 0; b < g_numPoseBones; b++ )
+            {
+                int32_t const meshBoneIdx = crowd.m_poseToMeshBoneMap[b];
+                if ( meshBoneIdx != InvalidIndex )
+                {
+                    pMeshBones[meshBoneIdx] = pPose[b];
+                }
+            }
+
+            for ( uint32_t b = 0; b < g_numMeshBones; b++ )
+            {
+                Transform const skinningTransform = crowd.m_inverseBindPose[b] * pMeshBones[b];
+                pSkinningTransforms[b] = skinningTransform.ToMatrix();
+            }
+        }
+        Benchmark::DoNotOptimize( crowd.m_skinningTransforms.data() );
+    }
+    state.StopTimer();
+}
+
+// Palette only, from already set mesh bones
+KRG_BENCHMARK( Skinning, CalculateSkinningTransforms )
+{
+    Crowd crowd;
+    state.SetBytesPerIteration( g_numCharacters * g_numMeshBones * sizeof( Matrix ) );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        for ( uint32_t c = 0; c < g_numCharacters; c++ )
+        {
+            Animation::CalculateSkinningTransforms( crowd.m_inverseBindPoseMatrices.data(), &crowd.m_meshBoneTransforms[c * g_numMeshBones], &crowd.m_skinningTransforms[c * g_numMeshBones], g_numMeshBones );
+        }
+        Benchmark::DoNotOptimize( crowd.m_skinningTransforms.data() );
+    }
+    state.StopTimer();
+}
+
+// Fused pose copy and palette generation for the whole crowd in a single batch
+KRG_BENCHMARK( Skinning, FusedBatch )
+{
+    Crowd crowd;
+    state.SetBytesPerIteration( g_numCharacters * g_numMeshBones * sizeof( Matrix ) );
+
+    TVector<Animation::SkinningTask> tasks;
+    tasks.resize( g_numCharacters );
+    for ( uint32_t c = 0; c < g_numCharacters; c++ )
+    {
+        auto& task = tasks[c];
+        task.m_pPoseTransforms = &crowd.m_poseTransforms[c * g_numPoseBones];
+        task.m_pPoseToMeshBoneMap = crowd.m_poseToMeshBoneMap.data();
+        task.m_pInverseBindPose = crowd.m_inverseBindPoseMatrices.data();
+        task.m_pMeshBoneTransforms = &crowd.m_meshBoneTransforms[c * g_numMeshBones];
+        task.m_pSkinningTransforms = &crowd.m_skinningTransforms[c * g_numMeshBones];
+        task.m_numPoseBones = g_numPoseBones;
+        task.m_numMeshBones = g_numMeshBones;
+    }
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        Animation::ExecuteSkinningTasks( tasks.data(), (uint32_t) tasks.size() );
+        Benchmark::DoNotOptimize( crowd.m_skinningTransforms.data() );
+    }
+    state.StopTimer();
+}
+
+
+// Merge the per-bone vertex bounds into the skinned mesh bounds for the whole crowd
+KRG_BENCHMARK( Skinning, CalculateSkinnedBounds )
+{
+    SkinnedMeshCrowd crowd;
+    ValidateSkinnedBounds( crowd );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        for ( uint32_t c = 0; c < g_numCharacters; c++ )
+        {
+            Animation::CalculateSkinnedBounds( crowd.m_boneVertexBounds.data(), &crowd.m_skinningTransforms[c * g_numMeshBones], g_numMeshBones, crowd.m_skinnedBounds[c] );
+        }
+        Benchmark::DoNotOptimize( crowd.m_skinnedBounds.data() );
+    }
+    state.StopTimer();
+}
\ No newline at end of file
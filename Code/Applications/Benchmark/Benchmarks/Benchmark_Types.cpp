@@ -0,0 +1,160 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Types/HashMap.h"
+#include "System/Types/StringID.h"
+#include "System/Math/MathRandom.h"
+
+//-------------------------------------------------------------------------
+
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    static constexpr uint32_t const g_numElements = 1024;
+    static constexpr uint32_t const g_seed = 12345;
+
+    static void CreateRandomKeys( TVector<uint32_t>& outKeys )
+    {
+        Math::RNG rng( g_seed );
+        outKeys.reserve( g_numElements );
+        for ( uint32_t i = 0; i < g_numElements; i++ )
+        {
+            outKeys.emplace_back( rng.GetUInt() );
+        }
+    }
+
+    static void CreateRandomStrings( TVector<String>& outStrings )
+    {
+        Math::RNG rng( g_seed );
+        outStrings.reserve( g_numElements );
+        for ( uint32_t i = 0; i < g_numElements; i++ )
+        {
+            outStrings.emplace_back( String( String::CtorSprintf(), "Benchmark_%u_%u", i, rng.GetUInt() ) );
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+// TVector
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( TVector, PushBack )
+{
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        TVector<uint32_t> values;
+        for ( uint32_t j = 0; j < g_numElements; j++ )
+        {
+            values.push_back( j );
+        }
+        Benchmark::DoNotOptimize( values.data() );
+    }
+    state.StopTimer();
+}
+
+KRG_BENCHMARK( TVector, PushBackReserved )
+{
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        TVector<uint32_t> values;
+        values.reserve( g_numElements );
+        for ( uint32_t j = 0; j < g_numElements; j++ )
+        {
+            values.push_back( j );
+        }
+        Benchmark::DoNotOptimize( values.data() );
+    }
+    state.StopTimer();
+}
+
+//-------------------------------------------------------------------------
+// THashMap
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( THashMap, Insert )
+{
+    TVector<uint32_t> keys;
+    CreateRandomKeys( keys );
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        THashMap<uint32_t, uint32_t> map;
+        for ( uint32_t j = 0; j < g_numElements; j++ )
+        {
+            map.insert( TPair<uint32_t, uint32_t>( keys[j], j ) );
+        }
+        Benchmark::DoNotOptimize( map.size() );
+    }
+    state.StopTimer();
+}
+
+KRG_BENCHMARK( THashMap, Find )
+{
+    TVector<uint32_t> keys;
+    CreateRandomKeys( keys );
+
+    THashMap<uint32_t, uint32_t> map;
+    for ( uint32_t j = 0; j < g_numElements; j++ )
+    {
+        map.insert( TPair<uint32_t, uint32_t>( keys[j], j ) );
+    }
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        auto iter = map.find( keys[i % g_numElements] );
+        Benchmark::DoNotOptimize( iter->second );
+    }
+    state.StopTimer();
+}
+
+//-------------------------------------------------------------------------
+// StringID
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( StringID, CreateFromString )
+{
+    TVector<String> strings;
+    CreateRandomStrings( strings );
+
+    // Intern all strings first so that we measure the steady state (hash + lookup) rather than the first insertion
+    for ( auto const& str : strings )
+    {
+        StringID const ID( str );
+        Benchmark::DoNotOptimize( ID );
+    }
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        StringID const ID( strings[i % g_numElements] );
+        Benchmark::DoNotOptimize( ID );
+    }
+    state.StopTimer();
+}
+
+KRG_BENCHMARK( StringID, Compare )
+{
+    TVector<String> strings;
+    CreateRandomStrings( strings );
+
+    TVector<StringID> IDs;
+    IDs.reserve( g_numElements );
+    for ( auto const& str : strings )
+    {
+        IDs.emplace_back( str );
+    }
+
+    state.StartTimer();
+    for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+    {
+        uint32_t const idx = i % g_numElements;
+        bool const result = IDs[idx] == IDs[( idx + 1 ) % g_numElements];
+        Benchmark::DoNotOptimize( result );
+    }
+    state.StopTimer();
+}
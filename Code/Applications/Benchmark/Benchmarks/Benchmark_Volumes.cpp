@@ -0,0 +1,258 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Math/VolumeOverlapTracker.h"
+#include "System/Math/MathRandom.h"
+#include <EASTL/sort.h>
+
+//-------------------------------------------------------------------------
+// Trigger volume scaling tests
+//-------------------------------------------------------------------------
+// A fixed number of moving triggerers against 100 to 100k static volumes
+// The world size grows with the volume count so the volume density (and so the number of overlaps per triggerer) stays constant
+// Each iteration is one frame: move all triggerers and generate the enter/stay/exit events
+// Before timing, the tracker's enter/exit events are validated against a brute force reference over a number of frames
+
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    static constexpr uint32_t const g_numTriggerers = 64;
+    static constexpr uint32_t const g_seed = 12345;
+    static constexpr float const g_areaPerVolume = 100.0f; // m^2
+    static constexpr float const g_triggererSpeed = 0.1f; // m per frame
+    static constexpr uint32_t const g_numValidationFrames = 16;
+
+    struct VolumeScene
+    {
+        VolumeScene( uint32_t numVolumes )
+        {
+            Math::RNG rng( g_seed );
+            m_worldHalfSize = Math::Sqrt( numVolumes * g_areaPerVolume ) / 2;
+
+            m_volumes.reserve( numVolumes );
+            for ( uint32_t i = 0; i < numVolumes; i++ )
+            {
+                Vector const center( rng.GetFloat( -m_worldHalfSize, m_worldHalfSize ), rng.GetFloat( -m_worldHalfSize, m_worldHalfSize ), 0.0f );
+                Vector const extents( rng.GetFloat( 1.0f, 5.0f ), rng.GetFloat( 1.0f, 5.0f ), rng.GetFloat( 1.0f, 3.0f ) );
+                m_volumes.emplace_back( center, extents );
+            }
+
+            m_triggerers.reserve( g_numTriggerers );
+            m_directions.reserve( g_numTriggerers );
+            for ( uint32_t i = 0; i < g_numTriggerers; i++ )
+            {
+                Vector const center( rng.GetFloat( -m_worldHalfSize, m_worldHalfSize ), rng.GetFloat( -m_worldHalfSize, m_worldHalfSize ), 0.0f );
+                m_triggerers.emplace_back( center, Vector( 0.5f, 0.5f, 1.0f ) );
+
+                float const angle = rng.GetFloat( 0.0f, Math::TwoPi );
+                m_directions.emplace_back( Vector( Math::Cos( angle ), Math::Sin( angle ), 0.0f ) * g_triggererSpeed );
+            }
+        }
+
+        // Move all triggerers, bouncing off the world edges
+        void MoveTriggerers()
+        {
+            for ( uint32_t i = 0; i < g_numTriggerers; i++ )
+            {
+                Vector newCenter = m_triggerers[i].GetCenter() + m_directions[i];
+                if ( Math::Abs( newCenter.m_x ) > m_worldHalfSize || Math::Abs( newCenter.m_y ) > m_worldHalfSize )
+                {
+                    m_directions[i] = m_directions[i].GetNegated();
+                    newCenter = m_triggerers[i].GetCenter() + m_directions[i];
+                }
+
+                m_triggerers[i].SetCenter( newCenter );
+            }
+        }
+
+    public:
+
+        TVector<AABB>       m_volumes;
+        TVector<AABB>       m_triggerers;
+        TVector<Vector>     m_directions;
+        float               m_worldHalfSize = 0.0f;
+    };
+
+    //-------------------------------------------------------------------------
+
+    static void BuildTracker( VolumeScene const& scene, Math::VolumeOverlapTracker& tracker )
+    {
+        for ( uint32_t i = 0; i < scene.m_volumes.size(); i++ )
+        {
+            tracker.AddVolume( i + 1, scene.m_volumes[i] );
+        }
+
+        for ( uint32_t i = 0; i < g_numTriggerers; i++ )
+        {
+            tracker.AddTriggerer( i + 1, scene.m_triggerers[i] );
+        }
+
+        tracker.Update();
+    }
+
+    using OverlapPair = TPair<uint64_t, uint64_t>; // Volume ID, Triggerer ID
+
+    // Find all the overlaps for the current triggerer positions, sorted by volume and then triggerer ID
+    static void FindBruteForceOverlaps( VolumeScene const& scene, TVector<OverlapPair>& outOverlaps )
+    {
+        outOverlaps.clear();
+        for ( uint32_t t = 0; t < g_numTriggerers; t++ )
+        {
+            for ( uint32_t v = 0; v < scene.m_volumes.size(); v++ )
+            {
+                if ( scene.m_volumes[v].Overlaps( scene.m_triggerers[t] ) )
+                {
+                    outOverlaps.emplace_back( v + 1, t + 1 );
+                }
+            }
+        }
+
+        eastl::sort( outOverlaps.begin(), outOverlaps.end() );
+    }
+
+    static void GetSortedEvents( Math::VolumeOverlapTracker const& tracker, Math::VolumeOverlapTracker::Event::Type type, TVector<OverlapPair>& outPairs )
+    {
+        outPairs.clear();
+        for ( auto const& event : tracker.GetEvents() )
+        {
+            if ( event.m_type == type )
+            {
+                outPairs.emplace_back( event.m_volumeID, event.m_triggererID );
+            }
+        }
+
+        eastl::sort( outPairs.begin(), outPairs.end() );
+    }
+
+    // The tracker's enter/exit events need to match the changes in the brute force overlap sets each frame
+    static void ValidateTrackerEvents( uint32_t numVolumes )
+    {
+        VolumeScene scene( numVolumes );
+        Math::VolumeOverlapTracker tracker;
+
+        TVector<OverlapPair> previousOverlaps, currentOverlaps;
+        TVector<OverlapPair> expectedEnters, expectedExits, enters, exits;
+
+        for ( uint32_t frame = 0; frame < g_numValidationFrames; frame++ )
+        {
+            if ( frame == 0 )
+            {
+                BuildTracker( scene, tracker );
+            }
+            else
+            {
+                scene.MoveTriggerers();
+                for ( uint32_t t = 0; t < g_numTriggerers; t++ )
+                {
+                    tracker.UpdateTriggerer( t + 1, scene.m_triggerers[t] );
+                }
+
+                tracker.Update();
+            }
+
+            FindBruteForceOverlaps( scene, currentOverlaps );
+
+            expectedEnters.clear();
+            eastl::set_difference( currentOverlaps.begin(), currentOverlaps.end(), previousOverlaps.begin(), previousOverlaps.end(), eastl::back_inserter( expectedEnters ) );
+            expectedExits.clear();
+            eastl::set_difference( previousOverlaps.begin(), previousOverlaps.end(), currentOverlaps.begin(), currentOverlaps.end(), eastl::back_inserter( expectedExits ) );
+
+            GetSortedEvents( tracker, Math::VolumeOverlapTracker::Event::Type::Enter, enters );
+            GetSortedEvents( tracker, Math::VolumeOverlapTracker::Event::Type::Exit, exits );
+
+            if ( enters != expectedEnters || exits != expectedExits )
+            {
+                printf( "Volume tracker validation failed (%u volumes, frame %u): %u enters (expected %u), %u exits (expected %u)\n", numVolumes, frame, (uint32_t) enters.size(), (uint32_t) expectedEnters.size(), (uint32_t) exits.size(), (uint32_t) expectedExits.size() );
+                KRG_HALT();
+            }
+
+            previousOverlaps.swap( currentOverlaps );
+        }
+    }
+
+    static void RunTrackerUpdate( Benchmark::State& state, uint32_t numVolumes )
+    {
+        ValidateTrackerEvents( numVolumes );
+
+        VolumeScene scene( numVolumes );
+        Math::VolumeOverlapTracker tracker;
+        BuildTracker( scene, tracker );
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            scene.MoveTriggerers();
+            for ( uint32_t t = 0; t < g_numTriggerers; t++ )
+            {
+                tracker.UpdateTriggerer( t + 1, scene.m_triggerers[t] );
+            }
+
+            tracker.Update();
+            Benchmark::DoNotOptimize( tracker.GetEvents().data() );
+        }
+        state.StopTimer();
+    }
+
+    // Reference: what every system doing its own tests costs, note this only finds the overlaps and does not generate any events
+    static void RunBruteForce( Benchmark::State& state, uint32_t numVolumes )
+    {
+        VolumeScene scene( numVolumes );
+        TVector<uint32_t> overlaps;
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            scene.MoveTriggerers();
+
+            overlaps.clear();
+            for ( uint32_t t = 0; t < g_numTriggerers; t++ )
+            {
+                for ( uint32_t v = 0; v < numVolumes; v++ )
+                {
+                    if ( scene.m_volumes[v].Overlaps( scene.m_triggerers[t] ) )
+                    {
+                        overlaps.emplace_back( v );
+                    }
+                }
+            }
+            Benchmark::DoNotOptimize( overlaps.data() );
+        }
+        state.StopTimer();
+    }
+
+    static void RunBuild( Benchmark::State& state, uint32_t numVolumes )
+    {
+        VolumeScene scene( numVolumes );
+
+        state.StartTimer();
+        for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+        {
+            Math::VolumeOverlapTracker tracker;
+            BuildTracker( scene, tracker );
+            Benchmark::DoNotOptimize( tracker.GetEvents().data() );
+        }
+        state.StopTimer();
+    }
+}
+
+//-------------------------------------------------------------------------
+// Per frame update
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Volumes, Update_100 ) { RunTrackerUpdate( state, 100 ); }
+KRG_BENCHMARK( Volumes, Update_1000 ) { RunTrackerUpdate( state, 1000 ); }
+KRG_BENCHMARK( Volumes, Update_10000 ) { RunTrackerUpdate( state, 10000 ); }
+KRG_BENCHMARK( Volumes, Update_100000 ) { RunTrackerUpdate( state, 100000 ); }
+
+KRG_BENCHMARK( Volumes, BruteForce_100 ) { RunBruteForce( state, 100 ); }
+KRG_BENCHMARK( Volumes, BruteForce_1000 ) { RunBruteForce( state, 1000 ); }
+KRG_BENCHMARK( Volumes, BruteForce_10000 ) { RunBruteForce( state, 10000 ); }
+KRG_BENCHMARK( Volumes, BruteForce_100000 ) { RunBruteForce( state, 100000 ); }
+
+//-------------------------------------------------------------------------
+// Registration
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Volumes, Build_1000 ) { RunBuild( state, 1000 ); }
+KRG_BENCHMARK( Volumes, Build_10000 ) { RunBuild( state, 10000 ); }
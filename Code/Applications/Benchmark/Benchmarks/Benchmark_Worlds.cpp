@@ -0,0 +1,181 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Math/MathRandom.h"
+#include "System/Math/Vector.h"
+
+//-------------------------------------------------------------------------
+// Multi-world update scaling
+//-------------------------------------------------------------------------
+// Reproduces the scheduling used by EntityWorldManager::UpdateWorlds for 1 to 8 worlds:
+//  * Serial: each world is updated on the main thread, one after the other (non-independent worlds)
+//  * Parallel: all worlds are updated as a single task set (independent worlds)
+//
+// Each simulated world matches the shape of EntityWorld::Update: a nested task set for the entity updates that the world waits on,
+// followed by a serial world system update. The benchmark app only links System, so the entity/system work is a synthetic integration workload.
+// Ideal scaling is a flat time per iteration for the parallel version up to the number of cores, the serial version grows linearly.
+
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+    static constexpr uint32_t const g_numEntitiesPerWorld = 512;
+    static constexpr uint32_t const g_numStepsPerEntity = 32;
+    static constexpr uint32_t const g_seed = 12345;
+
+    struct SimulatedEntity
+    {
+        Vector                              m_position;
+        Vector                              m_velocity;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class SimulatedWorld
+    {
+        struct EntityUpdateTask final : public ITaskSet
+        {
+            EntityUpdateTask( TVector<SimulatedEntity>& entities )
+                : m_entities( entities )
+            {
+                m_SetSize = (uint32_t) entities.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                Vector const gravity( 0.0f, 0.0f, -9.8f, 0.0f );
+                float const dt = 1.0f / 60.0f;
+
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    auto& entity = m_entities[i];
+                    for ( uint32_t s = 0; s < g_numStepsPerEntity; s++ )
+                    {
+                        entity.m_velocity = ( entity.m_velocity + gravity * dt ) * 0.99f;
+                        entity.m_position += entity.m_velocity * dt;
+                    }
+                }
+            }
+
+        private:
+
+            TVector<SimulatedEntity>&       m_entities;
+        };
+
+    public:
+
+        SimulatedWorld( TaskSystem* pTaskSystem, uint32_t worldIdx )
+            : m_pTaskSystem( pTaskSystem )
+        {
+            Math::RNG rng( g_seed + worldIdx );
+            m_entities.resize( g_numEntitiesPerWorld );
+            for ( auto& entity : m_entities )
+            {
+                entity.m_position = Vector( rng.GetFloat( -100.0f, 100.0f ), rng.GetFloat( -100.0f, 100.0f ), rng.GetFloat( 0.0f, 10.0f ), 0.0f );
+                entity.m_velocity = Vector( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), 0.0f );
+            }
+        }
+
+        void Update()
+        {
+            // Update entities
+            EntityUpdateTask entityUpdateTask( m_entities );
+            m_pTaskSystem->ScheduleTask( &entityUpdateTask );
+            m_pTaskSystem->WaitForTask( &entityUpdateTask );
+
+            // Update world systems
+            Vector bounds = Vector::Zero;
+            for ( auto const& entity : m_entities )
+            {
+                bounds = Vector::Max( bounds, entity.m_position.GetAbs() );
+            }
+            m_bounds = bounds;
+        }
+
+    public:
+
+        TaskSystem*                         m_pTaskSystem = nullptr;
+        TVector<SimulatedEntity>            m_entities;
+        Vector                              m_bounds = Vector::Zero;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct WorldUpdateTask final : public ITaskSet
+    {
+        WorldUpdateTask( TVector<SimulatedWorld>& worlds )
+            : m_worlds( worlds )
+        {
+            m_SetSize = (uint32_t) worlds.size();
+        }
+
+        virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+        {
+            for ( uint64_t i = range.start; i < range.end; ++i )
+            {
+                m_worlds[i].Update();
+            }
+        }
+
+    private:
+
+        TVector<SimulatedWorld>&            m_worlds;
+    };
+
+    //-------------------------------------------------------------------------
+
+    static void RunWorldUpdates( Benchmark::State& state, uint32_t numWorlds, bool isParallel )
+    {
+        TaskSystem taskSystem;
+        taskSystem.Initialize();
+
+        {
+            TVector<SimulatedWorld> worlds;
+            worlds.reserve( numWorlds );
+            for ( uint32_t w = 0; w < numWorlds; w++ )
+            {
+                worlds.emplace_back( &taskSystem, w );
+            }
+
+            state.StartTimer();
+            for ( uint32_t i = 0; i < state.GetNumIterations(); i++ )
+            {
+                if ( isParallel )
+                {
+                    WorldUpdateTask worldUpdateTask( worlds );
+                    taskSystem.ScheduleTask( &worldUpdateTask );
+                    taskSystem.WaitForTask( &worldUpdateTask );
+                }
+                else
+                {
+                    for ( auto& world : worlds )
+                    {
+                        world.Update();
+                    }
+                }
+
+                Benchmark::ClobberMemory();
+            }
+            state.StopTimer();
+
+            for ( auto const& world : worlds )
+            {
+                Benchmark::DoNotOptimize( world.m_bounds );
+            }
+        }
+
+        taskSystem.Shutdown();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+KRG_BENCHMARK( Worlds, Serial_1World ) { RunWorldUpdates( state, 1, false ); }
+KRG_BENCHMARK( Worlds, Parallel_1World ) { RunWorldUpdates( state, 1, true ); }
+KRG_BENCHMARK( Worlds, Serial_2Worlds ) { RunWorldUpdates( state, 2, false ); }
+KRG_BENCHMARK( Worlds, Parallel_2Worlds ) { RunWorldUpdates( state, 2, true ); }
+KRG_BENCHMARK( Worlds, Serial_4Worlds ) { RunWorldUpdates( state, 4, false ); }
+KRG_BENCHMARK( Worlds, Parallel_4Worlds ) { RunWorldUpdates( state, 4, true ); }
+KRG_BENCHMARK( Worlds, Serial_8Worlds ) { RunWorldUpdates( state, 8, false ); }
+KRG_BENCHMARK( Worlds, Parallel_8Worlds ) { RunWorldUpdates( state, 8, true ); }
\ No newline at end of file
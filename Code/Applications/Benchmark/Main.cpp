@@ -0,0 +1,84 @@
+#include "Applications/Benchmark/Benchmark.h"
+#include "Applications/Shared/ApplicationGlobalState.h"
+#include "Applications/Shared/cmdParser/krg_cmdParser.h"
+
+//-------------------------------------------------------------------------
+
+using namespace KRG;
+
+//-------------------------------------------------------------------------
+// Command Line Argument Parsing
+//-------------------------------------------------------------------------
+
+namespace KRG
+{
+    struct CommandLineArgumentParser
+    {
+        CommandLineArgumentParser( int argc, char* argv[] )
+        {
+            Benchmark::Runner::Settings const defaultSettings;
+
+            cli::Parser cmdParser( argc, argv );
+            cmdParser.set_optional<std::string>( "filter", "filter", "", "Only run the benchmarks whose name (Category.Name) contains this string." );
+            cmdParser.set_optional<std::string>( "json", "json", "", "Write the results to this file in json format." );
+            cmdParser.set_optional<unsigned int>( "samples", "samples", defaultSettings.m_numSamples, "The number of timed samples per benchmark." );
+            cmdParser.set_optional<float>( "mintime", "mintime", defaultSettings.m_minSampleTimeMs, "The minimum duration of a single sample in milliseconds." );
+
+            if ( cmdParser.run() )
+            {
+                m_settings.m_filter = cmdParser.get<std::string>( "filter" ).c_str();
+                m_settings.m_numSamples = cmdParser.get<unsigned int>( "samples" );
+                m_settings.m_minSampleTimeMs = cmdParser.get<float>( "mintime" );
+                m_jsonOutputPath = cmdParser.get<std::string>( "json" ).c_str();
+                m_isValid = m_settings.m_numSamples > 0 && m_settings.m_minSampleTimeMs > 0.0f;
+            }
+        }
+
+        bool IsValid() const { return m_isValid; }
+
+    public:
+
+        Benchmark::Runner::Settings         m_settings;
+        String                              m_jsonOutputPath;
+        bool                                m_isValid = false;
+    };
+}
+
+//-------------------------------------------------------------------------
+
+int main( int argc, char* argv[] )
+{
+    KRG::ApplicationGlobalState State;
+
+    CommandLineArgumentParser argParser( argc, argv );
+    if ( !argParser.IsValid() )
+    {
+        return 1;
+    }
+
+    //-------------------------------------------------------------------------
+
+    Benchmark::Runner runner( argParser.m_settings );
+    runner.RunAll();
+
+    if ( runner.GetResults().empty() )
+    {
+        printf( "No benchmarks matched the filter: %s\n", argParser.m_settings.m_filter.c_str() );
+        return 1;
+    }
+
+    runner.PrintResults();
+
+    if ( !argParser.m_jsonOutputPath.empty() )
+    {
+        if ( !runner.WriteResultsToJson( argParser.m_jsonOutputPath.c_str() ) )
+        {
+            printf( "Failed to write results to: %s\n", argParser.m_jsonOutputPath.c_str() );
+            return 1;
+        }
+
+        printf( "\nResults written to: %s\n", argParser.m_jsonOutputPath.c_str() );
+    }
+
+    return 0;
+}
@@ -10,6 +10,7 @@
 #include "Engine/UpdateContext.h"
 #include "System/Resource/ResourceSettings.h"
 #include "System/Resource/ResourceSystem.h"
+#include "System/Threading/TaskSystem.h"
 #include "System/ThirdParty/iniparser/krg_ini.h"
 
 //-------------------------------------------------------------------------
@@ -25,6 +26,7 @@ namespace KRG
     {
         m_pTypeRegistry = context.GetSystem<TypeSystem::TypeRegistry>();
         m_pResourceSystem = context.GetSystem<Resource::ResourceSystem>();
+        m_pTaskSystem = context.GetSystem<TaskSystem>();
         m_pWorldManager = context.GetSystem<EntityWorldManager>();
         m_pRenderingSystem = context.GetSystem<Render::RenderingSystem>();
 
@@ -70,6 +72,7 @@ namespace KRG
         m_pWorldManager = nullptr;
         m_pRenderingSystem = nullptr;
         m_pResourceSystem = nullptr;
+        m_pTaskSystem = nullptr;
         m_pTypeRegistry = nullptr;
         m_pResourceDatabase = nullptr;
 
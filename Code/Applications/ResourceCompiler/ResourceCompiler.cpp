@@ -1,9 +1,11 @@
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "EngineTools/Resource/ResourceCompilerRegistry.h"
+#include "EngineTools/Resource/ResourceCompiler.h"
 #include "Applications/Shared/ApplicationGlobalState.h"
 #include "Applications/Shared/cmdParser/krg_cmdparser.h"
 #include "System/Resource/ResourceSettings.h"
 #include "System/FileSystem/FileSystemUtils.h"
+#include "System/Threading/TaskSystem.h"
 #include "System/ThirdParty/iniparser/krg_ini.h"
 #include "System/Log.h"
 
@@ -29,11 +31,20 @@ namespace KRG
             cmdParser.set_optional<std::string>( "compile", "compile", "", "Compile resource" );
             cmdParser.set_optional<bool>( "debug", "debug", false, "Trigger debug break before execution." );
             cmdParser.set_optional<bool>( "package", "package", false, "Compile resource for packaged build." );
+            cmdParser.set_optional<bool>( "worker", "worker", false, "Run as a persistent worker, compile requests are read from stdin." );
 
             if ( cmdParser.run() )
             {
                 m_triggerDebugBreak = cmdParser.get<bool>( "debug" );
                 m_isForPackagedBuild = cmdParser.get<bool>( "package" );
+                m_isWorker = cmdParser.get<bool>( "worker" );
+
+                // Workers receive their requests once started
+                if ( m_isWorker )
+                {
+                    m_isValid = true;
+                    return;
+                }
 
                 // Get compile argument
                 ResourcePath const resourcePath( cmdParser.get<std::string>( "compile" ).c_str() );
@@ -62,6 +73,7 @@ namespace KRG
         ResourceID          m_resourceID;
         bool                m_triggerDebugBreak = false;
         bool                m_isForPackagedBuild = false;
+        bool                m_isWorker = false;
         bool                m_isValid = false;
     };
 }
@@ -82,6 +94,7 @@ int main( int argc, char* argv[] )
     if ( !iniFile.IsValid() )
     {
         KRG_LOG_ERROR( "ResourceCompiler", "Failed to read INI file: %s", iniFilePath.c_str() );
+        Log::Flush();
         return 1;
     }
 
@@ -89,6 +102,7 @@ int main( int argc, char* argv[] )
     if ( !settings.ReadSettings( iniFile ) )
     {
         KRG_LOG_ERROR( "ResourceCompiler", "Failed to read settings from INI file: %s", iniFilePath.c_str() );
+        Log::Flush();
         return false;
     }
 
@@ -105,19 +119,14 @@ int main( int argc, char* argv[] )
     if ( !argParser.IsValid() )
     {
         KRG_LOG_ERROR( "ResourceCompiler", "Invalid command line arguments" );
+        Log::Flush();
         return 1;
     }
 
     // File Paths
     //-------------------------------------------------------------------------
 
-    if ( argParser.m_isForPackagedBuild )
-    {
-        settings.m_compiledResourcePath = settings.m_packagedBuildCompiledResourcePath;
-    }
-
     settings.m_rawResourcePath.EnsureDirectoryExists();
-    settings.m_compiledResourcePath.EnsureDirectoryExists();
 
     // Create tools modules and register compilers
     //-------------------------------------------------------------------------
@@ -125,7 +134,9 @@ int main( int argc, char* argv[] )
     TypeSystem::TypeRegistry typeRegistry;
     AutoGenerated::Tools::RegisterTypes( typeRegistry );
 
-    Resource::CompilerRegistry compilerRegistry( typeRegistry, settings.m_rawResourcePath );
+    // Some compilers split their work across the task system (e.g. reading large entity maps), it is only created if one of them needs it
+    Resource::CompilerTaskSystem taskSystem( argParser.m_isWorker ? Resource::CompilerWorker::s_maxTaskSystemWorkers : UINT32_MAX );
+    Resource::CompilerRegistry compilerRegistry( typeRegistry, settings.m_rawResourcePath, &taskSystem );
 
 
     // Execute compilation command
@@ -137,10 +148,13 @@ int main( int argc, char* argv[] )
         KRG_HALT();
     }
 
-    auto CompileResource = [&] ()
+    auto CompileResource = [&] ( ResourceID const& resourceID, bool isForPackagedBuild )
     {
+        FileSystem::Path const& compiledResourcePath = isForPackagedBuild ? settings.m_packagedBuildCompiledResourcePath : settings.m_compiledResourcePath;
+        compiledResourcePath.EnsureDirectoryExists();
+
         // Try create compilation context
-        Resource::CompileContext compileContext( settings.m_rawResourcePath, settings.m_compiledResourcePath, argParser.m_resourceID, argParser.m_isForPackagedBuild );
+        Resource::CompileContext compileContext( settings.m_rawResourcePath, compiledResourcePath, resourceID, isForPackagedBuild );
         if ( !compileContext.IsValid() )
         {
             return -1;
@@ -166,12 +180,68 @@ int main( int argc, char* argv[] )
         return (int32_t) result;
     };
 
-    int32_t const result = CompileResource();
+    int32_t result = 0;
+
+    if ( argParser.m_isWorker )
+    {
+        // Keep processing requests until the resource server closes our input stream
+        size_t const compileCommandLength = strlen( Resource::CompilerWorker::s_compileCommand );
+        size_t const packageCommandLength = strlen( Resource::CompilerWorker::s_packageCommand );
+
+        char requestBuffer[1024];
+        while ( fgets( requestBuffer, 1024, stdin ) != nullptr )
+        {
+            String request( requestBuffer );
+            request.trim();
+            if ( request.empty() )
+            {
+                continue;
+            }
+
+            int32_t requestResult = (int32_t) Resource::CompilationResult::Failure;
+
+            bool isForPackagedBuild = false;
+            char const* pResourcePath = nullptr;
+            if ( request.find( Resource::CompilerWorker::s_compileCommand ) == 0 )
+            {
+                pResourcePath = request.c_str() + compileCommandLength;
+            }
+            else if ( request.find( Resource::CompilerWorker::s_packageCommand ) == 0 )
+            {
+                pResourcePath = request.c_str() + packageCommandLength;
+                isForPackagedBuild = true;
+            }
+
+            String resourcePath( pResourcePath != nullptr ? pResourcePath : "" );
+            resourcePath.trim();
+
+            ResourceID const resourceID( resourcePath );
+            if ( resourceID.IsValid() )
+            {
+                requestResult = CompileResource( resourceID, isForPackagedBuild );
+            }
+            else
+            {
+                KRG_LOG_ERROR( "ResourceCompiler", "Invalid worker request: %s", request.c_str() );
+            }
+
+            // All of this request's log output needs to be written before the result marker so the server attributes it to this request
+            // The result marker always starts on a new line so the server can find it
+            Log::Flush();
+            printf( "\n%s %d\n", Resource::CompilerWorker::s_resultMarker, requestResult );
+            fflush( stdout );
+        }
+    }
+    else
+    {
+        result = CompileResource( argParser.m_resourceID, argParser.m_isForPackagedBuild );
+    }
 
     // Unregister all types
     //-------------------------------------------------------------------------
 
     AutoGenerated::Tools::UnregisterTypes( typeRegistry );
 
+    Log::Flush();
     return result;
 }
\ No newline at end of file
@@ -17,6 +17,15 @@ namespace KRG
                 return false;
             }
 
+            // Discard any databases created with an older layout, everything will simply be recompiled
+            if ( GetDatabaseVersion() != s_databaseVersion )
+            {
+                if ( !DropTables() )
+                {
+                    return false;
+                }
+            }
+
             if ( !CreateTables() )
             {
                 return false;
@@ -48,7 +57,22 @@ namespace KRG
         {
             KRG_ASSERT( m_pDatabase != nullptr );
 
-            if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `CompiledResources` ( `ResourcePath` TEXT UNIQUE,`ResourceType` INTEGER,`CompilerVersion` INTEGER,`FileTimestamp` INTEGER, `SourceTimestampHash` INTEGER, PRIMARY KEY( ResourcePath, ResourceType ) );" ) )
+            if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `CompiledResources` ( `ResourcePath` TEXT UNIQUE,`ResourceType` INTEGER,`CompilerVersion` INTEGER,`FileHash` INTEGER, `SourceHash` INTEGER, PRIMARY KEY( ResourcePath, ResourceType ) );" ) )
+            {
+                return false;
+            }
+
+            if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `CompileDependencies` ( `ResourcePath` TEXT,`DependencyPath` TEXT, PRIMARY KEY( ResourcePath, DependencyPath ) );" ) )
+            {
+                return false;
+            }
+
+            if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `FileHashes` ( `FilePath` TEXT UNIQUE,`ModifiedTime` INTEGER,`ContentHash` INTEGER, PRIMARY KEY( FilePath ) );" ) )
+            {
+                return false;
+            }
+
+            if ( !ExecuteSimpleQuery( "PRAGMA user_version = %d;", s_databaseVersion ) )
             {
                 return false;
             }
@@ -59,16 +83,45 @@ namespace KRG
         bool CompiledResourceDatabase::DropTables()
         {
             KRG_ASSERT( m_pDatabase != nullptr );
-            char* pErrorMessage = nullptr;
 
             if ( !ExecuteSimpleQuery( "DROP TABLE IF EXISTS `CompiledResources`;" ) )
             {
                 return false;
             }
 
+            if ( !ExecuteSimpleQuery( "DROP TABLE IF EXISTS `CompileDependencies`;" ) )
+            {
+                return false;
+            }
+
+            if ( !ExecuteSimpleQuery( "DROP TABLE IF EXISTS `FileHashes`;" ) )
+            {
+                return false;
+            }
+
             return true;
         }
 
+        int32_t CompiledResourceDatabase::GetDatabaseVersion() const
+        {
+            KRG_ASSERT( m_pDatabase != nullptr );
+
+            int32_t version = 0;
+
+            sqlite3_stmt* pStatement = nullptr;
+            if ( IsValidSQLiteResult( sqlite3_prepare_v2( m_pDatabase, "PRAGMA user_version;", -1, &pStatement, nullptr ) ) )
+            {
+                if ( sqlite3_step( pStatement ) == SQLITE_ROW )
+                {
+                    version = sqlite3_column_int( pStatement, 0 );
+                }
+
+                IsValidSQLiteResult( sqlite3_finalize( pStatement ) );
+            }
+
+            return version;
+        }
+
         //-------------------------------------------------------------------------
 
         CompiledResourceRecord CompiledResourceDatabase::GetRecord( ResourceID resourceID ) const
@@ -88,19 +141,108 @@ namespace KRG
                     record.m_resourceID = ResourceID( resourcePath );
 
                     record.m_compilerVersion = sqlite3_column_int( pStatement, 2 );
-                    record.m_fileTimestamp = sqlite3_column_int64( pStatement, 3 );
-                    record.m_sourceTimestampHash = sqlite3_column_int64( pStatement, 4 );
+                    record.m_fileHash = sqlite3_column_int64( pStatement, 3 );
+                    record.m_sourceHash = sqlite3_column_int64( pStatement, 4 );
                 }
 
                 IsValidSQLiteResult( sqlite3_finalize( pStatement ) );
             }
 
+            // Read compile dependencies
+            //-------------------------------------------------------------------------
+
+            if ( record.IsValid() )
+            {
+                pStatement = nullptr;
+                FillStatementBuffer( "SELECT `DependencyPath` FROM `CompileDependencies` WHERE `ResourcePath` = \"%s\" ORDER BY rowid;", resourceID.GetResourcePath().c_str() );
+                if ( IsValidSQLiteResult( sqlite3_prepare_v2( m_pDatabase, m_statementBuffer, -1, &pStatement, nullptr ) ) )
+                {
+                    while ( sqlite3_step( pStatement ) == SQLITE_ROW )
+                    {
+                        record.m_compileDependencies.emplace_back( ResourcePath( (char const*) sqlite3_column_text( pStatement, 0 ) ) );
+                    }
+
+                    IsValidSQLiteResult( sqlite3_finalize( pStatement ) );
+                }
+            }
+
             return record;
         }
 
         bool CompiledResourceDatabase::WriteRecord( CompiledResourceRecord const& record )
         {
-            return ExecuteSimpleQuery( "INSERT OR REPLACE INTO `CompiledResources` ( `ResourcePath`, `ResourceType`, `CompilerVersion`, `FileTimestamp`, `SourceTimestampHash` ) VALUES ( \"%s\", %d, %d, %llu, %llu );", record.m_resourceID.GetResourcePath().c_str(), (uint32_t) record.m_resourceID.GetResourceTypeID(), record.m_compilerVersion, record.m_fileTimestamp, record.m_sourceTimestampHash  );
+            KRG_ASSERT( record.IsValid() );
+
+            char const* pResourcePath = record.m_resourceID.GetResourcePath().c_str();
+
+            if ( !BeginTransaction() )
+            {
+                return false;
+            }
+
+            bool result = ExecuteSimpleQuery( "INSERT OR REPLACE INTO `CompiledResources` ( `ResourcePath`, `ResourceType`, `CompilerVersion`, `FileHash`, `SourceHash` ) VALUES ( \"%s\", %d, %d, %lld, %lld );", pResourcePath, (uint32_t) record.m_resourceID.GetResourceTypeID(), record.m_compilerVersion, (int64_t) record.m_fileHash, (int64_t) record.m_sourceHash );
+            result = result && ExecuteSimpleQuery( "DELETE FROM `CompileDependencies` WHERE `ResourcePath` = \"%s\";", pResourcePath );
+
+            for ( auto const& compileDep : record.m_compileDependencies )
+            {
+                if ( !result )
+                {
+                    break;
+                }
+
+                result = ExecuteSimpleQuery( "INSERT OR IGNORE INTO `CompileDependencies` ( `ResourcePath`, `DependencyPath` ) VALUES ( \"%s\", \"%s\" );", pResourcePath, compileDep.c_str() );
+            }
+
+            return EndTransaction() && result;
+        }
+
+        //-------------------------------------------------------------------------
+
+        FileHashRecord CompiledResourceDatabase::GetFileHashRecord( FileSystem::Path const& filePath ) const
+        {
+            FileHashRecord record;
+
+            sqlite3_stmt* pStatement = nullptr;
+            FillStatementBuffer( "SELECT `ModifiedTime`, `ContentHash` FROM `FileHashes` WHERE `FilePath` = \"%s\";", filePath.c_str() );
+            if ( IsValidSQLiteResult( sqlite3_prepare_v2( m_pDatabase, m_statementBuffer, -1, &pStatement, nullptr ) ) )
+            {
+                if ( sqlite3_step( pStatement ) == SQLITE_ROW )
+                {
+                    record.m_modifiedTime = sqlite3_column_int64( pStatement, 0 );
+                    record.m_contentHash = sqlite3_column_int64( pStatement, 1 );
+                }
+
+                IsValidSQLiteResult( sqlite3_finalize( pStatement ) );
+            }
+
+            return record;
+        }
+
+        bool CompiledResourceDatabase::WriteFileHashRecords( TVector<TPair<FileSystem::Path, FileHashRecord>> const& records )
+        {
+            if ( records.empty() )
+            {
+                return true;
+            }
+
+            // Write all records in a single transaction, sqlite commits (and syncs) every statement outside of one
+            if ( !BeginTransaction() )
+            {
+                return false;
+            }
+
+            bool result = true;
+            for ( auto const& record : records )
+            {
+                KRG_ASSERT( record.second.IsValid() );
+                result = ExecuteSimpleQuery( "INSERT OR REPLACE INTO `FileHashes` ( `FilePath`, `ModifiedTime`, `ContentHash` ) VALUES ( \"%s\", %lld, %lld );", record.first.c_str(), (int64_t) record.second.m_modifiedTime, (int64_t) record.second.m_contentHash );
+                if ( !result )
+                {
+                    break;
+                }
+            }
+
+            return EndTransaction() && result;
         }
     }
 }
\ No newline at end of file
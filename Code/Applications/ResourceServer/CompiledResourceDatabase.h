@@ -2,7 +2,8 @@
 
 #include "EngineTools/ThirdParty/sqlite/SqliteHelpers.h"
 #include "System/Resource/ResourceID.h"
-#include "System/FileSystem/FileSystemPath.h"
+#include "System/FileSystem/FileSystemPath.h"
+#include "System/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -14,16 +15,32 @@ namespace KRG
         {
             inline bool IsValid() const { return m_resourceID.IsValid(); }
 
-            ResourceID          m_resourceID;
-            int32_t               m_compilerVersion = -1;         // The compiler version used for the last compilation
-            uint64_t              m_fileTimestamp = 0;            // The timestamp of the resource file
-            uint64_t              m_sourceTimestampHash = 0;      // The timestamp hash of any source assets used in the compilation
+            ResourceID              m_resourceID;
+            int32_t                 m_compilerVersion = -1;         // The compiler version used for the last compilation
+            uint64_t                m_fileHash = 0;                 // The content hash of the resource file
+            uint64_t                m_sourceHash = 0;               // The combined content hash of any source assets used in the compilation
+            TVector<ResourcePath>   m_compileDependencies;          // The compile dependencies read from the resource file when it had the above hash
+        };
+
+        //-------------------------------------------------------------------------
+        // Content hashes are cached per file and only recalculated when the file's modified time changes
+        // This means that touching a file (or a source control sync) without changing its contents will not trigger a recompile
+
+        struct FileHashRecord final
+        {
+            inline bool IsValid() const { return m_modifiedTime != 0; }
+
+            uint64_t                m_modifiedTime = 0;
+            uint64_t                m_contentHash = 0;
         };
 
         //-------------------------------------------------------------------------
 
         class CompiledResourceDatabase final : public SQLite::SQLiteDatabase
         {
+            // Bump this whenever the table layout or the binary serialization format changes, old databases will be dropped and recreated (forcing a full recompile)
+            constexpr static int32_t const s_databaseVersion = 2;
+
         public:
 
             bool TryConnect( FileSystem::Path const& databasePath );
@@ -34,10 +51,14 @@ namespace KRG
             CompiledResourceRecord GetRecord( ResourceID resourceID ) const;
             bool WriteRecord( CompiledResourceRecord const& record );
 
+            FileHashRecord GetFileHashRecord( FileSystem::Path const& filePath ) const;
+            bool WriteFileHashRecords( TVector<TPair<FileSystem::Path, FileHashRecord>> const& records );
+
         private:
 
             bool CreateTables();
             bool DropTables();
+            int32_t GetDatabaseVersion() const;
         };
     }
 }
\ No newline at end of file
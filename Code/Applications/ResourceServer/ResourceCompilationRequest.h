@@ -90,8 +90,9 @@ namespace KRG::Resource
         uint32_t                            m_clientID = 0;
         ResourceID                          m_resourceID;
         int32_t                             m_compilerVersion = -1;
-        uint64_t                            m_fileTimestamp = 0;
-        uint64_t                            m_sourceTimestampHash = 0;
+        uint64_t                            m_fileHash = 0;
+        uint64_t                            m_sourceHash = 0;
+        TVector<ResourcePath>               m_compileDependencies;
         FileSystem::Path                    m_sourceFile;
         FileSystem::Path                    m_destinationFile;
         String                              m_compilerArgs;
@@ -7,6 +7,8 @@
 #include "System/ThirdParty/iniparser/krg_ini.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/FileSystem/FileSystemUtils.h"
+#include "System/Algorithm/Hash.h"
+#include "System/Log.h"
 
 #include <sstream>
 
@@ -104,6 +106,8 @@ namespace KRG::Resource
 
         m_taskSystem.Shutdown();
 
+        FlushFileHashRecords();
+
         // Unregister File Watcher
         //-------------------------------------------------------------------------
 
@@ -144,6 +148,13 @@ namespace KRG::Resource
 
     void ResourceServer::Update()
     {
+        // Write all hashes calculated since the last update in a single transaction
+        FlushFileHashRecords();
+
+        // Files can change between updates so we cannot reuse any previous up-to-date results
+        m_upToDateCache.clear();
+        m_fileHashCache.clear();
+
         // Update network server
         //-------------------------------------------------------------------------
 
@@ -299,6 +310,9 @@ namespace KRG::Resource
             return;
         }
 
+        m_fileHashCache.erase( filePath );
+        m_upToDateCache.clear();
+
         // Check compiled resources database for a record for this file
         auto compiledResourceRecord = m_compiledResourceDatabase.GetRecord( resourceID );
         if ( !compiledResourceRecord.IsValid() )
@@ -406,13 +420,12 @@ namespace KRG::Resource
                 }
 
                 // Check compile dependencies
-                TVector<ResourcePath> compileDependencies;
                 if ( pRequest->m_status != CompilationRequest::Status::Failed && sourceFileExists )
                 {
                     // Try to read all the resource compile dependencies for non-map resources
                     if ( pRequest->GetResourceID().GetResourceTypeID() != ResourceTypeID( "map" ) )
                     {
-                        if ( !TryReadCompileDependencies( pRequest->m_sourceFile, compileDependencies, &pRequest->m_log ) )
+                        if ( !TryReadCompileDependencies( pRequest->m_sourceFile, pRequest->m_compileDependencies, &pRequest->m_log ) )
                         {
                             pRequest->m_log += "Error: failed to read compile dependencies!";
                             pRequest->m_status = CompilationRequest::Status::Failed;
@@ -424,7 +437,7 @@ namespace KRG::Resource
                 bool const forceRecompile = ( origin == CompilationRequest::Origin::ManualCompile );
                 if ( pRequest->m_status != CompilationRequest::Status::Failed && !forceRecompile )
                 {
-                    PerformResourceUpToDateCheck( pRequest, compileDependencies );
+                    PerformResourceUpToDateCheck( pRequest );
                 }
             }
         }
@@ -495,7 +508,7 @@ namespace KRG::Resource
 
     //-------------------------------------------------------------------------
 
-    void ResourceServer::PerformResourceUpToDateCheck( CompilationRequest* pRequest, TVector<ResourcePath> const& compileDependencies ) const
+    void ResourceServer::PerformResourceUpToDateCheck( CompilationRequest* pRequest )
     {
         KRG_ASSERT( pRequest != nullptr && pRequest->IsPending() );
 
@@ -507,35 +520,10 @@ namespace KRG::Resource
         pRequest->m_compilerVersion = m_pCompilerRegistry->GetVersionForType( pRequest->m_resourceID.GetResourceTypeID() );
         KRG_ASSERT( pRequest->m_compilerVersion >= 0 );
 
-        pRequest->m_fileTimestamp = FileSystem::GetFileModifiedTime( pRequest->m_sourceFile );
-
-        bool areCompileDependenciesAreUpToDate = true;
-        for ( auto const& compileDep : compileDependencies )
-        {
-            KRG_ASSERT( compileDep.IsValid() );
-
-            ResourceTypeID const extension( compileDep.GetExtension() );
-            if ( IsCompileableResourceType( extension ) && !IsResourceUpToDate( ResourceID( compileDep ) ) )
-            {
-                areCompileDependenciesAreUpToDate = false;
-                break;
-            }
-
-            auto const compileDependencyPath = ResourcePath::ToFileSystemPath( m_settings.m_rawResourcePath, compileDep );
-            if ( !FileSystem::Exists( compileDependencyPath ) )
-            {
-                areCompileDependenciesAreUpToDate = false;
-                break;
-            }
-
-            pRequest->m_sourceTimestampHash += FileSystem::GetFileModifiedTime( compileDependencyPath );
-        }
-
-        // Check source file for changes
-        //-------------------------------------------------------------------------
+        pRequest->m_fileHash = GetFileContentHash( pRequest->m_sourceFile );
 
         // Check compile dependency state
-        bool isResourceUpToDate = areCompileDependenciesAreUpToDate;
+        bool isResourceUpToDate = CalculateSourceHash( pRequest->m_compileDependencies, pRequest->m_sourceHash );
 
         // Check against previous compilation result
         if ( isResourceUpToDate )
@@ -548,12 +536,12 @@ namespace KRG::Resource
                     isResourceUpToDate = false;
                 }
 
-                if ( pRequest->m_fileTimestamp != existingRecord.m_fileTimestamp )
+                if ( pRequest->m_fileHash != existingRecord.m_fileHash )
                 {
                     isResourceUpToDate = false;
                 }
 
-                if ( pRequest->m_sourceTimestampHash != existingRecord.m_sourceTimestampHash )
+                if ( pRequest->m_sourceHash != existingRecord.m_sourceHash )
                 {
                     isResourceUpToDate = false;
                 }
@@ -625,76 +613,156 @@ namespace KRG::Resource
         return true;
     }
 
-    bool ResourceServer::IsResourceUpToDate( ResourceID const& resourceID ) const
+    bool ResourceServer::IsResourceUpToDate( ResourceID const& resourceID )
     {
+        auto cachedResultIter = m_upToDateCache.find( resourceID );
+        if ( cachedResultIter != m_upToDateCache.end() )
+        {
+            return cachedResultIter->second;
+        }
+
+        // Mark the resource as out of date while we check it, this ensures that cyclic dependencies terminate
+        m_upToDateCache[resourceID] = false;
+
         // Check that the target file exists
         //-------------------------------------------------------------------------
 
-        if ( !FileSystem::Exists( ResourcePath::ToFileSystemPath( m_settings.m_compiledResourcePath, resourceID.GetResourcePath() ) ) )
+        bool isUpToDate = FileSystem::Exists( ResourcePath::ToFileSystemPath( m_settings.m_compiledResourcePath, resourceID.GetResourcePath() ) );
+
+        // Check against previous compilation result
+        //-------------------------------------------------------------------------
+
+        CompiledResourceRecord existingRecord;
+        if ( isUpToDate )
         {
-            return false;
+            existingRecord = m_compiledResourceDatabase.GetRecord( resourceID );
+            if ( existingRecord.IsValid() )
+            {
+                int32_t const compilerVersion = m_pCompilerRegistry->GetVersionForType( resourceID.GetResourceTypeID() );
+                KRG_ASSERT( compilerVersion >= 0 );
+                isUpToDate = ( compilerVersion == existingRecord.m_compilerVersion );
+            }
+            else
+            {
+                isUpToDate = false;
+            }
         }
 
-        // Check compile dependencies
+        // Check resource file for changes (a missing file will have a zero hash)
         //-------------------------------------------------------------------------
 
-        int32_t const compilerVersion = m_pCompilerRegistry->GetVersionForType( resourceID.GetResourceTypeID() );
-        KRG_ASSERT( compilerVersion >= 0 );
-
-        FileSystem::Path const sourceFilePath = ResourcePath::ToFileSystemPath( m_settings.m_rawResourcePath, resourceID.GetResourcePath() );
-        if ( !FileSystem::Exists( sourceFilePath ) )
+        if ( isUpToDate )
         {
-            return false;
+            FileSystem::Path const sourceFilePath = ResourcePath::ToFileSystemPath( m_settings.m_rawResourcePath, resourceID.GetResourcePath() );
+            isUpToDate = ( GetFileContentHash( sourceFilePath ) == existingRecord.m_fileHash );
         }
 
-        uint64_t const fileTimestamp = FileSystem::GetFileModifiedTime( sourceFilePath );
-        uint64_t sourceTimestampHash = 0;
+        // Check compile dependencies
+        //-------------------------------------------------------------------------
+        // The resource file is unchanged so the recorded dependency list is still valid, no need to parse the descriptor again
 
-        TVector<ResourcePath> compileDependencies;
-        if ( !TryReadCompileDependencies( sourceFilePath, compileDependencies ) )
+        if ( isUpToDate )
         {
-            return false;
+            uint64_t sourceHash = 0;
+            isUpToDate = CalculateSourceHash( existingRecord.m_compileDependencies, sourceHash ) && ( sourceHash == existingRecord.m_sourceHash );
         }
 
-        for ( auto const& compileDep : compileDependencies )
-        {
-            sourceTimestampHash += FileSystem::GetFileModifiedTime( ResourcePath::ToFileSystemPath( m_settings.m_rawResourcePath, compileDep ) );
+        //-------------------------------------------------------------------------
 
-            ResourceTypeID const extension( compileDep.GetExtension() );
-            if ( IsCompileableResourceType( extension ) && !IsResourceUpToDate( ResourceID( compileDep ) ) )
-            {
-                return false;
-            }
+        m_upToDateCache[resourceID] = isUpToDate;
+        return isUpToDate;
+    }
+
+    uint64_t ResourceServer::GetFileContentHash( FileSystem::Path const& filePath )
+    {
+        KRG_ASSERT( filePath.IsValid() );
+
+        auto cachedHashIter = m_fileHashCache.find( filePath );
+        if ( cachedHashIter != m_fileHashCache.end() )
+        {
+            return cachedHashIter->second;
         }
 
-        // Check source file for changes
         //-------------------------------------------------------------------------
 
-        // Check against previous compilation result
-        auto existingRecord = m_compiledResourceDatabase.GetRecord( resourceID );
-        if ( existingRecord.IsValid() )
+        uint64_t contentHash = 0;
+        if ( FileSystem::Exists( filePath ) )
         {
-            if ( compilerVersion != existingRecord.m_compilerVersion )
+            // Only rehash the file contents if the file was modified since we last hashed it
+            uint64_t const modifiedTime = FileSystem::GetFileModifiedTime( filePath );
+            FileHashRecord hashRecord = m_compiledResourceDatabase.GetFileHashRecord( filePath );
+            if ( hashRecord.IsValid() && hashRecord.m_modifiedTime == modifiedTime )
             {
-                return false;
+                contentHash = hashRecord.m_contentHash;
             }
+            else
+            {
+                Blob fileData;
+                if ( FileSystem::LoadFile( filePath, fileData ) )
+                {
+                    contentHash = Hash::XXHash::GetHash64( fileData );
+
+                    if ( modifiedTime != 0 )
+                    {
+                        hashRecord.m_modifiedTime = modifiedTime;
+                        hashRecord.m_contentHash = contentHash;
+                        m_pendingFileHashRecords.emplace_back( filePath, hashRecord );
+                    }
+                }
+            }
+        }
+
+        m_fileHashCache[filePath] = contentHash;
+        return contentHash;
+    }
+
+    void ResourceServer::FlushFileHashRecords()
+    {
+        if ( m_pendingFileHashRecords.empty() )
+        {
+            return;
+        }
+
+        if ( !m_compiledResourceDatabase.WriteFileHashRecords( m_pendingFileHashRecords ) )
+        {
+            KRG_LOG_ERROR( "Resource", "Failed to write file hashes to the compiled resource database: %s", m_compiledResourceDatabase.GetError().c_str() );
+        }
+
+        m_pendingFileHashRecords.clear();
+    }
+
+    bool ResourceServer::CalculateSourceHash( TVector<ResourcePath> const& compileDependencies, uint64_t& outSourceHash )
+    {
+        outSourceHash = 0;
 
-            if ( fileTimestamp != existingRecord.m_fileTimestamp )
+        // We always hash all dependencies, even if we know we are out of date, since the hash is stored once the compilation completes
+        bool areCompileDependenciesUpToDate = true;
+        TInlineVector<uint64_t, 16> dependencyHashes;
+        for ( auto const& compileDep : compileDependencies )
+        {
+            KRG_ASSERT( compileDep.IsValid() );
+
+            ResourceTypeID const extension( compileDep.GetExtension() );
+            if ( IsCompileableResourceType( extension ) && !IsResourceUpToDate( ResourceID( compileDep ) ) )
             {
-                return false;
+                areCompileDependenciesUpToDate = false;
             }
 
-            if ( sourceTimestampHash != existingRecord.m_sourceTimestampHash )
+            uint64_t const dependencyHash = GetFileContentHash( ResourcePath::ToFileSystemPath( m_settings.m_rawResourcePath, compileDep ) );
+            if ( dependencyHash == 0 )
             {
-                return false;
+                areCompileDependenciesUpToDate = false;
             }
+
+            dependencyHashes.emplace_back( dependencyHash );
         }
-        else
+
+        if ( !dependencyHashes.empty() )
         {
-            return false;
+            outSourceHash = Hash::XXHash::GetHash64( dependencyHashes.data(), dependencyHashes.size() * sizeof( uint64_t ) );
         }
 
-        return true;
+        return areCompileDependenciesUpToDate;
     }
 
     void ResourceServer::WriteCompiledResourceRecord( CompilationRequest* pRequest )
@@ -702,9 +770,13 @@ namespace KRG::Resource
         CompiledResourceRecord record;
         record.m_resourceID = pRequest->m_resourceID;
         record.m_compilerVersion = pRequest->m_compilerVersion;
-        record.m_fileTimestamp = pRequest->m_fileTimestamp;
-        record.m_sourceTimestampHash = pRequest->m_sourceTimestampHash;
+        record.m_fileHash = pRequest->m_fileHash;
+        record.m_sourceHash = pRequest->m_sourceHash;
+        record.m_compileDependencies = pRequest->m_compileDependencies;
         m_compiledResourceDatabase.WriteRecord( record );
+
+        // Any memoized results that depend on this resource are now stale
+        m_upToDateCache.clear();
     }
 
     bool ResourceServer::IsCompileableResourceType( ResourceTypeID ID ) const
@@ -9,6 +9,7 @@
 #include "System/Resource/ResourceSettings.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include "System/Threading/TaskSystem.h"
+#include "System/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 // The network resource server
@@ -117,10 +118,19 @@ namespace KRG::Resource
         // Up-to-date system
         //-------------------------------------------------------------------------
 
-        void PerformResourceUpToDateCheck( CompilationRequest* pRequest, TVector<ResourcePath> const& compileDependencies ) const;
+        void PerformResourceUpToDateCheck( CompilationRequest* pRequest );
         bool TryReadCompileDependencies( FileSystem::Path const& resourceFilePath, TVector<ResourcePath>& outDependencies, String* pErrorLog = nullptr ) const;
-        bool IsResourceUpToDate( ResourceID const& resourceID ) const;
+        bool IsResourceUpToDate( ResourceID const& resourceID );
         void WriteCompiledResourceRecord( CompilationRequest* pRequest );
+
+        // Returns the content hash for a file, returns 0 if the file doesnt exist
+        uint64_t GetFileContentHash( FileSystem::Path const& filePath );
+
+        // Write all file hashes calculated since the last flush to the database
+        void FlushFileHashRecords();
+
+        // Calculates the combined content hash of all the supplied dependencies, returns false if any dependency is missing or out of date
+        bool CalculateSourceHash( TVector<ResourcePath> const& compileDependencies, uint64_t& outSourceHash );
         bool IsCompileableResourceType( ResourceTypeID ID ) const;
 
         // File system listener
@@ -151,6 +161,11 @@ namespace KRG::Resource
         TVector<CompilationRequest*>            m_pendingRequests;
         TVector<CompilationRequest*>            m_activeRequests;
 
+        // Up-to-date memoization - cleared each update since any file could have changed in between
+        THashMap<ResourceID, bool>              m_upToDateCache;
+        THashMap<FileSystem::Path, uint64_t>    m_fileHashCache;
+        TVector<TPair<FileSystem::Path, FileHashRecord>> m_pendingFileHashRecords;
+
         // Workers
         TaskSystem                              m_taskSystem;
         TVector<ResourceServerWorker*>          m_workers;
@@ -1,4 +1,5 @@
 #include "ResourceServerWorker.h"
+#include "EngineTools/Resource/ResourceCompiler.h"
 
 //-------------------------------------------------------------------------
 
@@ -17,9 +18,44 @@ namespace KRG::Resource
 
     ResourceServerWorker::~ResourceServerWorker()
     {
-        KRG_ASSERT( !subprocess_alive( &m_subProcess ) );
+        KRG_ASSERT( !IsCompiling() );
+        StopCompilerProcess();
+        KRG_ASSERT( !m_isCompilerProcessRunning );
     }
 
+    //-------------------------------------------------------------------------
+
+    bool ResourceServerWorker::TryStartCompilerProcess()
+    {
+        KRG_ASSERT( !m_isCompilerProcessRunning );
+
+        char const* processCommandLineArgs[3] = { m_workerFullPath.c_str(), "-worker", nullptr };
+        int32_t const result = subprocess_create( processCommandLineArgs, subprocess_option_combined_stdout_stderr | subprocess_option_inherit_environment | subprocess_option_no_window, &m_subProcess );
+        m_isCompilerProcessRunning = ( result == 0 );
+        return m_isCompilerProcessRunning;
+    }
+
+    void ResourceServerWorker::StopCompilerProcess( bool forceTerminate )
+    {
+        if ( !m_isCompilerProcessRunning )
+        {
+            return;
+        }
+
+        if ( forceTerminate )
+        {
+            subprocess_terminate( &m_subProcess );
+        }
+
+        // Joining closes the process input stream, which tells a healthy compiler process to exit
+        subprocess_join( &m_subProcess, nullptr );
+        subprocess_destroy( &m_subProcess );
+        Memory::MemsetZero( &m_subProcess );
+        m_isCompilerProcessRunning = false;
+    }
+
+    //-------------------------------------------------------------------------
+
     void ResourceServerWorker::Compile( CompilationRequest* pRequest )
     {
         KRG_ASSERT( IsIdle() );
@@ -30,87 +66,100 @@ namespace KRG::Resource
         m_pTaskSystem->ScheduleTask( this );
     }
 
+    void ResourceServerWorker::CompleteRequest( CompilationRequest::Status status, char const* pMessage )
+    {
+        KRG_ASSERT( IsCompiling() );
+
+        m_pRequest->m_status = status;
+        m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
+
+        if ( pMessage != nullptr )
+        {
+            m_pRequest->m_log += pMessage;
+        }
+
+        m_status = Status::Complete;
+    }
+
     void ResourceServerWorker::ExecuteRange( TaskSetPartition range, uint32_t threadnum )
     {
         KRG_ASSERT( IsCompiling() );
         KRG_ASSERT( !m_pRequest->m_compilerArgs.empty() );
-        char const* processCommandLineArgs[5] = { m_workerFullPath.c_str(), "-compile", m_pRequest->m_compilerArgs.c_str(), nullptr, nullptr };
 
-        // Set package flag for packing request
-        if ( m_pRequest->m_origin == CompilationRequest::Origin::Package )
+        m_pRequest->m_compilationTimeStarted = PlatformClock::GetTime();
+
+        // Start compiler process - only needed for the first request or if the previous process died
+        //-------------------------------------------------------------------------
+
+        if ( !m_isCompilerProcessRunning && !TryStartCompilerProcess() )
         {
-            processCommandLineArgs[3] = "-package";
+            CompleteRequest( CompilationRequest::Status::Failed, "Resource compiler failed to start!" );
+            return;
         }
 
-        // Start compiler process
+        // Send request
         //-------------------------------------------------------------------------
 
-        m_pRequest->m_compilationTimeStarted = PlatformClock::GetTime();
+        char const* pCommand = ( m_pRequest->m_origin == CompilationRequest::Origin::Package ) ? CompilerWorker::s_packageCommand : CompilerWorker::s_compileCommand;
 
-        int32_t result = subprocess_create( processCommandLineArgs, subprocess_option_combined_stdout_stderr | subprocess_option_inherit_environment | subprocess_option_no_window, &m_subProcess );
-        if ( result != 0 )
+        FILE* pProcessInput = subprocess_stdin( &m_subProcess );
+        if ( fprintf( pProcessInput, "%s %s\n", pCommand, m_pRequest->m_compilerArgs.c_str() ) < 0 || fflush( pProcessInput ) != 0 )
         {
-            m_pRequest->m_status = CompilationRequest::Status::Failed;
-            m_pRequest->m_log = "Resource compiler failed to start!";
-            m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
-            m_status = Status::Complete;
+            StopCompilerProcess( true );
+            CompleteRequest( CompilationRequest::Status::Failed, "Resource compiler failed to receive request!" );
             return;
         }
 
-        // Wait for compilation to complete
+        // Read compiler output until we get the result
         //-------------------------------------------------------------------------
 
-        int32_t exitCode;
-        result = subprocess_join( &m_subProcess, &exitCode );
-        if ( result != 0 )
+        size_t const resultMarkerLength = strlen( CompilerWorker::s_resultMarker );
+        bool resultReceived = false;
+        int32_t compilationResult = (int32_t) CompilationResult::Failure;
+
+        char readBuffer[512];
+        while ( fgets( readBuffer, 512, subprocess_stdout( &m_subProcess ) ) )
         {
-            m_pRequest->m_status = CompilationRequest::Status::Failed;
-            m_pRequest->m_log = "Resource compiler failed to complete!";
-            m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
-            m_status = Status::Complete;
-            subprocess_destroy( &m_subProcess );
+            if ( strncmp( readBuffer, CompilerWorker::s_resultMarker, resultMarkerLength ) == 0 )
+            {
+                compilationResult = atoi( readBuffer + resultMarkerLength );
+                resultReceived = true;
+                break;
+            }
+
+            m_pRequest->m_log += readBuffer;
+        }
+
+        // The output stream closed without a result, so the compiler process died - restart it on the next request
+        if ( !resultReceived )
+        {
+            StopCompilerProcess( true );
+            CompleteRequest( CompilationRequest::Status::Failed, "Resource compiler failed to complete!" );
             return;
         }
 
         // Handle completed compilation
         //-------------------------------------------------------------------------
 
-        m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
-
-        switch ( exitCode )
+        switch ( (CompilationResult) compilationResult )
         {
-            case 0:
+            case CompilationResult::Success:
             {
-                m_pRequest->m_status = CompilationRequest::Status::Succeeded;
+                CompleteRequest( CompilationRequest::Status::Succeeded );
             }
             break;
 
-            case 1:
+            case CompilationResult::SuccessWithWarnings:
             {
-                m_pRequest->m_status = CompilationRequest::Status::SucceededWithWarnings;
+                CompleteRequest( CompilationRequest::Status::SucceededWithWarnings );
             }
             break;
 
             default:
             {
-                m_pRequest->m_status = CompilationRequest::Status::Failed;
+                CompleteRequest( CompilationRequest::Status::Failed );
             }
             break;
         }
-
-        // Read error and output of process
-        //-------------------------------------------------------------------------
-
-        char readBuffer[512];
-        while ( fgets( readBuffer, 512, subprocess_stdout( &m_subProcess ) ) )
-        {
-            m_pRequest->m_log += readBuffer;
-        }
-
-        m_status = Status::Complete;
-
-        //-------------------------------------------------------------------------
-
-        subprocess_destroy( &m_subProcess );
     }
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "System/Threading/TaskSystem.h"
 
 //-------------------------------------------------------------------------
+// Each worker owns a persistent resource compiler process that is reused for all requests
+// If the compiler process dies during a request, only that request fails and the process is restarted on the next request
 
 namespace KRG::Resource
 {
@@ -61,12 +63,20 @@ namespace KRG::Resource
 
         virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final;
 
+        // Compiler process management
+        bool TryStartCompilerProcess();
+        void StopCompilerProcess( bool forceTerminate = false );
+
+        // Sets the request result and completes the task
+        void CompleteRequest( CompilationRequest::Status status, char const* pMessage = nullptr );
+
     private:
 
         TaskSystem*                             m_pTaskSystem = nullptr;
         String const                            m_workerFullPath;
         CompilationRequest*                     m_pRequest = nullptr;
         subprocess_s                            m_subProcess;
+        bool                                    m_isCompilerProcessRunning = false;
         std::atomic<Status>                     m_status = Status::Idle;
     };
 }
\ No newline at end of file
@@ -230,6 +230,10 @@ namespace KRG
 
     int Win32Application::Run( int32_t argc, char** argv )
     {
+        // Entries are streamed to the log file by the log thread as they are processed
+        FileSystem::Path const LogFilePath( m_applicationNameNoWhitespace + "Log.txt" );
+        Log::SetOutputFile( LogFilePath );
+
         // Read Settings
         //-------------------------------------------------------------------------
 
@@ -285,8 +289,7 @@ namespace KRG
         bool const shutdownResult = Shutdown();
         m_initialized = false;
 
-        FileSystem::Path const LogFilePath( m_applicationNameNoWhitespace + "Log.txt" );
-        Log::SaveToFile( LogFilePath );
+        Log::Flush();
 
         //-------------------------------------------------------------------------
 
@@ -18,6 +18,7 @@ namespace KRG::AI
         inline AISpawnComponent() = default;
 
         inline EntityModel::EntityCollectionDescriptor const* GetEntityCollectionDesc() const { return m_pAIEntityDesc.GetPtr(); }
+        inline ResourceID const& GetEntityCollectionDescID() const { return m_pAIEntityDesc.GetResourceID(); }
 
     private:
 
@@ -2,7 +2,6 @@
 #include "System/Imgui/ImguiX.h"
 #include "System/Profiling.h"
 #include "Engine/UpdateContext.h"
-#include "System/Log.h"
 
 //-------------------------------------------------------------------------
 
@@ -92,6 +91,10 @@ namespace KRG
             ImGui::SameLine();
             ImGui::Checkbox( "Errors", &m_showLogErrors );
 
+            Log::ProducerStats const producerStats = Log::GetProducerStats();
+            ImGui::SameLine();
+            ImGui::Text( "Avg: %.2fus, Max: %.2fus, Stalls: %llu", producerStats.GetAverageTime().ToFloat(), Microseconds( producerStats.m_maxTime ).ToFloat(), producerStats.m_numStalls );
+
             //-------------------------------------------------------------------------
 
             if ( ImGui::BeginTable( "System Log Table", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY, ImGui::GetContentRegionAvail() ) )
@@ -108,7 +111,15 @@ namespace KRG
 
                 //-------------------------------------------------------------------------
 
-                auto const& logEntries = Log::GetLogEntries();
+                // The history is only copied when new entries have been processed
+                uint64_t const numProcessedEntries = Log::GetNumProcessedEntries();
+                if ( numProcessedEntries != m_numCachedProcessedEntries )
+                {
+                    m_cachedLogEntries = Log::GetLogEntries();
+                    m_numCachedProcessedEntries = numProcessedEntries;
+                }
+
+                auto const& logEntries = m_cachedLogEntries;
 
                 ImGuiListClipper clipper;
                 clipper.Begin( (int32_t) logEntries.size() );
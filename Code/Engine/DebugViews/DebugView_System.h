@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Entity/EntityWorldDebugView.h"
+#include "System/Log.h"
 
 //-------------------------------------------------------------------------
 
@@ -47,6 +48,8 @@ namespace KRG
     private:
 
         InlineString                                        m_logFilter = "TODO";
+        TVector<Log::LogEntry>                              m_cachedLogEntries;
+        uint64_t                                            m_numCachedProcessedEntries = 0;
     };
 }
 #endif
\ No newline at end of file
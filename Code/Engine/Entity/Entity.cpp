@@ -304,6 +304,27 @@ namespace KRG
 
         m_status = Status::Unloaded;
     }
+
+    void Entity::ResetComponents()
+    {
+        KRG_ASSERT( m_status == Status::Loaded && m_updateRegistrationStatus == RegistrationStatus::Unregistered );
+
+        for ( auto pComponent : m_components )
+        {
+            if ( !pComponent->IsInitialized() )
+            {
+                continue;
+            }
+
+            KRG_ASSERT( !pComponent->m_isRegisteredWithEntity && !pComponent->m_isRegisteredWithWorld );
+
+            pComponent->Shutdown();
+            KRG_ASSERT( !pComponent->IsInitialized() ); // Did you forget to call the parent class shutdown?
+
+            pComponent->Initialize();
+            KRG_ASSERT( pComponent->IsInitialized() ); // Did you forget to call the parent class initialize?
+        }
+    }
     
     //-------------------------------------------------------------------------
 
@@ -161,6 +161,9 @@ namespace KRG
         inline bool IsUnloaded() const { return m_status == Status::Unloaded; }
         inline bool HasStateChangeActionsPending() const { return !m_deferredActions.empty(); }
 
+        // Dormant entities are kept loaded but deactivated by their map (i.e. pooled entities that arent currently spawned)
+        inline bool IsDormant() const { return m_isDormant; }
+
         // Components
         //-------------------------------------------------------------------------
         // NB!!! Add and remove operations execute immediately for unloaded entities BUT will be deferred to the next loading phase for loaded entities
@@ -286,6 +289,10 @@ namespace KRG
         // Called just before an entity fully unloads - Unregisters components from systems, breaks spatial attachments. Will attempt to deactivate all attached entities
         void Deactivate( EntityModel::ActivationContext& activationContext );
 
+        // Shuts down and re-initializes all initialized components, this resets their runtime state without reloading any resources
+        // The entity needs to be deactivated and all its components unregistered from the world
+        void ResetComponents();
+
         // Immediate functions can be executed immediately for unloaded entities allowing us to skip the deferral of the operation
         void CreateSystemImmediate( TypeSystem::TypeInfo const* pSystemTypeInfo );
         void DestroySystemImmediate( TypeSystem::TypeInfo const* pSystemTypeInfo );
@@ -334,6 +341,7 @@ namespace KRG
         Entity*                                         m_pParentSpatialEntity = nullptr;                                   // The parent entity we are attached to
         KRG_EXPOSE StringID                             m_parentAttachmentSocketID;                                         // The socket that we are attached to on the parent
         bool                                            m_isSpatialAttachmentCreated = false;                               // Has the actual component-to-component attachment been created
+        bool                                            m_isDormant = false;                                                // Is this entity kept deactivated by its map (i.e. pooled)
 
         TVector<EntityInternalStateAction>              m_deferredActions;                                                  // The set of internal entity state changes that need to be executed
         Threading::Mutex                                m_internalStateMutex;                                               // A mutex that needs to be lock due to internal state changes
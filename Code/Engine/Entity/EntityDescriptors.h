@@ -146,6 +146,13 @@ namespace KRG::EntityModel
             m_entityDescriptors.emplace_back( entityDesc );
         }
 
+        inline void AddEntity( EntityDescriptor&& entityDesc )
+        {
+            KRG_ASSERT( entityDesc.IsValid() );
+            m_entityLookupMap.insert( TPair<StringID, int32_t>( entityDesc.m_name, (int32_t) m_entityDescriptors.size() ) );
+            m_entityDescriptors.emplace_back( eastl::move( entityDesc ) );
+        }
+
         void GenerateSpatialAttachmentInfo();
 
         void Clear() { m_entityDescriptors.clear(); m_entityLookupMap.clear(); m_entitySpatialAttachmentInfo.clear(); }
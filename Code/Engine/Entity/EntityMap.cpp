@@ -1,5 +1,6 @@
 #include "EntityMap.h"
 #include "EntityActivationContext.h"
+#include "EntityPool.h"
 #include "Engine/Entity/Entity.h"
 #include "System/Resource/ResourceSystem.h"
 #include "System/Profiling.h"
@@ -36,6 +37,7 @@ namespace KRG::EntityModel
         KRG_ASSERT( IsUnloaded() && !m_isMapInstantiated );
         KRG_ASSERT( m_entities.empty() && m_entityIDLookupMap.empty() );
         KRG_ASSERT( m_entitiesToAdd.empty() && m_entitiesToRemove.empty() );
+        KRG_ASSERT( m_entitiesToWake.empty() && m_entitiesToSleep.empty() && m_entityPools.empty() );
 
         #if KRG_DEVELOPMENT_TOOLS
         KRG_ASSERT( m_entitiesToHotReload.empty() );
@@ -115,6 +117,9 @@ namespace KRG::EntityModel
         m_entityIDLookupMap.swap( map.m_entityIDLookupMap );
         m_pMapDesc = eastl::move( map.m_pMapDesc );
         m_entitiesCurrentlyLoading = eastl::move( map.m_entitiesCurrentlyLoading );
+        m_entitiesToWake.swap( map.m_entitiesToWake );
+        m_entitiesToSleep.swap( map.m_entitiesToSleep );
+        m_entityPools.swap( map.m_entityPools );
         m_status = map.m_status;
         m_isUnloadRequested = map.m_isUnloadRequested;
         m_isMapInstantiated = map.m_isMapInstantiated;
@@ -125,6 +130,13 @@ namespace KRG::EntityModel
         map.m_status = Status::Unloaded;
         map.m_isMapInstantiated = false;
         map.m_isUnloadRequested = false;
+
+        // Pools keep a ptr to their map
+        for ( auto pEntityPool : m_entityPools )
+        {
+            pEntityPool->m_pMap = this;
+        }
+
         return *this;
     }
 
@@ -381,7 +393,7 @@ namespace KRG::EntityModel
                 for ( uint64_t i = range.start; i < range.end; ++i )
                 {
                     auto pEntity = m_entities[i];
-                    if ( pEntity->IsLoaded() )
+                    if ( pEntity->IsLoaded() && !pEntity->IsDormant() )
                     {
                         // Only activate non-spatial and root spatial entities
                         if ( !pEntity->IsSpatialEntity() || !pEntity->HasSpatialParent() )
@@ -482,6 +494,103 @@ namespace KRG::EntityModel
 
     //-------------------------------------------------------------------------
 
+    EntityPool* EntityMap::CreateEntityPool( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& entityCollectionDesc, int32_t numInstances )
+    {
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        auto pEntityPool = KRG::New<EntityPool>( this );
+        pEntityPool->Grow( pTaskSystem, typeRegistry, entityCollectionDesc, numInstances );
+        m_entityPools.emplace_back( pEntityPool );
+        return pEntityPool;
+    }
+
+    void EntityMap::DestroyEntityPool( EntityPool* pEntityPool )
+    {
+        KRG_ASSERT( pEntityPool != nullptr && pEntityPool->m_pMap == this );
+
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        for ( auto const& instance : pEntityPool->m_instances )
+        {
+            for ( auto pEntity : instance.m_entities )
+            {
+                m_entitiesToWake.erase_first_unsorted( pEntity );
+                m_entitiesToSleep.erase_first_unsorted( pEntity );
+                DestroyEntity( pEntity->GetID() );
+            }
+        }
+
+        m_entityPools.erase_first_unsorted( pEntityPool );
+        KRG::Delete( pEntityPool );
+    }
+
+    void EntityMap::AddDormantEntities( TVector<Entity*> const& entities )
+    {
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        m_entityIDLookupMap.reserve( m_entityIDLookupMap.size() + entities.size() );
+
+        #if KRG_DEVELOPMENT_TOOLS
+        m_entityNameLookupMap.reserve( m_entityNameLookupMap.size() + entities.size() );
+        #endif
+
+        for ( auto pEntity : entities )
+        {
+            pEntity->m_isDormant = true;
+            AddEntity( pEntity );
+        }
+    }
+
+    void EntityMap::WakeEntity( Entity* pEntity )
+    {
+        KRG_ASSERT( pEntity != nullptr && pEntity->m_mapID == m_ID && pEntity->IsDormant() );
+
+        Threading::RecursiveScopeLock lock( m_mutex );
+        KRG_ASSERT( !VectorContains( m_entitiesToWake, pEntity ) );
+        m_entitiesToWake.emplace_back( pEntity );
+    }
+
+    void EntityMap::PutEntityToSleep( Entity* pEntity )
+    {
+        KRG_ASSERT( pEntity != nullptr && pEntity->m_mapID == m_ID );
+
+        Threading::RecursiveScopeLock lock( m_mutex );
+        KRG_ASSERT( !VectorContains( m_entitiesToSleep, pEntity ) );
+        m_entitiesToSleep.emplace_back( pEntity );
+    }
+
+    bool EntityMap::IsEntityReadyToWake( Entity* pEntity )
+    {
+        KRG_ASSERT( pEntity != nullptr && pEntity->m_mapID == m_ID );
+
+        if ( !pEntity->IsDormant() || !pEntity->IsLoaded() )
+        {
+            return false;
+        }
+
+        // Wait for any pending wake/sleep requests to be processed
+        {
+            Threading::RecursiveScopeLock lock( m_mutex );
+            if ( VectorContains( m_entitiesToWake, pEntity ) || VectorContains( m_entitiesToSleep, pEntity ) )
+            {
+                return false;
+            }
+        }
+
+        // Wait for all components to finish loading
+        for ( auto pComponent : pEntity->GetComponents() )
+        {
+            if ( !pComponent->IsInitialized() && !pComponent->HasLoadingFailed() )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
     bool EntityMap::ProcessMapUnloadRequest( EntityLoadingContext const& loadingContext, EntityModel::ActivationContext& activationContext )
     {
         KRG_ASSERT( m_isUnloadRequested );
@@ -511,6 +620,13 @@ namespace KRG::EntityModel
                     m_isMapInstantiated = false;
                 }
 
+                // Entity pools dont own their entities (they are destroyed with all the other entities), so we only need to delete the pools themselves
+                for ( auto& pEntityPool : m_entityPools )
+                {
+                    KRG::Delete( pEntityPool );
+                }
+                m_entityPools.clear();
+
                 // Since entity ownership is transferred via the add call, we need to delete all pending add entity requests
                 for ( auto pEntity : m_entitiesToAdd )
                 {
@@ -522,6 +638,8 @@ namespace KRG::EntityModel
                 // Clear all internal entity lists
                 m_entitiesCurrentlyLoading.clear();
                 m_entitiesToRemove.clear();
+                m_entitiesToWake.clear();
+                m_entitiesToSleep.clear();
             }
 
             // Unload the map resource
@@ -665,6 +783,63 @@ namespace KRG::EntityModel
         }
     }
 
+    void EntityMap::ProcessEntityWakeAndSleepRequests( EntityModel::ActivationContext& activationContext )
+    {
+        // Wake
+        //-------------------------------------------------------------------------
+        // Woken entities are already loaded, so they will be activated by the loading update
+
+        for ( auto pEntityToWake : m_entitiesToWake )
+        {
+            KRG_ASSERT( pEntityToWake->IsDormant() && !pEntityToWake->IsActivated() );
+            pEntityToWake->m_isDormant = false;
+
+            // Attached entities are activated by their parents
+            if ( !pEntityToWake->HasSpatialParent() && !VectorContains( m_entitiesCurrentlyLoading, pEntityToWake ) )
+            {
+                m_entitiesCurrentlyLoading.emplace_back( pEntityToWake );
+            }
+        }
+
+        m_entitiesToWake.clear();
+
+        // Sleep
+        //-------------------------------------------------------------------------
+        // Deactivation is processed by the world after the map update, so we can only reset the components on a later update
+
+        for ( int32_t i = (int32_t) m_entitiesToSleep.size() - 1; i >= 0; i-- )
+        {
+            auto pEntityToSleep = m_entitiesToSleep[i];
+            pEntityToSleep->m_isDormant = true;
+
+            if ( pEntityToSleep->IsActivated() )
+            {
+                pEntityToSleep->Deactivate( activationContext );
+                continue;
+            }
+
+            // Wait until the entity has been fully unregistered from the world
+            if ( pEntityToSleep->m_updateRegistrationStatus != Entity::RegistrationStatus::Unregistered )
+            {
+                continue;
+            }
+
+            bool const hasRegisteredComponents = VectorContains( pEntityToSleep->m_components, true, [] ( EntityComponent* pComponent, bool ) { return pComponent->m_isRegisteredWithWorld; } );
+            if ( hasRegisteredComponents )
+            {
+                continue;
+            }
+
+            // Reset the component state and remove the request
+            if ( pEntityToSleep->IsLoaded() )
+            {
+                pEntityToSleep->ResetComponents();
+            }
+
+            m_entitiesToSleep.erase_unsorted( m_entitiesToSleep.begin() + i );
+        }
+    }
+
     bool EntityMap::ProcessEntityLoadingAndActivation( EntityLoadingContext const& loadingContext, EntityModel::ActivationContext& activationContext )
     {
         struct EntityLoadingTask : public ITaskSet
@@ -693,8 +868,8 @@ namespace KRG::EntityModel
                             KRG_ASSERT( pComponent->IsInitialized() || pComponent->HasLoadingFailed() );
                         }
 
-                        // If the map is activated, immediately activate any entities that finish loading
-                        if ( m_isActivated && pEntity->IsLoaded() )
+                        // If the map is activated, immediately activate any entities that finish loading (dormant entities are only activated once woken)
+                        if ( m_isActivated && pEntity->IsLoaded() && !pEntity->IsDormant() )
                         {
                             // Prevent us from activating entities whose parents are not yet activated, this ensures that our attachment chain have a consistent activation state
                             if ( !pEntity->HasSpatialParent() || pEntity->GetSpatialParent()->IsActivated() )
@@ -797,6 +972,7 @@ namespace KRG::EntityModel
         //-------------------------------------------------------------------------
 
         ProcessEntityAdditionAndRemoval( loadingContext, activationContext );
+        ProcessEntityWakeAndSleepRequests( activationContext );
         return ProcessEntityLoadingAndActivation( loadingContext, activationContext );
     }
 
@@ -21,6 +21,7 @@ namespace KRG
         struct EntityLoadingContext;
         struct ActivationContext;
         class EntityCollectionDescriptor;
+        class EntityPool;
 
         //-------------------------------------------------------------------------
         // Entity Map
@@ -40,6 +41,7 @@ namespace KRG
         class KRG_ENGINE_API EntityMap
         {
             friend EntityWorld;
+            friend EntityPool;
 
             enum class Status
             {
@@ -141,6 +143,16 @@ namespace KRG
             // May take multiple frame to be fully destroyed, as the removal occurs during the loading update
             void DestroyEntity( EntityID entityID );
 
+            // Entity Pools
+            //-------------------------------------------------------------------------
+
+            // Create a pool of dormant instances of the specified collection, the pool is owned by the map and destroyed with it
+            // Instances take a few frames to load before they can be spawned, see EntityPool for more details
+            EntityPool* CreateEntityPool( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& entityCollectionDesc, int32_t numInstances );
+
+            // Destroy a pool and all its entities (including all spawned instances)
+            void DestroyEntityPool( EntityPool* pEntityPool );
+
             #if KRG_DEVELOPMENT_TOOLS
             // Rename an existing entity - allow renaming of existing entities, will ensure that the new name is unique
             void RenameEntity( Entity* pEntity, StringID newNameID );
@@ -189,6 +201,23 @@ namespace KRG
             // Called whenever the internal state of an entity changes, schedules the entity for loading
             void OnEntityStateUpdated( Entity* pEntity );
 
+            // Pooled Entities
+            //-------------------------------------------------------------------------
+
+            // Add a set of entities that will be loaded but not activated - Transfers ownership of the entities to the map
+            void AddDormantEntities( TVector<Entity*> const& entities );
+
+            // Request activation of a dormant entity, this occurs during the loading update
+            void WakeEntity( Entity* pEntity );
+
+            // Request deactivation of an entity and keep it loaded, its components will be reset once it has been fully deactivated
+            void PutEntityToSleep( Entity* pEntity );
+
+            // Is this entity dormant, fully loaded and reset (i.e. can it be spawned)
+            bool IsEntityReadyToWake( Entity* pEntity );
+
+            void ProcessEntityWakeAndSleepRequests( EntityModel::ActivationContext& activationContext );
+
             bool ProcessMapUnloadRequest( EntityLoadingContext const& loadingContext, EntityModel::ActivationContext& activationContext );
             bool ProcessMapLoading( EntityLoadingContext const& loadingContext, EntityModel::ActivationContext& activationContext );
             void ProcessEntityAdditionAndRemoval( EntityLoadingContext const& loadingContext, EntityModel::ActivationContext& activationContext );
@@ -213,6 +242,9 @@ namespace KRG
             TVector<Entity*>                            m_entitiesCurrentlyLoading;
             TInlineVector<Entity*, 5>                   m_entitiesToAdd;
             TInlineVector<RemovalRequest, 5>            m_entitiesToRemove;
+            TVector<Entity*>                            m_entitiesToWake;
+            TVector<Entity*>                            m_entitiesToSleep;
+            TVector<EntityPool*>                        m_entityPools;
             EventBindingID                              m_entityUpdateEventBindingID;
             Status                                      m_status = Status::Unloaded;
             bool                                        m_isUnloadRequested = false;
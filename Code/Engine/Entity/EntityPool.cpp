@@ -0,0 +1,153 @@
+#include "EntityPool.h"
+#include "EntityMap.h"
+#include "Entity.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG::EntityModel
+{
+    int32_t EntityPool::GetNumAvailableInstances() const
+    {
+        int32_t numAvailableInstances = 0;
+        for ( auto const& instance : m_instances )
+        {
+            if ( IsInstanceAvailable( instance ) )
+            {
+                numAvailableInstances++;
+            }
+        }
+
+        return numAvailableInstances;
+    }
+
+    int32_t EntityPool::FindInstanceIndex( EntityID const& entityID ) const
+    {
+        int32_t const numInstances = (int32_t) m_instances.size();
+        for ( int32_t i = 0; i < numInstances; i++ )
+        {
+            for ( auto pEntity : m_instances[i].m_entities )
+            {
+                if ( pEntity->GetID() == entityID )
+                {
+                    return i;
+                }
+            }
+        }
+
+        return InvalidIndex;
+    }
+
+    bool EntityPool::IsInstanceAvailable( Instance const& instance ) const
+    {
+        if ( instance.m_isSpawned )
+        {
+            return false;
+        }
+
+        for ( auto pEntity : instance.m_entities )
+        {
+            if ( !m_pMap->IsEntityReadyToWake( pEntity ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityPool::Grow( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& collectionDesc, int32_t numInstances )
+    {
+        KRG_PROFILE_SCOPE_SCENE( "Grow Entity Pool" );
+        KRG_ASSERT( numInstances > 0 );
+
+        m_instances.reserve( m_instances.size() + numInstances );
+
+        for ( int32_t i = 0; i < numInstances; i++ )
+        {
+            auto& instance = m_instances.emplace_back();
+            instance.m_entities = collectionDesc.InstantiateCollection( pTaskSystem, typeRegistry );
+
+            // Record the initial transforms so we can restore them on each spawn
+            for ( auto pEntity : instance.m_entities )
+            {
+                for ( auto pComponent : pEntity->GetComponents() )
+                {
+                    if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent ) )
+                    {
+                        instance.m_initialTransforms.emplace_back( pSpatialComponent->GetLocalTransform() );
+                    }
+                }
+            }
+
+            m_pMap->AddDormantEntities( instance.m_entities );
+        }
+    }
+
+    int32_t EntityPool::TrySpawn( Transform const& offsetTransform )
+    {
+        int32_t const numInstances = (int32_t) m_instances.size();
+        for ( int32_t instanceIdx = 0; instanceIdx < numInstances; instanceIdx++ )
+        {
+            auto& instance = m_instances[instanceIdx];
+            if ( !IsInstanceAvailable( instance ) )
+            {
+                continue;
+            }
+
+            // Restore the initial transforms and apply the offset
+            //-------------------------------------------------------------------------
+
+            int32_t transformIdx = 0;
+            bool const applyOffset = !offsetTransform.IsIdentity();
+            for ( auto pEntity : instance.m_entities )
+            {
+                for ( auto pComponent : pEntity->GetComponents() )
+                {
+                    if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent ) )
+                    {
+                        pSpatialComponent->SetLocalTransform( instance.m_initialTransforms[transformIdx++] );
+                    }
+                }
+
+                // Attached entities are positioned by their parents
+                if ( applyOffset && pEntity->IsSpatialEntity() && !pEntity->HasSpatialParent() )
+                {
+                    pEntity->SetWorldTransform( pEntity->GetWorldTransform() * offsetTransform );
+                }
+            }
+
+            KRG_ASSERT( transformIdx == (int32_t) instance.m_initialTransforms.size() );
+
+            // Wake the entities
+            //-------------------------------------------------------------------------
+
+            for ( auto pEntity : instance.m_entities )
+            {
+                m_pMap->WakeEntity( pEntity );
+            }
+
+            instance.m_isSpawned = true;
+            return instanceIdx;
+        }
+
+        return InvalidIndex;
+    }
+
+    void EntityPool::Despawn( int32_t instanceIdx )
+    {
+        KRG_ASSERT( instanceIdx >= 0 && instanceIdx < (int32_t) m_instances.size() );
+
+        auto& instance = m_instances[instanceIdx];
+        KRG_ASSERT( instance.m_isSpawned );
+
+        for ( auto pEntity : instance.m_entities )
+        {
+            m_pMap->PutEntityToSleep( pEntity );
+        }
+
+        instance.m_isSpawned = false;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "EntityIDs.h"
+#include "System/Math/Transform.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG
+{
+    namespace TypeSystem { class TypeRegistry; }
+    class Entity;
+    class TaskSystem;
+}
+
+//-------------------------------------------------------------------------
+// Entity Pool
+//-------------------------------------------------------------------------
+// A set of pre-instantiated copies (instances) of an entity collection, owned by a map
+// This allows for high frequency spawning without any instantiation or resource loading at spawn time
+//
+// * Pooled entities are added to the map as dormant entities: they are loaded like any other entity but are never activated while dormant
+// * Spawning wakes an idle instance, it will be activated during the next map update
+// * Despawning puts the instance back to sleep, the map deactivates it and resets its components (i.e. shutdown and re-initialize, no reload)
+// * The initial spatial component transforms are restored on every spawn
+// * Pooled entities must only ever be spawned/despawned via the pool, never removed from the map directly
+//
+// What is reset on despawn:
+// * Anything a component sets up in Initialize and tears down in Shutdown, and anything entity systems set up in Initialize (they are shut down on deactivation)
+// * Any state that world systems store on a component while it is registered needs to be reset by that world system when it is unregistered (e.g. the AI think LOD state)
+//
+// What is NOT reset on despawn:
+// * Serialized component fields (i.e. the values that were set from the entity descriptor when loading) are not re-read,
+//   so any runtime changes to them carry over to the next spawn, components that modify their serialized fields at runtime are not safe to pool
+// * Loaded resources are kept, since a pooled instance is never unloaded between spawns
+//
+//-------------------------------------------------------------------------
+
+namespace KRG::EntityModel
+{
+    class EntityMap;
+    class EntityCollectionDescriptor;
+
+    //-------------------------------------------------------------------------
+
+    class KRG_ENGINE_API EntityPool
+    {
+        friend EntityMap;
+
+        struct Instance
+        {
+            TVector<Entity*>                    m_entities;
+            TVector<Transform>                  m_initialTransforms; // The initial local transforms of all spatial components (in entity and component order)
+            bool                                m_isSpawned = false;
+        };
+
+    public:
+
+        // Pools should only be created via the map (see EntityMap::CreateEntityPool)
+        explicit EntityPool( EntityMap* pMap ) : m_pMap( pMap ) { KRG_ASSERT( m_pMap != nullptr ); }
+
+        inline EntityMap* GetMap() const { return m_pMap; }
+        inline int32_t GetNumInstances() const { return (int32_t) m_instances.size(); }
+        inline bool IsInstanceSpawned( int32_t instanceIdx ) const { return m_instances[instanceIdx].m_isSpawned; }
+        inline TVector<Entity*> const& GetInstanceEntities( int32_t instanceIdx ) const { return m_instances[instanceIdx].m_entities; }
+
+        // Can this instance be spawned right now (i.e. idle and fully loaded)
+        inline bool IsInstanceAvailable( int32_t instanceIdx ) const { return IsInstanceAvailable( m_instances[instanceIdx] ); }
+
+        // Get the number of instances that can be spawned right now
+        int32_t GetNumAvailableInstances() const;
+
+        // Find the instance that contains the specified entity, returns InvalidIndex if this entity isnt part of this pool
+        int32_t FindInstanceIndex( EntityID const& entityID ) const;
+
+        // Instantiate additional instances, these will take a few frames to load before they can be spawned
+        void Grow( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& collectionDesc, int32_t numInstances );
+
+        // Spawn an available instance, the offset is applied in the same manner as when adding a collection to a map
+        // Returns the index of the spawned instance or InvalidIndex if no instance is currently available
+        int32_t TrySpawn( Transform const& offsetTransform = Transform::Identity );
+
+        // Return a spawned instance to the pool, it will be available to spawn again once it has been deactivated and reset
+        void Despawn( int32_t instanceIdx );
+
+    private:
+
+        bool IsInstanceAvailable( Instance const& instance ) const;
+
+    private:
+
+        EntityMap*                              m_pMap = nullptr;
+        TVector<Instance>                       m_instances;
+    };
+}
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "System/Serialization/TypeSerialization.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include "System/FileSystem/FileSystem.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
 #include "System/Log.h"
 #include <eastl/sort.h>
 
@@ -48,11 +50,6 @@ namespace KRG::EntityModel::Serializer
                 return m_componentNames.find( componentName ) != m_componentNames.end();
             }
 
-            inline bool DoesEntityExist( StringID entityName ) const
-            {
-                return m_entityNames.find( entityName ) != m_entityNames.end();
-            }
-
         public:
 
             TypeSystem::TypeRegistry const&             m_typeRegistry;
@@ -60,8 +57,7 @@ namespace KRG::EntityModel::Serializer
             // Parsing context ID - Entity/Component/etc...
             StringID                                    m_parsingContextName;
 
-            // Maps to allow for fast lookups of entity/component names for validation
-            THashMap<StringID, bool>                    m_entityNames;
+            // Map to allow for fast lookups of component names for validation
             THashMap<StringID, bool>                    m_componentNames;
         };
 
@@ -406,38 +402,106 @@ namespace KRG::EntityModel::Serializer
             //-------------------------------------------------------------------------
 
             ctx.m_parsingContextName.Clear();
-
-            //-------------------------------------------------------------------------
-
-            if ( ctx.DoesEntityExist( outEntityDesc.m_name ) )
-            {
-                return Error( "Duplicate entity ID detected: %s", outEntityDesc.m_name.c_str() );
-            }
-            else
-            {
-                ctx.m_entityNames.insert( TPair<StringID, bool>( outEntityDesc.m_name, true ) );
-                return true;
-            }
+            return true;
         }
 
-        static bool ReadEntityArray( ParsingContext& ctx, Serialization::JsonValue const& entitiesArrayValue, EntityCollectionDescriptor& outCollection )
+        static bool ReadEntityArray( TypeSystem::TypeRegistry const& typeRegistry, TaskSystem* pTaskSystem, Serialization::JsonValue const& entitiesArrayValue, EntityCollectionDescriptor& outCollection )
         {
+            KRG_PROFILE_SCOPE_SCENE( "Read Entity Array" );
+
             int32_t const numEntities = (int32_t) entitiesArrayValue.Size();
-            outCollection.Reserve( numEntities );
             for ( int32_t i = 0; i < numEntities; i++ )
             {
                 if ( !entitiesArrayValue[i].IsObject() )
                 {
                     return Error( "Malformed collection file, entities array can only contain objects" );
                 }
+            }
+
+            // Parse entity descriptors
+            //-------------------------------------------------------------------------
+            // Entities are independent of each other so we parse them in parallel into their final slots, the results are then merged serially in file order
+
+            TVector<EntityDescriptor> entityDescs;
+            entityDescs.resize( numEntities );
+
+            if ( pTaskSystem == nullptr || numEntities <= 10 )
+            {
+                ParsingContext ctx( typeRegistry );
+                for ( int32_t i = 0; i < numEntities; i++ )
+                {
+                    if ( !ReadEntityData( ctx, entitiesArrayValue[i], entityDescs[i] ) )
+                    {
+                        return false;
+                    }
+                }
+            }
+            else // Go wide and read all entities in parallel
+            {
+                struct EntityReadTask : public ITaskSet
+                {
+                    EntityReadTask( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entitiesArrayValue, TVector<EntityDescriptor>& entityDescs )
+                        : m_typeRegistry( typeRegistry )
+                        , m_entitiesArrayValue( entitiesArrayValue )
+                        , m_entityDescs( entityDescs )
+                    {
+                        m_SetSize = (uint32_t) entityDescs.size();
+                        m_MinRange = 10;
+                    }
+
+                    virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                    {
+                        KRG_PROFILE_SCOPE_SCENE( "Entity Read Task" );
+
+                        ParsingContext ctx( m_typeRegistry );
+                        for ( uint32_t i = range.start; i < range.end; ++i )
+                        {
+                            if ( !ReadEntityData( ctx, m_entitiesArrayValue[i], m_entityDescs[i] ) )
+                            {
+                                m_failed = true;
+                            }
+                        }
+                    }
+
+                public:
+
+                    std::atomic<bool>                       m_failed = false;
+
+                private:
 
-                EntityDescriptor entityDesc;
-                if ( !ReadEntityData( ctx, entitiesArrayValue[i], entityDesc ) )
+                    TypeSystem::TypeRegistry const&         m_typeRegistry;
+                    Serialization::JsonValue const&         m_entitiesArrayValue;
+                    TVector<EntityDescriptor>&              m_entityDescs;
+                };
+
+                //-------------------------------------------------------------------------
+
+                EntityReadTask readTask( typeRegistry, entitiesArrayValue, entityDescs );
+                pTaskSystem->ScheduleTask( &readTask );
+                pTaskSystem->WaitForTask( &readTask );
+
+                if ( readTask.m_failed )
                 {
                     return false;
                 }
+            }
+
+            // Validate and add to collection
+            //-------------------------------------------------------------------------
+
+            THashMap<StringID, bool> entityNames;
+            entityNames.reserve( numEntities );
 
-                outCollection.AddEntity( entityDesc );
+            outCollection.Reserve( numEntities );
+            for ( int32_t i = 0; i < numEntities; i++ )
+            {
+                if ( entityNames.find( entityDescs[i].m_name ) != entityNames.end() )
+                {
+                    return Error( "Duplicate entity ID detected: %s", entityDescs[i].m_name.c_str() );
+                }
+
+                entityNames.insert( TPair<StringID, bool>( entityDescs[i].m_name, true ) );
+                outCollection.AddEntity( eastl::move( entityDescs[i] ) );
             }
 
             return true;
@@ -459,16 +523,14 @@ namespace KRG::EntityModel::Serializer
         return ReadEntityData( ctx, entitiesObjectValue, outEntityDesc );
     }
 
-    bool ReadEntityCollectionFromJson( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entitiesArrayValue, EntityCollectionDescriptor& outCollectionDesc )
+    bool ReadEntityCollectionFromJson( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entitiesArrayValue, EntityCollectionDescriptor& outCollectionDesc, TaskSystem* pTaskSystem )
     {
         if ( !entitiesArrayValue.IsArray() )
         {
             return Error( "Failed to read entity collection, json value is not an array" );
         }
 
-        ParsingContext ctx( typeRegistry );
-
-        if ( !ReadEntityArray( ctx, entitiesArrayValue, outCollectionDesc ) )
+        if ( !ReadEntityArray( typeRegistry, pTaskSystem, entitiesArrayValue, outCollectionDesc ) )
         {
             return false;
         }
@@ -480,7 +542,7 @@ namespace KRG::EntityModel::Serializer
         return true;
     }
 
-    bool ReadEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, EntityCollectionDescriptor& outCollectionDesc )
+    bool ReadEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, EntityCollectionDescriptor& outCollectionDesc, TaskSystem* pTaskSystem )
     {
         KRG_ASSERT( filePath.IsValid() );
 
@@ -527,7 +589,7 @@ namespace KRG::EntityModel::Serializer
         // Read Entities
         //-------------------------------------------------------------------------
 
-        return ReadEntityCollectionFromJson( typeRegistry, entityCollectionDocument["Entities"], outCollectionDesc );
+        return ReadEntityCollectionFromJson( typeRegistry, entityCollectionDocument["Entities"], outCollectionDesc, pTaskSystem );
     }
 }
 
@@ -593,6 +655,101 @@ namespace KRG::EntityModel::Serializer
             writer.EndObject();
             return true;
         }
+
+        // Writes the collection as the root object of the supplied writer
+        // Each entity is written to its own buffer in parallel and then appended as a raw value, so the output is identical to the serial writer
+        static bool WriteEntityCollectionToJsonParallel( TaskSystem& taskSystem, TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& collection, Serialization::JsonWriter& writer )
+        {
+            KRG_PROFILE_SCOPE_SCENE( "Write Entity Collection" );
+
+            struct EntityWriteTask : public ITaskSet
+            {
+                EntityWriteTask( TypeSystem::TypeRegistry const& typeRegistry, TVector<EntityDescriptor> const& entityDescs, TVector<String>& entityStrings )
+                    : m_typeRegistry( typeRegistry )
+                    , m_entityDescs( entityDescs )
+                    , m_entityStrings( entityStrings )
+                {
+                    m_SetSize = (uint32_t) entityDescs.size();
+                    m_MinRange = 10;
+                }
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    KRG_PROFILE_SCOPE_SCENE( "Entity Write Task" );
+
+                    // Entities live at depth 2 in the file (root object -> entities array), so every line after the first needs two extra levels of indentation
+                    constexpr static size_t const entityIndentSize = 8;
+
+                    for ( uint32_t i = range.start; i < range.end; ++i )
+                    {
+                        JsonStringBuffer entityBuffer;
+                        JsonWriter entityWriter( entityBuffer );
+                        if ( !WriteEntityToJson( m_typeRegistry, m_entityDescs[i], entityWriter ) )
+                        {
+                            m_failed = true;
+                            continue;
+                        }
+
+                        // Json strings cant contain raw newlines so this only ever touches the writer's formatting
+                        char const* pEntityString = entityBuffer.GetString();
+                        size_t const entityStringLength = entityBuffer.GetSize();
+
+                        String& indentedString = m_entityStrings[i];
+                        indentedString.reserve( entityStringLength + entityStringLength / 8 );
+                        for ( size_t c = 0; c < entityStringLength; c++ )
+                        {
+                            indentedString.push_back( pEntityString[c] );
+                            if ( pEntityString[c] == '\n' )
+                            {
+                                indentedString.append( entityIndentSize, ' ' );
+                            }
+                        }
+                    }
+                }
+
+            public:
+
+                std::atomic<bool>                       m_failed = false;
+
+            private:
+
+                TypeSystem::TypeRegistry const&         m_typeRegistry;
+                TVector<EntityDescriptor> const&        m_entityDescs;
+                TVector<String>&                        m_entityStrings;
+            };
+
+            //-------------------------------------------------------------------------
+
+            auto const& entityDescs = collection.GetEntityDescriptors();
+
+            TVector<String> entityStrings;
+            entityStrings.resize( entityDescs.size() );
+
+            EntityWriteTask writeTask( typeRegistry, entityDescs, entityStrings );
+            taskSystem.ScheduleTask( &writeTask );
+            taskSystem.WaitForTask( &writeTask );
+
+            if ( writeTask.m_failed )
+            {
+                return false;
+            }
+
+            //-------------------------------------------------------------------------
+
+            writer.StartObject();
+            writer.Key( "Entities" );
+            writer.StartArray();
+
+            for ( auto const& entityString : entityStrings )
+            {
+                writer.RawValue( entityString.c_str(), entityString.length(), rapidjson::kObjectType );
+            }
+
+            writer.EndArray();
+            writer.EndObject();
+
+            return true;
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -659,8 +816,14 @@ namespace KRG::EntityModel::Serializer
         return WriteEntityToJson( typeRegistry, entityDesc, writer );
     }
 
-    bool WriteEntityCollectionToJson( TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& collection, Serialization::JsonWriter& writer )
+    bool WriteEntityCollectionToJson( TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& collection, Serialization::JsonWriter& writer, TaskSystem* pTaskSystem )
     {
+        // For small collections, just write them inline
+        if ( pTaskSystem != nullptr && collection.GetEntityDescriptors().size() > 10 )
+        {
+            return WriteEntityCollectionToJsonParallel( *pTaskSystem, typeRegistry, collection, writer );
+        }
+
         // Write collection to document
         //-------------------------------------------------------------------------
 
@@ -693,15 +856,15 @@ namespace KRG::EntityModel::Serializer
         return WriteEntityCollectionToJson( typeRegistry, ecd, writer );
     }
 
-    bool WriteEntityCollectionToFile( TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& collection, FileSystem::Path const& outFilePath )
+    bool WriteEntityCollectionToFile( TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& collection, FileSystem::Path const& outFilePath, TaskSystem* pTaskSystem )
     {
         KRG_ASSERT( outFilePath.IsValid() );
         JsonArchiveWriter archive;
-        WriteEntityCollectionToJson( typeRegistry, collection, *archive.GetWriter() );
+        WriteEntityCollectionToJson( typeRegistry, collection, *archive.GetWriter(), pTaskSystem );
         return archive.WriteToFile( outFilePath );
     }
 
-    bool WriteMapToFile( TypeSystem::TypeRegistry const& typeRegistry, EntityMap const& map, FileSystem::Path const& outFilePath )
+    bool WriteMapToFile( TypeSystem::TypeRegistry const& typeRegistry, EntityMap const& map, FileSystem::Path const& outFilePath, TaskSystem* pTaskSystem )
     {
         EntityCollectionDescriptor ecd;
         if ( !map.CreateDescriptor( typeRegistry, ecd ) )
@@ -709,7 +872,7 @@ namespace KRG::EntityModel::Serializer
             return false;
         }
 
-        return WriteEntityCollectionToFile( typeRegistry, ecd, outFilePath );
+        return WriteEntityCollectionToFile( typeRegistry, ecd, outFilePath, pTaskSystem );
     }
 }
 #endif
\ No newline at end of file
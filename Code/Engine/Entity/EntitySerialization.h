@@ -8,6 +8,7 @@
 namespace KRG
 {
     class Entity;
+    class TaskSystem;
     namespace FileSystem { class Path; }
     namespace TypeSystem { class TypeRegistry; }
 }
@@ -27,16 +28,20 @@ namespace KRG::EntityModel
 namespace KRG::EntityModel::Serializer
 {
     KRG_ENGINE_API bool ReadEntityDescriptor( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entityValue, EntityDescriptor& outEntityDesc );
-    KRG_ENGINE_API bool ReadEntityCollectionFromJson( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entitiesArrayValue, EntityCollectionDescriptor& outCollectionDesc );
-    KRG_ENGINE_API bool ReadEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, EntityCollectionDescriptor& outCollectionDesc );
+    // Collections are parsed per entity across the task system if one is supplied, the result is identical to the serial read
+    KRG_ENGINE_API bool ReadEntityCollectionFromJson( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entitiesArrayValue, EntityCollectionDescriptor& outCollectionDesc, TaskSystem* pTaskSystem = nullptr );
+    KRG_ENGINE_API bool ReadEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, EntityCollectionDescriptor& outCollectionDesc, TaskSystem* pTaskSystem = nullptr );
 
     //-------------------------------------------------------------------------
 
     KRG_ENGINE_API bool WriteEntityToJson( TypeSystem::TypeRegistry const& typeRegistry, EntityDescriptor const& entityDesc, Serialization::JsonWriter& writer );
     KRG_ENGINE_API bool WriteEntityToJson( TypeSystem::TypeRegistry const& typeRegistry, Entity const* pEntity, Serialization::JsonWriter& writer );
-    KRG_ENGINE_API bool WriteEntityCollectionToJson( TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& collection, Serialization::JsonWriter& writer );
+    // Entities are written per entity across the task system if one is supplied, the output is byte-identical to the serial write
+    KRG_ENGINE_API bool WriteEntityCollectionToJson( TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& collection, Serialization::JsonWriter& writer, TaskSystem* pTaskSystem = nullptr );
     KRG_ENGINE_API bool WriteMapToJson( TypeSystem::TypeRegistry const& typeRegistry, EntityMap const& map, Serialization::JsonWriter& writer );
-    KRG_ENGINE_API bool WriteEntityCollectionToFile( TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& collection, FileSystem::Path const& outFilePath );
-    KRG_ENGINE_API bool WriteMapToFile( TypeSystem::TypeRegistry const& typeRegistry, EntityMap const& map, FileSystem::Path const& outFilePath );
+
+    KRG_ENGINE_API bool WriteEntityCollectionToFile( TypeSystem::TypeRegistry const& typeRegistry, EntityCollectionDescriptor const& collection, FileSystem::Path const& outFilePath, TaskSystem* pTaskSystem = nullptr );
+    KRG_ENGINE_API bool WriteMapToFile( TypeSystem::TypeRegistry const& typeRegistry, EntityMap const& map, FileSystem::Path const& outFilePath, TaskSystem* pTaskSystem = nullptr );
+
 }
 #endif
\ No newline at end of file
@@ -226,7 +226,7 @@ namespace KRG
 
     void EntityWorld::Update( UpdateContext const& context )
     {
-        KRG_ASSERT( Threading::IsMainThread() );
+        KRG_ASSERT( Threading::IsMainThread() || m_isIndependent );
         KRG_ASSERT( !m_isSuspended );
 
         struct EntityUpdateTask final : public ITaskSet
@@ -57,6 +57,12 @@ namespace KRG
         // Wake this world, resumes execution of entity/system updates
         void ResumeUpdates() { m_isSuspended = false; }
 
+        // Independent worlds share no mutable state with any other world, so they can be updated in parallel with other worlds
+        inline bool IsIndependent() const { return m_isIndependent; }
+
+        // Only mark a world as independent if none of its entities/systems touch global state during their updates
+        inline void SetIndependent( bool isIndependent ) { m_isIndependent = isIndependent; }
+
         // Run entity and system updates
         void Update( UpdateContext const& context );
 
@@ -102,6 +108,15 @@ namespace KRG
         // Has a time-step for a paused world been requested?
         inline bool IsTimeStepRequested() const { return m_timeStepRequested; }
 
+        //-------------------------------------------------------------------------
+        // Random Numbers
+        //-------------------------------------------------------------------------
+        // All deterministic random streams in this world (e.g. per-entity streams) are derived from this seed
+        // Setting the same seed before loading will reproduce the same random sequences for the same entities
+
+        inline uint32_t GetRandomSeed() const { return m_randomSeed; }
+        inline void SetRandomSeed( uint32_t seed ) { KRG_ASSERT( seed != 0 ); m_randomSeed = seed; }
+
         //-------------------------------------------------------------------------
         // Viewport
         //-------------------------------------------------------------------------
@@ -234,6 +249,7 @@ namespace KRG
         EntityWorldType                                                         m_worldType = EntityWorldType::Game;
         Render::Viewport                                                        m_viewport = Render::Viewport( Int2::Zero, Int2( 640, 480 ), Math::ViewVolume( Float2( 640, 480 ), FloatRange( 0.1f, 100.0f ) ) );
         float                                                                   m_timeScale = 1.0f; // <= 0 means that the world is paused
+        uint32_t                                                                m_randomSeed = 0x4B524731;
         bool                                                                    m_timeStepRequested = false;
 
         // Maps
@@ -244,6 +260,7 @@ namespace KRG
         TVector<IWorldEntitySystem*>                                            m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
         bool                                                                    m_initialized = false;
         bool                                                                    m_isSuspended = false;
+        bool                                                                    m_isIndependent = false;
 
         #if KRG_DEVELOPMENT_TOOLS
         THashMap<TypeSystem::TypeID, TVector<EntityComponent const*>>           m_componentTypeLookup;
@@ -5,12 +5,22 @@
 #include "Engine/Camera/Components/Component_Camera.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include "Engine/UpdateContext.h"
+#include "Engine/RuntimeSettings/RuntimeSettings.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
 #include "System/Systems.h"
 
 //-------------------------------------------------------------------------
 
 namespace KRG
 {
+    namespace Settings
+    {
+        static RuntimeSettingBool g_parallelWorldUpdates( "ParallelWorldUpdates", "Entity/World", "Update independent worlds in parallel on the task system", true );
+    }
+
+    //-------------------------------------------------------------------------
+
     EntityWorldManager::~EntityWorldManager()
     {
         KRG_ASSERT( m_worlds.empty() && m_worldSystemTypeInfos.empty() );
@@ -19,6 +29,8 @@ namespace KRG
     void EntityWorldManager::Initialize( SystemRegistry const& systemsRegistry )
     {
         m_pSystemsRegistry = &systemsRegistry;
+        m_pTaskSystem = systemsRegistry.GetSystem<TaskSystem>();
+        KRG_ASSERT( m_pTaskSystem != nullptr );
 
         //-------------------------------------------------------------------------
 
@@ -54,6 +66,7 @@ namespace KRG
         //-------------------------------------------------------------------------
 
         m_worldSystemTypeInfos.clear();
+        m_pTaskSystem = nullptr;
         m_pSystemsRegistry = nullptr;
     }
 
@@ -111,6 +124,9 @@ namespace KRG
         pNewWorld->Initialize( *m_pSystemsRegistry, m_worldSystemTypeInfos );
         m_worlds.emplace_back( pNewWorld );
 
+        // Worlds are never independent by default since every world runs all the world systems and some of them touch global state (e.g. navmesh, input)
+        // Only the creator of a world knows whether that is safe, so independence needs to be explicitly opted into (see EditorWorkspace::CanUpdateWorldInParallel)
+
         //-------------------------------------------------------------------------
 
         #if KRG_DEVELOPMENT_TOOLS
@@ -170,6 +186,35 @@ namespace KRG
 
     void EntityWorldManager::UpdateWorlds( UpdateContext const& context )
     {
+        struct WorldUpdateTask final : public ITaskSet
+        {
+            WorldUpdateTask( UpdateContext const& context, TInlineVector<EntityWorld*, 5> const& worlds )
+                : m_context( context )
+                , m_worlds( worlds )
+            {
+                m_SetSize = (uint32_t) worlds.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    KRG_PROFILE_SCOPE_SCENE( "Update Independent World" );
+                    m_worlds[i]->Update( m_context );
+                }
+            }
+
+        private:
+
+            UpdateContext const&                        m_context;
+            TInlineVector<EntityWorld*, 5> const&       m_worlds;
+        };
+
+        //-------------------------------------------------------------------------
+
+        TInlineVector<EntityWorld*, 5> independentWorlds;
+        TInlineVector<EntityWorld*, 5> mainThreadWorlds;
+
         for ( auto const& pWorld : m_worlds )
         {
             if ( pWorld->IsSuspended() )
@@ -196,17 +241,51 @@ namespace KRG
                 }
             }
 
-            // Run world updates
             //-------------------------------------------------------------------------
 
+            if ( Settings::g_parallelWorldUpdates && pWorld->IsIndependent() )
+            {
+                independentWorlds.emplace_back( pWorld );
+            }
+            else
+            {
+                mainThreadWorlds.emplace_back( pWorld );
+            }
+        }
+
+        // Run world updates
+        //-------------------------------------------------------------------------
+        // Kick off the independent worlds first so that they run alongside the main thread world updates
+
+        WorldUpdateTask worldUpdateTask( context, independentWorlds );
+        if ( !independentWorlds.empty() )
+        {
+            m_pTaskSystem->ScheduleTask( &worldUpdateTask );
+        }
+
+        for ( auto const& pWorld : mainThreadWorlds )
+        {
             pWorld->Update( context );
+        }
 
-            // Update world view
-            //-------------------------------------------------------------------------
-            // We explicitly reflect the camera at the end of the post-physics stage as we assume it has been updated at that point
+        if ( !independentWorlds.empty() )
+        {
+            m_pTaskSystem->WaitForTask( &worldUpdateTask );
+        }
+
+        // Update world views
+        //-------------------------------------------------------------------------
+        // We explicitly reflect the camera at the end of the post-physics stage as we assume it has been updated at that point
 
-            if ( context.GetUpdateStage() == UpdateStage::PostPhysics && pWorld->GetViewport() != nullptr )
+        if ( context.GetUpdateStage() == UpdateStage::PostPhysics )
+        {
+            for ( auto const& pWorld : m_worlds )
             {
+                if ( pWorld->IsSuspended() || pWorld->GetViewport() == nullptr )
+                {
+                    continue;
+                }
+
                 auto pViewport = pWorld->GetViewport();
                 auto pPlayerManager = pWorld->GetWorldSystem<PlayerManager>();
                 if ( pPlayerManager->HasActiveCamera() )
@@ -11,6 +11,7 @@ namespace KRG
     class UpdateContext;
     class EntityWorld;
     class SystemRegistry;
+    class TaskSystem;
     enum class EntityWorldType : uint8_t;
     namespace TypeSystem { class TypeInfo; }
     namespace Render { class Viewport; }
@@ -65,6 +66,7 @@ namespace KRG
         TInlineVector<EntityWorld*, 5> const& GetWorlds() const { return m_worlds; }
 
         // Run the world update - updates all entities, systems and camera
+        // Independent worlds are updated in parallel on the task system, all other worlds are updated on the main thread
         void UpdateWorlds( UpdateContext const& context );
 
         // Editor
@@ -86,6 +88,7 @@ namespace KRG
     private:
 
         SystemRegistry const*                               m_pSystemsRegistry = nullptr;
+        TaskSystem*                                         m_pTaskSystem = nullptr;
         TInlineVector<EntityWorld*, 5>                      m_worlds;
         TVector<TypeSystem::TypeInfo const*>                m_worldSystemTypeInfos;
 
@@ -59,6 +59,11 @@ namespace KRG
         return m_pWorld->GetTimeScale();
     }
 
+    uint32_t EntityWorldUpdateContext::GetRandomSeed() const
+    {
+        return m_pWorld->GetRandomSeed();
+    }
+
     EntityWorldID const& EntityWorldUpdateContext::GetWorldID() const
     {
         return m_pWorld->GetID();
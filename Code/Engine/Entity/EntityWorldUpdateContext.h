@@ -31,6 +31,9 @@ namespace KRG
         // Get the world ID - threadsafe
         EntityWorldID const& GetWorldID() const;
 
+        // Get the world random seed - threadsafe, use this with a stable stream ID to create per-entity random streams (see Math::RNG)
+        uint32_t GetRandomSeed() const;
+
         // Get an entity world system - threadsafe since these never changed during the lifetime of a world
         template<typename T> inline T* GetWorldSystem() const
         {
@@ -1,8 +1,10 @@
 #include "DebugView_Navmesh.h"
 #include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
+#include "Engine/Navmesh/NavmeshSystem.h"
 #include "Engine/Entity/EntityWorld.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "System/Imgui/ImguiX.h"
+#include "System/Log.h"
 
 //-------------------------------------------------------------------------
 
@@ -104,11 +106,13 @@ namespace KRG::Navmesh
 
     void NavmeshDebugView::Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld )
     {
+        m_pNavmeshSystem = systemRegistry.GetSystem<NavmeshSystem>();
         m_pNavmeshWorldSystem = pWorld->GetWorldSystem<NavmeshWorldSystem>();
     }
 
     void NavmeshDebugView::Shutdown()
     {
+        m_pNavmeshSystem = nullptr;
         m_pNavmeshWorldSystem = nullptr;
     }
 
@@ -117,6 +121,39 @@ namespace KRG::Navmesh
     void NavmeshDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
         DrawNavmeshRuntimeSettings( m_pNavmeshWorldSystem );
+
+        //-------------------------------------------------------------------------
+
+        ImGui::Separator();
+        ImGui::Text( "Pending Path Requests: %u", m_pNavmeshWorldSystem->GetNumPendingPathRequests() );
+        ImGui::Text( "Paths Found Last Frame: %u", m_pNavmeshWorldSystem->GetNumPathsFoundLastFrame() );
+        ImGui::Text( "Cached Paths Used Last Frame: %u", m_pNavmeshWorldSystem->GetNumCachedPathsUsedLastFrame() );
+
+        if ( ImGui::Button( "Run Path Request Test", ImVec2( -1, 0 ) ) )
+        {
+            RunPathRequestTest();
+        }
+    }
+
+    void NavmeshDebugView::RunPathRequestTest()
+    {
+        static constexpr uint32_t const s_numRequests = 256;
+        static constexpr uint32_t const s_seed = 12345;
+
+        PathRequestTestResult const result = NavmeshWorldSystem::RunPathRequestTest( *m_pNavmeshSystem, s_numRequests, s_seed );
+
+        if ( result.m_numRequests == 0 )
+        {
+            KRG_LOG_WARNING( "Navmesh", "Path request test skipped: the test navmesh could not be generated" );
+        }
+        else if ( result.WasSuccessful() )
+        {
+            KRG_LOG_MESSAGE( "Navmesh", "Path request test passed (%u requests): direct %.2fms, requested %.2fms over %u frames", result.m_numRequests, result.m_directTime.ToFloat(), result.m_requestTime.ToFloat(), result.m_numFrames );
+        }
+        else
+        {
+            KRG_LOG_ERROR( "Navmesh", "Path request test failed (%u requests): %u mismatched results", result.m_numRequests, result.m_numMismatches );
+        }
     }
 
     void NavmeshDebugView::DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass )
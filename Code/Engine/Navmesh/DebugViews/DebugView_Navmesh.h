@@ -33,9 +33,11 @@ namespace KRG::Navmesh
         virtual void DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass ) override;
 
         void DrawMenu( EntityWorldUpdateContext const& context );
+        void RunPathRequestTest();
 
     private:
 
+        NavmeshSystem*          m_pNavmeshSystem = nullptr;
         NavmeshWorldSystem*     m_pNavmeshWorldSystem = nullptr;
     };
 }
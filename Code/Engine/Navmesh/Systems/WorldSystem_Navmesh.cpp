@@ -5,19 +5,34 @@
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Render/RenderViewport.h"
+#include "Engine/RuntimeSettings/RuntimeSettings.h"
 #include "System/Profiling.h"
 #include "System/Math/BoundingVolumes.h"
+#include "System/Time/Timers.h"
+#include "System/Math/MathRandom.h"
+
+#if KRG_ENABLE_NAVPOWER && KRG_DEVELOPMENT_TOOLS
+#include <bfxBuilder.h>
+#endif
 
 //-------------------------------------------------------------------------
 
 namespace KRG::Navmesh
 {
+    static RuntimeSettingFloat g_pathRequestBudget( "PathRequestBudget", "Navigation", "The max time (ms) spent finding paths per frame, at least one request is always processed per frame", 1.0f, 0.1f, 10.0f );
+
+    //-------------------------------------------------------------------------
+
     void NavmeshWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
     {
-        #if KRG_ENABLE_NAVPOWER
         auto pNavmeshSystem = systemRegistry.GetSystem<NavmeshSystem>();
+        CreateInstance( *pNavmeshSystem );
+    }
 
-        m_pInstance = bfx::SystemCreate( bfx::SystemParams( 2.0f, bfx::Z_UP ), pNavmeshSystem->m_pAllocator );
+    void NavmeshWorldSystem::CreateInstance( NavmeshSystem const& navmeshSystem )
+    {
+        #if KRG_ENABLE_NAVPOWER
+        m_pInstance = bfx::SystemCreate( bfx::SystemParams( 2.0f, bfx::Z_UP ), navmeshSystem.m_pAllocator );
         bfx::SetCurrentInstance( nullptr );
 
         bfx::RegisterPlannerSystem( m_pInstance );
@@ -31,7 +46,12 @@ namespace KRG::Navmesh
 
     void NavmeshWorldSystem::ShutdownSystem()
     {
+        // Release all outstanding paths before we destroy the instance that owns them
+        m_pathRequests.clear();
+        m_numPendingPathRequests = 0;
+
         #if KRG_ENABLE_NAVPOWER
+        m_pathCache.clear();
         KRG_ASSERT( m_registeredNavmeshes.empty() );
 
         #if KRG_DEVELOPMENT_TOOLS
@@ -76,45 +96,59 @@ namespace KRG::Navmesh
     {
         KRG_ASSERT( pComponent != nullptr );
 
+        NavmeshData const* pData = pComponent->m_pNavmeshData.GetPtr();
+        KRG_ASSERT( pData != nullptr && pData->IsValid() );
+        RegisterNavmesh( pComponent->GetID(), pData->GetGraphImage(), pComponent->GetWorldTransform() );
+    }
+
+    void NavmeshWorldSystem::UnregisterNavmesh( NavmeshComponent* pComponent )
+    {
+        KRG_ASSERT( pComponent != nullptr );
+        UnregisterNavmesh( pComponent->GetID() );
+    }
+
+    void NavmeshWorldSystem::RegisterNavmesh( ComponentID const& ID, Blob const& graphImage, Transform const& worldTransform )
+    {
+        KRG_ASSERT( ID.IsValid() && !graphImage.empty() );
+
         #if KRG_ENABLE_NAVPOWER
 
         // Copy resource
         //-------------------------------------------------------------------------
         // NavPower operates on the resource in place so we need to make a copy
 
-        NavmeshData const* pData = pComponent->m_pNavmeshData.GetPtr();
-        KRG_ASSERT( pData != nullptr && pData->IsValid() );
-
-        size_t const requiredMemory = sizeof( char ) * pData->GetGraphImage().size();
+        size_t const requiredMemory = sizeof( char ) * graphImage.size();
         char* pNavmesh = (char*) KRG::Alloc( requiredMemory );
-        memcpy( pNavmesh, pData->GetGraphImage().data(), requiredMemory );
+        memcpy( pNavmesh, graphImage.data(), requiredMemory );
 
         // Add resource
         //-------------------------------------------------------------------------
 
-        Transform const& componentWorldTransform = pComponent->GetWorldTransform();
-
         bfx::ResourceOffset offset;
-        offset.m_positionOffset = ToBfx( componentWorldTransform.GetTranslation() );
-        offset.m_rotationOffset = ToBfx( componentWorldTransform.GetRotation() );
+        offset.m_positionOffset = ToBfx( worldTransform.GetTranslation() );
+        offset.m_rotationOffset = ToBfx( worldTransform.GetRotation() );
 
         bfx::SpaceHandle space = bfx::GetDefaultSpaceHandle( m_pInstance );
         bfx::AddResource( space, pNavmesh, offset );
 
         // Add record
-        m_registeredNavmeshes.emplace_back( RegisteredNavmesh( pComponent->GetID(), pNavmesh ) );
+        m_registeredNavmeshes.emplace_back( RegisteredNavmesh( ID, pNavmesh ) );
+
+        // Any cached paths were found on the old navgraph
+        Threading::ScopeLock lock( m_pathRequestMutex );
+        m_pathCache.clear();
 
         #endif
     }
 
-    void NavmeshWorldSystem::UnregisterNavmesh( NavmeshComponent* pComponent )
+    void NavmeshWorldSystem::UnregisterNavmesh( ComponentID const& ID )
     {
-        KRG_ASSERT( pComponent != nullptr );
+        KRG_ASSERT( ID.IsValid() );
         #if KRG_ENABLE_NAVPOWER
 
         for ( auto i = 0u; i < m_registeredNavmeshes.size(); i++ )
         {
-            if ( pComponent->GetID() == m_registeredNavmeshes[i].m_componentID )
+            if ( ID == m_registeredNavmeshes[i].m_componentID )
             {
                 bfx::SpaceHandle space = bfx::GetDefaultSpaceHandle( m_pInstance );
                 bfx::RemoveResource( space, m_registeredNavmeshes[i].m_pNavmesh );
@@ -123,6 +157,10 @@ namespace KRG::Navmesh
 
                 KRG::Free( m_registeredNavmeshes[i].m_pNavmesh );
                 m_registeredNavmeshes.erase_unsorted( m_registeredNavmeshes.begin() + i );
+
+                // Any cached paths were found on the old navgraph
+                Threading::ScopeLock lock( m_pathRequestMutex );
+                m_pathCache.clear();
                 return;
             }
         }
@@ -135,6 +173,10 @@ namespace KRG::Navmesh
 
     void NavmeshWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        ProcessPathRequests( ctx.GetDeltaTime() );
+
+        //-------------------------------------------------------------------------
+
         #if KRG_ENABLE_NAVPOWER
 
         {
@@ -181,4 +223,586 @@ namespace KRG::Navmesh
 
         return bounds;
     }
-}
\ No newline at end of file
+}
+//-------------------------------------------------------------------------
+// Path Requests
+//-------------------------------------------------------------------------
+
+namespace KRG::Navmesh
+{
+    PathRequestID NavmeshWorldSystem::RequestPath( Vector const& startPosition, Vector const& goalPosition )
+    {
+        Threading::ScopeLock lock( m_pathRequestMutex );
+
+        PathRequestID const requestID = m_nextPathRequestID++;
+        if ( m_nextPathRequestID == InvalidPathRequestID )
+        {
+            m_nextPathRequestID++;
+        }
+
+        auto& request = m_pathRequests.emplace_back( PathRequest( requestID, startPosition, goalPosition ) );
+
+        //-------------------------------------------------------------------------
+
+        #if KRG_ENABLE_NAVPOWER
+        if ( TryFindCachedPath( startPosition, goalPosition, request.m_path ) )
+        {
+            request.m_status = PathRequestStatus::Succeeded;
+            KRG_DEVELOPMENT_TOOLS_ONLY( m_numCachedPathsUsed++ );
+        }
+        else
+        {
+            m_numPendingPathRequests++;
+        }
+        #else
+        // Nothing can ever find a path so fail immediately
+        request.m_status = PathRequestStatus::Failed;
+        #endif
+
+        return requestID;
+    }
+
+    PathRequestStatus NavmeshWorldSystem::GetPathRequestStatus( PathRequestID requestID ) const
+    {
+        Threading::ScopeLock lock( m_pathRequestMutex );
+
+        for ( auto const& request : m_pathRequests )
+        {
+            if ( request.m_ID == requestID )
+            {
+                return request.m_status;
+            }
+        }
+
+        return PathRequestStatus::Invalid;
+    }
+
+    void NavmeshWorldSystem::ReleasePathRequest( PathRequestID requestID )
+    {
+        Threading::ScopeLock lock( m_pathRequestMutex );
+
+        for ( auto i = 0u; i < m_pathRequests.size(); i++ )
+        {
+            if ( m_pathRequests[i].m_ID == requestID )
+            {
+                if ( m_pathRequests[i].m_status == PathRequestStatus::Pending )
+                {
+                    KRG_ASSERT( m_numPendingPathRequests > 0 );
+                    m_numPendingPathRequests--;
+                }
+
+                // Keep the requests in the order they were made, since that is the order we process them in
+                m_pathRequests.erase( m_pathRequests.begin() + i );
+                return;
+            }
+        }
+    }
+
+    #if KRG_ENABLE_NAVPOWER
+    bool NavmeshWorldSystem::TryGetPath( PathRequestID requestID, bfx::PolylinePathRCPtr& outPath ) const
+    {
+        Threading::ScopeLock lock( m_pathRequestMutex );
+
+        for ( auto const& request : m_pathRequests )
+        {
+            if ( request.m_ID == requestID )
+            {
+                if ( request.m_status == PathRequestStatus::Succeeded )
+                {
+                    outPath = request.m_path;
+                    return true;
+                }
+
+                return false;
+            }
+        }
+
+        return false;
+    }
+
+    bool NavmeshWorldSystem::TryFindCachedPath( Vector const& startPosition, Vector const& goalPosition, bfx::PolylinePathRCPtr& outPath ) const
+    {
+        for ( auto const& cachedPath : m_pathCache )
+        {
+            if ( cachedPath.m_goalPosition.GetDistanceSquared3( goalPosition ) > ( s_cachedPathGoalTolerance * s_cachedPathGoalTolerance ) )
+            {
+                continue;
+            }
+
+            if ( cachedPath.m_startPosition.GetDistanceSquared3( startPosition ) > ( s_cachedPathStartTolerance * s_cachedPathStartTolerance ) )
+            {
+                continue;
+            }
+
+            outPath = cachedPath.m_path;
+            return true;
+        }
+
+        return false;
+    }
+
+    void NavmeshWorldSystem::AddPathToCache( Vector const& startPosition, Vector const& goalPosition, bfx::PolylinePathRCPtr const& path )
+    {
+        KRG_ASSERT( path.IsValid() );
+
+        // Evict the oldest path if the cache is full
+        if ( m_pathCache.size() == s_maxCachedPaths )
+        {
+            int32_t oldestIdx = 0;
+            for ( int32_t i = 1; i < (int32_t) m_pathCache.size(); i++ )
+            {
+                if ( m_pathCache[i].m_timeRemaining < m_pathCache[oldestIdx].m_timeRemaining )
+                {
+                    oldestIdx = i;
+                }
+            }
+
+            m_pathCache.erase_unsorted( m_pathCache.begin() + oldestIdx );
+        }
+
+        auto& cachedPath = m_pathCache.emplace_back();
+        cachedPath.m_startPosition = startPosition;
+        cachedPath.m_goalPosition = goalPosition;
+        cachedPath.m_path = path;
+        cachedPath.m_timeRemaining = s_cachedPathLifetime;
+    }
+    #endif
+
+    void NavmeshWorldSystem::ExpireUnclaimedPathRequests( float deltaTime )
+    {
+        for ( int32_t i = (int32_t) m_pathRequests.size() - 1; i >= 0; i-- )
+        {
+            if ( m_pathRequests[i].m_status == PathRequestStatus::Pending )
+            {
+                continue;
+            }
+
+            m_pathRequests[i].m_timeSinceCompleted += deltaTime;
+            if ( m_pathRequests[i].m_timeSinceCompleted > s_unclaimedPathRequestLifetime )
+            {
+                m_pathRequests.erase( m_pathRequests.begin() + i );
+            }
+        }
+    }
+
+    void NavmeshWorldSystem::ProcessPathRequests( float deltaTime )
+    {
+        KRG_PROFILE_SCOPE_NAVIGATION( "Process Path Requests" );
+
+        uint32_t numPathsFound = 0;
+
+        {
+            Threading::ScopeLock lock( m_pathRequestMutex );
+            ExpireUnclaimedPathRequests( deltaTime );
+
+            #if KRG_ENABLE_NAVPOWER
+            for ( int32_t i = (int32_t) m_pathCache.size() - 1; i >= 0; i-- )
+            {
+                m_pathCache[i].m_timeRemaining -= deltaTime;
+                if ( m_pathCache[i].m_timeRemaining <= 0.0f )
+                {
+                    m_pathCache.erase_unsorted( m_pathCache.begin() + i );
+                }
+            }
+            #endif
+        }
+
+        // Process pending requests in the order they were made until we run out of budget
+        //-------------------------------------------------------------------------
+        // The lock is only held while we touch the request list, so that requests can be made and released while we find paths
+
+        #if KRG_ENABLE_NAVPOWER
+        Timer<PlatformClock> budgetTimer;
+        budgetTimer.Start();
+
+        bfx::SpaceHandle const spaceHandle = GetSpaceHandle();
+
+        bfx::PathSpec pathSpec;
+        pathSpec.m_snapMode = bfx::SNAP_CLOSEST;
+
+        bfx::PathCreationOptions pathOptions;
+        pathOptions.m_forceFirstPosOntoNavGraph = true;
+
+        while ( true )
+        {
+            // Always find at least one path per frame so that we are guaranteed to make progress
+            if ( numPathsFound > 0 && budgetTimer.GetElapsedTimeMilliseconds().ToFloat() >= g_pathRequestBudget )
+            {
+                break;
+            }
+
+            // Get the oldest pending request, a request processed earlier this frame might have found a path we can reuse
+            PathRequestID requestID = InvalidPathRequestID;
+            Vector startPosition, goalPosition;
+            {
+                Threading::ScopeLock lock( m_pathRequestMutex );
+
+                for ( auto& request : m_pathRequests )
+                {
+                    if ( request.m_status != PathRequestStatus::Pending )
+                    {
+                        continue;
+                    }
+
+                    if ( TryFindCachedPath( request.m_startPosition, request.m_goalPosition, request.m_path ) )
+                    {
+                        request.m_status = PathRequestStatus::Succeeded;
+                        KRG_ASSERT( m_numPendingPathRequests > 0 );
+                        m_numPendingPathRequests--;
+                        KRG_DEVELOPMENT_TOOLS_ONLY( m_numCachedPathsUsed++ );
+                        continue;
+                    }
+
+                    requestID = request.m_ID;
+                    startPosition = request.m_startPosition;
+                    goalPosition = request.m_goalPosition;
+                    break;
+                }
+            }
+
+            if ( requestID == InvalidPathRequestID )
+            {
+                break;
+            }
+
+            //-------------------------------------------------------------------------
+
+            bfx::PolylinePathRCPtr path = bfx::CreatePolylinePath( spaceHandle, ToBfx( startPosition ), ToBfx( goalPosition ), 0, pathSpec, pathOptions );
+            numPathsFound++;
+
+            //-------------------------------------------------------------------------
+
+            Threading::ScopeLock lock( m_pathRequestMutex );
+
+            if ( path.IsValid() )
+            {
+                AddPathToCache( startPosition, goalPosition, path );
+            }
+
+            // The request might have been released while we were finding the path
+            for ( auto& request : m_pathRequests )
+            {
+                if ( request.m_ID == requestID )
+                {
+                    KRG_ASSERT( request.m_status == PathRequestStatus::Pending );
+                    request.m_path = path;
+                    request.m_status = path.IsValid() ? PathRequestStatus::Succeeded : PathRequestStatus::Failed;
+
+                    KRG_ASSERT( m_numPendingPathRequests > 0 );
+                    m_numPendingPathRequests--;
+                    break;
+                }
+            }
+        }
+        #endif
+
+        //-------------------------------------------------------------------------
+
+        #if KRG_DEVELOPMENT_TOOLS
+        Threading::ScopeLock lock( m_pathRequestMutex );
+        m_numPathsFoundLastFrame = numPathsFound;
+        m_numCachedPathsUsedLastFrame = m_numCachedPathsUsed;
+        m_numCachedPathsUsed = 0;
+        #endif
+    }
+}
+
+
+//-------------------------------------------------------------------------
+// Headless Path Request Test
+//-------------------------------------------------------------------------
+// Generates a grid navmesh with random holes and registers it with a standalone system (its own NavPower instance and request queue), no world is touched
+// Finds paths between random points on the generated navmesh, both directly and through the request queue
+// Every request needs to produce the same result as the direct query, some requests are released while pending to test cancellation
+// None of the test requests are released once complete, so all of them need to have expired by the end of the test
+
+#if KRG_DEVELOPMENT_TOOLS
+namespace KRG::Navmesh
+{
+    #if KRG_ENABLE_NAVPOWER
+    bool NavmeshWorldSystem::GenerateTestNavmesh( uint32_t numCellsPerSide, uint32_t seed, Blob& outGraphImage )
+    {
+        static constexpr float const s_cellSize = 4.0f;
+        static constexpr float const s_holeProbability = 0.15f;
+
+        KRG_ASSERT( numCellsPerSide > 0 );
+
+        // Create the build faces: two walkable triangles per cell, the cells we skip become holes
+        //-------------------------------------------------------------------------
+        // The grid is centered on the origin, NavPower expects counterclockwise winding
+
+        Math::RNG rng( seed );
+        float const halfSize = numCellsPerSide * s_cellSize / 2;
+
+        TVector<bfx::BuildFace> buildFaces;
+        buildFaces.reserve( numCellsPerSide * numCellsPerSide * 2 );
+
+        auto AddFace = [&buildFaces] ( bfx::Vector3 const& v0, bfx::Vector3 const& v1, bfx::Vector3 const& v2 )
+        {
+            auto& buildFace = buildFaces.emplace_back( bfx::BuildFace() );
+            buildFace.m_type = bfx::WALKABLE_FACE;
+            buildFace.m_verts[0] = v0;
+            buildFace.m_verts[1] = v1;
+            buildFace.m_verts[2] = v2;
+        };
+
+        for ( uint32_t y = 0; y < numCellsPerSide; y++ )
+        {
+            for ( uint32_t x = 0; x < numCellsPerSide; x++ )
+            {
+                if ( rng.GetFloat( 0.0f, 1.0f ) < s_holeProbability )
+                {
+                    continue;
+                }
+
+                float const minX = x * s_cellSize - halfSize;
+                float const minY = y * s_cellSize - halfSize;
+                float const maxX = minX + s_cellSize;
+                float const maxY = minY + s_cellSize;
+
+                AddFace( bfx::Vector3( minX, minY, 0.0f ), bfx::Vector3( maxX, minY, 0.0f ), bfx::Vector3( maxX, maxY, 0.0f ) );
+                AddFace( bfx::Vector3( minX, minY, 0.0f ), bfx::Vector3( maxX, maxY, 0.0f ), bfx::Vector3( minX, maxY, 0.0f ) );
+            }
+        }
+
+        // Build the graph image with the default layer settings
+        //-------------------------------------------------------------------------
+        // The builder needs its own instance to be the current instance, world systems pass their instance explicitly
+
+        bfx::CustomAllocator* pAllocator = bfx::CreateDLMallocAllocator();
+        bfx::Instance* pBuilderInstance = bfx::SystemCreate( bfx::SystemParams( 2.0f, bfx::Z_UP ), pAllocator );
+
+        bfx::SetCurrentInstance( pBuilderInstance );
+        bfx::RegisterBuilderSystem();
+        bfx::SystemStart( pBuilderInstance );
+
+        NavmeshLayerBuildSettings const layerSettings;
+        bfx::BuildParams buildParams;
+        buildParams.m_voxSize = layerSettings.m_voxSize;
+        buildParams.m_height = layerSettings.m_height;
+        buildParams.m_radius = layerSettings.m_radius;
+        buildParams.m_step = layerSettings.m_step;
+        buildParams.m_additionalInwardsSmoothingDist = layerSettings.m_additionalInwardsSmoothingDist;
+        buildParams.m_optimizeForAxisAligned = layerSettings.m_optimizeForAxisAligned;
+        buildParams.m_dropOffRadius = layerSettings.m_dropOffRadius;
+        buildParams.m_maxWalkableSlope = layerSettings.m_maxWalkableSlope;
+        buildParams.m_leaveSmallIslandsTouchingPortals = layerSettings.m_leaveSmallIslandsTouchingPortals;
+        buildParams.m_minIslandSurfaceArea = layerSettings.m_minIslandSurfaceArea;
+        buildParams.m_useEnhancedTerrainTracking = layerSettings.m_useEnhancedTerrainTracking;
+        buildParams.m_tessellateForPathingAccuracy = layerSettings.m_tessellateForPathingAccuracy;
+
+        bfx::SurfaceNavigationInput surfaceInput;
+        surfaceInput.m_pFaces = buildFaces.data();
+        surfaceInput.m_numFaces = (uint32_t) buildFaces.size();
+        surfaceInput.m_pParams = &buildParams;
+        surfaceInput.m_numParams = 1;
+
+        bfx::NavGraphImage* pGraphImage = bfx::CreateNavGraphImage( surfaceInput, bfx::PlatformParams() );
+        bool const wasGenerated = pGraphImage != nullptr && pGraphImage->GetNumBytes() > 0;
+        if ( wasGenerated )
+        {
+            outGraphImage.resize( pGraphImage->GetNumBytes() );
+            memcpy( outGraphImage.data(), pGraphImage->GetPtr(), pGraphImage->GetNumBytes() );
+        }
+
+        if ( pGraphImage != nullptr )
+        {
+            bfx::DestroyNavGraphImage( pGraphImage );
+        }
+
+        bfx::SystemStop( pBuilderInstance );
+        bfx::SystemDestroy( pBuilderInstance );
+        bfx::DestroyAllocator( pAllocator );
+        bfx::SetCurrentInstance( nullptr );
+
+        return wasGenerated;
+    }
+    #endif
+
+    //-------------------------------------------------------------------------
+
+    PathRequestTestResult NavmeshWorldSystem::RunPathRequestTest( NavmeshSystem& navmeshSystem, uint32_t numRequests, uint32_t seed )
+    {
+        static constexpr uint32_t const s_numCellsPerSide = 32;
+
+        PathRequestTestResult result;
+
+        #if KRG_ENABLE_NAVPOWER
+        if ( numRequests == 0 )
+        {
+            return result;
+        }
+
+        // Create the standalone system
+        //-------------------------------------------------------------------------
+
+        Blob graphImage;
+        if ( !GenerateTestNavmesh( s_numCellsPerSide, seed, graphImage ) )
+        {
+            return result;
+        }
+
+        NavmeshWorldSystem testSystem;
+        testSystem.CreateInstance( navmeshSystem );
+
+        ComponentID const testNavmeshID( &graphImage );
+        testSystem.RegisterNavmesh( testNavmeshID, graphImage, Transform::Identity );
+
+        // Generate request positions
+        //-------------------------------------------------------------------------
+        // Reject any request that could reuse the path of an earlier one, since the cached path wouldnt match the direct query
+
+        AABB const navmeshBounds = testSystem.GetNavmeshBounds( 0 );
+        Vector const boundsMin = navmeshBounds.GetMin();
+        Vector const boundsMax = navmeshBounds.GetMax();
+
+        Math::RNG rng( seed );
+        auto GetRandomPosition = [&] ()
+        {
+            return Vector( rng.GetFloat( boundsMin.GetX(), boundsMax.GetX() + 0.01f ), rng.GetFloat( boundsMin.GetY(), boundsMax.GetY() + 0.01f ), navmeshBounds.m_center.GetZ() );
+        };
+
+        TVector<TPair<Vector, Vector>> positions;
+        positions.reserve( numRequests );
+
+        for ( uint32_t attempt = 0; positions.size() < numRequests && attempt < numRequests * 4; attempt++ )
+        {
+            Vector const startPosition = GetRandomPosition();
+            Vector const goalPosition = GetRandomPosition();
+
+            bool isCloseToExistingRequest = false;
+            for ( auto const& existing : positions )
+            {
+                if ( existing.first.GetDistanceSquared3( startPosition ) <= ( s_cachedPathStartTolerance * s_cachedPathStartTolerance ) && existing.second.GetDistanceSquared3( goalPosition ) <= ( s_cachedPathGoalTolerance * s_cachedPathGoalTolerance ) )
+                {
+                    isCloseToExistingRequest = true;
+                    break;
+                }
+            }
+
+            if ( !isCloseToExistingRequest )
+            {
+                positions.emplace_back( startPosition, goalPosition );
+            }
+        }
+
+        result.m_numRequests = (uint32_t) positions.size();
+
+        // Find all paths directly
+        //-------------------------------------------------------------------------
+
+        bfx::SpaceHandle const spaceHandle = testSystem.GetSpaceHandle();
+
+        bfx::PathSpec pathSpec;
+        pathSpec.m_snapMode = bfx::SNAP_CLOSEST;
+
+        bfx::PathCreationOptions pathOptions;
+        pathOptions.m_forceFirstPosOntoNavGraph = true;
+
+        TVector<bfx::PolylinePathRCPtr> directPaths;
+        directPaths.resize( positions.size() );
+
+        {
+            ScopedTimer<PlatformClock> timer( result.m_directTime );
+            for ( auto i = 0u; i < positions.size(); i++ )
+            {
+                directPaths[i] = bfx::CreatePolylinePath( spaceHandle, ToBfx( positions[i].first ), ToBfx( positions[i].second ), 0, pathSpec, pathOptions );
+            }
+        }
+
+        // Find all paths through the request queue
+        //-------------------------------------------------------------------------
+
+        TVector<PathRequestID> requestIDs;
+        requestIDs.reserve( positions.size() );
+
+        Timer<PlatformClock> requestTimer;
+        requestTimer.Start();
+
+        for ( auto const& requestPositions : positions )
+        {
+            requestIDs.emplace_back( testSystem.RequestPath( requestPositions.first, requestPositions.second ) );
+        }
+
+        // Release every eighth request before it is processed
+        for ( auto i = 0u; i < requestIDs.size(); i += 8 )
+        {
+            testSystem.ReleasePathRequest( requestIDs[i] );
+            if ( testSystem.GetPathRequestStatus( requestIDs[i] ) != PathRequestStatus::Invalid )
+            {
+                result.m_numMismatches++;
+            }
+        }
+
+        // Process the queue a frame at a time, each frame needs to complete at least one of the remaining requests
+        uint32_t numRemainingRequests = (uint32_t) requestIDs.size();
+        while ( numRemainingRequests > 0 )
+        {
+            testSystem.ProcessPathRequests( 0.0f );
+            result.m_numFrames++;
+
+            uint32_t numPendingRequests = 0;
+            for ( auto const& requestID : requestIDs )
+            {
+                numPendingRequests += ( testSystem.GetPathRequestStatus( requestID ) == PathRequestStatus::Pending ) ? 1 : 0;
+            }
+
+            if ( numPendingRequests == numRemainingRequests )
+            {
+                result.m_numMismatches += numPendingRequests;
+                break;
+            }
+
+            numRemainingRequests = numPendingRequests;
+        }
+
+        result.m_requestTime = requestTimer.GetElapsedTimeMilliseconds();
+
+        // Compare results
+        //-------------------------------------------------------------------------
+
+        for ( auto i = 0u; i < requestIDs.size(); i++ )
+        {
+            if ( ( i % 8 ) == 0 )
+            {
+                continue;
+            }
+
+            PathRequestStatus const expectedStatus = directPaths[i].IsValid() ? PathRequestStatus::Succeeded : PathRequestStatus::Failed;
+            if ( testSystem.GetPathRequestStatus( requestIDs[i] ) != expectedStatus )
+            {
+                result.m_numMismatches++;
+                continue;
+            }
+
+            bfx::PolylinePathRCPtr path;
+            if ( testSystem.TryGetPath( requestIDs[i], path ) && path.GetNumSegments() != directPaths[i].GetNumSegments() )
+            {
+                result.m_numMismatches++;
+            }
+        }
+
+        // Unclaimed requests need to be expired, this only touches the standalone system's queue
+        //-------------------------------------------------------------------------
+
+        testSystem.ProcessPathRequests( s_unclaimedPathRequestLifetime + 1.0f );
+
+        for ( auto const& requestID : requestIDs )
+        {
+            if ( testSystem.GetPathRequestStatus( requestID ) != PathRequestStatus::Invalid )
+            {
+                result.m_numMismatches++;
+            }
+        }
+
+        // Destroy the standalone system
+        //-------------------------------------------------------------------------
+
+        testSystem.UnregisterNavmesh( testNavmeshID );
+        testSystem.ShutdownSystem();
+        #endif
+
+        return result;
+    }
+}
+#endif
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "Engine/Navmesh/NavPower.h"
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "Engine/UpdateContext.h"
+#include "System/Math/Transform.h"
+#include "System/Threading/Threading.h"
+#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
 // Navmesh World System
@@ -11,6 +14,7 @@
 // This is the main system responsible for managing navmesh within a specific world
 // Manages navmesh registration, obstacles creation/destruction, etc...
 // Primarily also needed to get the space handle needed for any queries ( GetSpaceHandle )
+// Also provides time-sliced path finding, so that many agents replanning on the same frame dont spike the frame
 
 namespace KRG { struct AABB; }
 
@@ -19,6 +23,37 @@ namespace KRG { struct AABB; }
 namespace KRG::Navmesh
 {
     class NavmeshComponent;
+    class NavmeshSystem;
+
+    //-------------------------------------------------------------------------
+
+    using PathRequestID = uint32_t;
+    constexpr static PathRequestID const InvalidPathRequestID = 0;
+
+    enum class PathRequestStatus : uint8_t
+    {
+        Invalid = 0,
+        Pending,
+        Succeeded,
+        Failed
+    };
+
+    //-------------------------------------------------------------------------
+
+    #if KRG_DEVELOPMENT_TOOLS
+    struct PathRequestTestResult
+    {
+        inline bool WasSuccessful() const { return m_numMismatches == 0; }
+
+    public:
+
+        uint32_t                                        m_numRequests = 0;
+        uint32_t                                        m_numMismatches = 0;
+        uint32_t                                        m_numFrames = 0;
+        Milliseconds                                    m_directTime = 0.0f;
+        Milliseconds                                    m_requestTime = 0.0f;
+    };
+    #endif
 
     //-------------------------------------------------------------------------
 
@@ -37,6 +72,37 @@ namespace KRG::Navmesh
             char*           m_pNavmesh;
         };
 
+        struct PathRequest
+        {
+            PathRequest( PathRequestID ID, Vector const& startPosition, Vector const& goalPosition ) : m_ID( ID ), m_startPosition( startPosition ), m_goalPosition( goalPosition ) { KRG_ASSERT( ID != InvalidPathRequestID ); }
+
+            PathRequestID                               m_ID;
+            Vector                                      m_startPosition;
+            Vector                                      m_goalPosition;
+            PathRequestStatus                           m_status = PathRequestStatus::Pending;
+            float                                       m_timeSinceCompleted = 0.0f;
+
+            #if KRG_ENABLE_NAVPOWER
+            bfx::PolylinePathRCPtr                      m_path;
+            #endif
+        };
+
+        #if KRG_ENABLE_NAVPOWER
+        struct CachedPath
+        {
+            Vector                                      m_startPosition;
+            Vector                                      m_goalPosition;
+            bfx::PolylinePathRCPtr                      m_path;
+            float                                       m_timeRemaining = 0.0f;
+        };
+        #endif
+
+        constexpr static uint32_t const s_maxCachedPaths = 32;
+        constexpr static float const s_cachedPathStartTolerance = 1.0f;
+        constexpr static float const s_cachedPathGoalTolerance = 0.5f;
+        constexpr static float const s_cachedPathLifetime = 2.0f;
+        constexpr static float const s_unclaimedPathRequestLifetime = 5.0f;
+
     public:
 
         KRG_REGISTER_TYPE( NavmeshWorldSystem );
@@ -52,19 +118,61 @@ namespace KRG::Navmesh
         KRG_FORCE_INLINE bfx::SpaceHandle GetSpaceHandle() const { return bfx::GetDefaultSpaceHandle( m_pInstance ); }
         #endif
 
+        // Path Requests
+        //-------------------------------------------------------------------------
+        // Requests are queued and processed during the system update within a per-frame time budget, so results are only available on a later frame
+        // Requests with start and goal positions close to a recently found path will reuse that path
+        // All request functions are thread-safe, every request needs to be released once the result has been consumed
+        // Completed requests that are never released (e.g. the requester was destroyed) are expired after a few seconds
+
+        PathRequestID RequestPath( Vector const& startPosition, Vector const& goalPosition );
+        PathRequestStatus GetPathRequestStatus( PathRequestID requestID ) const;
+        void ReleasePathRequest( PathRequestID requestID );
+
+        #if KRG_ENABLE_NAVPOWER
+        // Get the path for a completed request, returns false if the request is still pending or has failed
+        bool TryGetPath( PathRequestID requestID, bfx::PolylinePathRCPtr& outPath ) const;
+        #endif
+
+        #if KRG_DEVELOPMENT_TOOLS
+        // Headless path request test, runs on a standalone system over a generated navmesh so no world's requests are affected, see the implementation for details
+        static PathRequestTestResult RunPathRequestTest( NavmeshSystem& navmeshSystem, uint32_t numRequests, uint32_t seed );
+
+        inline uint32_t GetNumPendingPathRequests() const { return m_numPendingPathRequests; }
+        inline uint32_t GetNumPathsFoundLastFrame() const { return m_numPathsFoundLastFrame; }
+        inline uint32_t GetNumCachedPathsUsedLastFrame() const { return m_numCachedPathsUsedLastFrame; }
+        #endif
+
     private:
 
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override;
         virtual void ShutdownSystem() override;
 
+        void CreateInstance( NavmeshSystem const& navmeshSystem );
+
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
 
         void RegisterNavmesh( NavmeshComponent* pComponent );
         void UnregisterNavmesh( NavmeshComponent* pComponent );
+        void RegisterNavmesh( ComponentID const& ID, Blob const& graphImage, Transform const& worldTransform );
+        void UnregisterNavmesh( ComponentID const& ID );
 
         void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
+        void ProcessPathRequests( float deltaTime );
+        void ExpireUnclaimedPathRequests( float deltaTime );
+
+        #if KRG_ENABLE_NAVPOWER
+        bool TryFindCachedPath( Vector const& startPosition, Vector const& goalPosition, bfx::PolylinePathRCPtr& outPath ) const;
+        void AddPathToCache( Vector const& startPosition, Vector const& goalPosition, bfx::PolylinePathRCPtr const& path );
+
+        #if KRG_DEVELOPMENT_TOOLS
+        // Builds the graph image for a flat square grid of cells with some of the cells removed, so that paths need to go around the holes
+        static bool GenerateTestNavmesh( uint32_t numCellsPerSide, uint32_t seed, Blob& outGraphImage );
+        #endif
+        #endif
+
     private:
 
         #if KRG_ENABLE_NAVPOWER
@@ -80,5 +188,23 @@ namespace KRG::Navmesh
 
         TVector<NavmeshComponent*>                      m_navmeshComponents;
         TVector<RegisteredNavmesh>                      m_registeredNavmeshes;
+
+        // Path requests
+        //-------------------------------------------------------------------------
+
+        mutable Threading::Mutex                        m_pathRequestMutex;
+        TVector<PathRequest>                            m_pathRequests;
+        PathRequestID                                   m_nextPathRequestID = 1;
+        uint32_t                                        m_numPendingPathRequests = 0;
+
+        #if KRG_ENABLE_NAVPOWER
+        TVector<CachedPath>                             m_pathCache;
+        #endif
+
+        #if KRG_DEVELOPMENT_TOOLS
+        uint32_t                                        m_numPathsFoundLastFrame = 0;
+        uint32_t                                        m_numCachedPathsUsedLastFrame = 0;
+        uint32_t                                        m_numCachedPathsUsed = 0;
+        #endif
     };
 }
\ No newline at end of file
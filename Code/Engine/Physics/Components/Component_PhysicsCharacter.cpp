@@ -1,4 +1,5 @@
 #include "Component_PhysicsCharacter.h"
+#include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Physics/PhysX.h"
 
 //-------------------------------------------------------------------------
@@ -52,12 +53,12 @@ namespace KRG::Physics
         if ( m_pPhysicsActor != nullptr )
         {
             // Teleport kinematic body
-            auto physicsScene = m_pPhysicsActor->getScene();
-            physicsScene->lockWrite();
+            Scene* pPhysicsScene = Scene::FromPx( m_pPhysicsActor->getScene() );
+            pPhysicsScene->AcquireWriteLock();
             auto pKinematicActor = m_pPhysicsActor->is<physx::PxRigidDynamic>();
             KRG_ASSERT( pKinematicActor->getRigidBodyFlags().isSet( physx::PxRigidBodyFlag::eKINEMATIC ) );
             pKinematicActor->setGlobalPose( ToPx( m_capsuleWorldTransform ) );
-            physicsScene->unlockWrite();
+            pPhysicsScene->ReleaseWriteLock();
         }
     }
 
@@ -75,11 +76,11 @@ namespace KRG::Physics
         m_capsuleWorldTransform = CalculateCapsuleTransformFromWorldTransform( GetWorldTransform() );
 
         // Request the kinematic body be moved by the physics simulation
-        auto physicsScene = m_pPhysicsActor->getScene();
-        physicsScene->lockWrite();
+        Scene* pPhysicsScene = Scene::FromPx( m_pPhysicsActor->getScene() );
+        pPhysicsScene->AcquireWriteLock();
         auto pKinematicActor = m_pPhysicsActor->is<physx::PxRigidDynamic>();
         KRG_ASSERT( pKinematicActor->getRigidBodyFlags().isSet( physx::PxRigidBodyFlag::eKINEMATIC ) );
         pKinematicActor->setKinematicTarget( ToPx( m_capsuleWorldTransform ) );
-        physicsScene->unlockWrite();
+        pPhysicsScene->ReleaseWriteLock();
     }
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Component_PhysicsShape.h"
+#include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Physics/PhysX.h"
 
 //-------------------------------------------------------------------------
@@ -14,12 +15,12 @@ namespace KRG::Physics
         if ( m_pPhysicsActor != nullptr && IsKinematic() )
         {
             // Request the kinematic body be moved by the physics simulation
-            auto physicsScene = m_pPhysicsActor->getScene();
-            physicsScene->lockWrite();
+            Scene* pPhysicsScene = Scene::FromPx( m_pPhysicsActor->getScene() );
+            pPhysicsScene->AcquireWriteLock();
             auto pKinematicActor = m_pPhysicsActor->is<physx::PxRigidDynamic>();
             KRG_ASSERT( pKinematicActor->getRigidBodyFlags().isSet( physx::PxRigidBodyFlag::eKINEMATIC ) );
             pKinematicActor->setKinematicTarget( ToPx( GetWorldTransform() ) );
-            physicsScene->unlockWrite();
+            pPhysicsScene->ReleaseWriteLock();
         }
         // Notify listeners that our transform has changed!
         else if ( m_actorType == ActorType::Static )
@@ -34,12 +35,12 @@ namespace KRG::Physics
         SetWorldTransformDirectly( newWorldTransform, false ); // Do not fire callback as we dont want to lock the scene twice
 
         // Teleport kinematic body
-        auto physicsScene = m_pPhysicsActor->getScene();
-        physicsScene->lockWrite();
+        Scene* pPhysicsScene = Scene::FromPx( m_pPhysicsActor->getScene() );
+        pPhysicsScene->AcquireWriteLock();
         auto pKinematicActor = m_pPhysicsActor->is<physx::PxRigidDynamic>();
         KRG_ASSERT( pKinematicActor->getRigidBodyFlags().isSet( physx::PxRigidBodyFlag::eKINEMATIC ) );
         pKinematicActor->setGlobalPose( ToPx( GetWorldTransform() ) );
-        physicsScene->unlockWrite();
+        pPhysicsScene->ReleaseWriteLock();
     }
 
     void PhysicsShapeComponent::MoveTo( Transform const& newWorldTransform )
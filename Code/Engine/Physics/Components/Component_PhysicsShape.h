@@ -123,6 +123,12 @@ namespace KRG::Physics
         physx::PxRigidActor*                            m_pPhysicsActor = nullptr;
         physx::PxShape*                                 m_pPhysicsShape = nullptr;
 
+        // The results of the last two simulation steps, dynamic actor transforms are interpolated between these
+        Transform                                       m_previousPhysicsPose;
+        Transform                                       m_currentPhysicsPose;
+        bool                                            m_isActivePhysicsActor = false;     // Did the actor move during the last simulation step
+        bool                                            m_isInActiveActorList = false;      // Is this component in the world system's list of components awaiting transform writeback
+
         #if KRG_DEVELOPMENT_TOOLS
         String                                          m_debugName; // Keep a debug name here since the physx SDK doesnt store the name data
         #endif
@@ -1,5 +1,6 @@
 #include "DebugView_Physics.h"
 #include "Engine/Physics/PhysicsSystem.h"
+#include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Physics/Systems/WorldSystem_Physics.h"
 #include "Engine/Physics/Components/Component_PhysicsCapsule.h"
 #include "Engine/Physics/Components/Component_PhysicsSphere.h"
@@ -166,6 +167,31 @@ namespace KRG::Physics
         ImGui::Checkbox( "Draw Dynamic Actor Bounds", &m_pPhysicsWorldSystem->m_drawDynamicActorBounds );
         ImGui::Checkbox( "Draw Kinematic Actor Bounds", &m_pPhysicsWorldSystem->m_drawKinematicActorBounds );
 
+        //-------------------------------------------------------------------------
+        // Simulation Stats
+        //-------------------------------------------------------------------------
+
+        ImGui::Separator();
+
+        ImGui::Text( "Simulation Steps: %u", m_pPhysicsWorldSystem->GetNumSimulationStepsLastFrame() );
+        ImGui::Text( "Simulation Wait Time: %.3fms", m_pPhysicsWorldSystem->GetSimulationWaitTimeLastFrame().ToFloat() );
+        ImGui::Text( "Active Actors: %u (Awaiting Writeback: %u)", m_pPhysicsWorldSystem->GetNumActiveActorsLastStep(), m_pPhysicsWorldSystem->GetNumActiveDynamicComponents() );
+        ImGui::Text( "Simulation Running In Background: %s", m_pPhysicsWorldSystem->IsSimulationRunning() ? "Yes" : "No" );
+
+        if ( m_pPhysicsWorldSystem->IsSimulationOverlapTestRunning() )
+        {
+            ImGui::TextColored( Colors::Yellow.ToFloat4(), "Simulation Overlap Test Running..." );
+        }
+        else if ( ImGui::Button( "Run Simulation Overlap Test", ImVec2( -1, 0 ) ) )
+        {
+            m_pPhysicsWorldSystem->StartSimulationOverlapTest( 300 );
+        }
+
+        if ( ImGui::Button( "Run Batch Query Test", ImVec2( -1, 0 ) ) )
+        {
+            RunBatchQueryTest( context );
+        }
+
         //-------------------------------------------------------------------------
         // Component Debug
         //-------------------------------------------------------------------------
@@ -183,6 +209,24 @@ namespace KRG::Physics
         }
     }
 
+    void PhysicsDebugView::RunBatchQueryTest( EntityWorldUpdateContext const& context )
+    {
+        static constexpr uint32_t const s_numRequests = 2048;
+        static constexpr uint32_t const s_seed = 12345;
+
+        auto pTaskSystem = context.GetSystem<TaskSystem>();
+        BatchQueryTestResult const result = Physics::RunBatchQueryTest( *m_pPhysicsSystem, pTaskSystem, s_numRequests, s_seed );
+
+        if ( result.WasSuccessful() )
+        {
+            KRG_LOG_MESSAGE( "Physics", "Batch query test passed (%u requests per query type): single %.2fms, batched %.2fms", result.m_numRequests, result.m_singleTime.ToFloat(), result.m_batchedTime.ToFloat() );
+        }
+        else
+        {
+            KRG_LOG_ERROR( "Physics", "Batch query test failed (%u requests per query type): %u mismatched results", result.m_numRequests, result.m_numMismatches );
+        }
+    }
+
     void PhysicsDebugView::DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass )
     {
         if ( m_isComponentWindowOpen )
@@ -44,6 +44,8 @@ namespace KRG::Physics
 
         void DrawComponentVisualization( EntityWorldUpdateContext const& context, PhysicsShapeComponent const* pComponent ) const;
 
+        void RunBatchQueryTest( EntityWorldUpdateContext const& context );
+
     private:
 
         PhysicsSystem*          m_pPhysicsSystem = nullptr;
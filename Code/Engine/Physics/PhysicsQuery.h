@@ -18,6 +18,7 @@
 //-------------------------------------------------------------------------
 
 namespace KRG { class EntityComponent; }
+namespace KRG::Physics { class QueryFilter; }
 namespace physx { class PxShape; class PxRigidActor; }
 
 //-------------------------------------------------------------------------
@@ -115,6 +116,71 @@ namespace KRG::Physics
 
     using OverlapResults = OverlapResultBuffer<32>;
 
+    //-------------------------------------------------------------------------
+    // Batched Query Requests
+    //-------------------------------------------------------------------------
+    // Requests for the batched scene queries, each request writes into the result buffer at the same index in the caller provided results array
+    // The filters are only read during the batch so can be shared between requests, but must outlive the batch
+
+    struct QueryShape
+    {
+        enum class Type : uint8_t
+        {
+            Sphere,
+            Capsule,    // Half-height is along the X-axis
+            Cylinder,   // Half-height is along the X-axis
+            Box,
+        };
+
+        static inline QueryShape Sphere( float radius ) { return QueryShape( Type::Sphere, Float3( radius, 0.0f, 0.0f ) ); }
+        static inline QueryShape Capsule( float cylinderPortionHalfHeight, float radius ) { return QueryShape( Type::Capsule, Float3( cylinderPortionHalfHeight, radius, 0.0f ) ); }
+        static inline QueryShape Cylinder( float halfHeight, float radius ) { return QueryShape( Type::Cylinder, Float3( halfHeight, radius, 0.0f ) ); }
+        static inline QueryShape Box( Float3 const& halfExtents ) { return QueryShape( Type::Box, halfExtents ); }
+
+    public:
+
+        QueryShape() = default;
+
+        inline float GetRadius() const { KRG_ASSERT( m_type != Type::Box ); return ( m_type == Type::Sphere ) ? m_dimensions.m_x : m_dimensions.m_y; }
+        inline float GetHalfHeight() const { KRG_ASSERT( m_type == Type::Capsule || m_type == Type::Cylinder ); return m_dimensions.m_x; }
+        inline Vector GetHalfExtents() const { KRG_ASSERT( m_type == Type::Box ); return Vector( m_dimensions ); }
+
+    private:
+
+        QueryShape( Type type, Float3 const& dimensions ) : m_dimensions( dimensions ), m_type( type ) {}
+
+    public:
+
+        Float3                  m_dimensions = Float3::Zero;
+        Type                    m_type = Type::Sphere;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct RayCastRequest
+    {
+        Vector                  m_start;
+        Vector                  m_end;
+        QueryFilter*            m_pFilter = nullptr;
+    };
+
+    struct SweepRequest
+    {
+        Quaternion              m_orientation = Quaternion::Identity;
+        Vector                  m_start;
+        Vector                  m_end;
+        QueryFilter*            m_pFilter = nullptr;
+        QueryShape              m_shape;
+    };
+
+    struct OverlapRequest
+    {
+        Quaternion              m_orientation = Quaternion::Identity;
+        Vector                  m_position;
+        QueryFilter*            m_pFilter = nullptr;
+        QueryShape              m_shape;
+    };
+
     //-------------------------------------------------------------------------
     // PhysX Query Filter
     //-------------------------------------------------------------------------
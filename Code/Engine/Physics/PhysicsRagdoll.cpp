@@ -1,4 +1,5 @@
 #include "PhysicsRagdoll.h"
+#include "PhysicsScene.h"
 #include "System/Animation/AnimationPose.h"
 #include "System/Drawing/DebugDrawing.h"
 #include "System/Math/MathHelpers.h"
@@ -797,10 +798,12 @@ namespace KRG::Physics
         KRG_ASSERT( pScene != nullptr && m_pArticulation->getScene() == nullptr );
         KRG_ASSERT( m_pRootControlActor == nullptr );
 
-        pScene->lockWrite();
+        // Acquiring the write lock completes any running simulation step
+        Scene* pPhysicsScene = Scene::FromPx( pScene );
+        pPhysicsScene->AcquireWriteLock();
         pScene->addArticulation( *m_pArticulation );
         TryCreateRootControlBody();
-        pScene->unlockWrite();
+        pPhysicsScene->ReleaseWriteLock();
     }
 
     void Ragdoll::RemoveFromScene()
@@ -808,10 +811,11 @@ namespace KRG::Physics
         auto pScene = m_pArticulation->getScene();
         KRG_ASSERT( pScene != nullptr );
 
-        pScene->lockWrite();
+        Scene* pPhysicsScene = Scene::FromPx( pScene );
+        pPhysicsScene->AcquireWriteLock();
         DestroyRootControlBody();
         pScene->removeArticulation( *m_pArticulation );
-        pScene->unlockWrite();
+        pPhysicsScene->ReleaseWriteLock();
     }
 
     //-------------------------------------------------------------------------
@@ -1314,7 +1318,7 @@ namespace KRG::Physics
     {
         if ( auto pScene = m_pArticulation->getScene() )
         {
-            pScene->lockWrite();
+            Scene::FromPx( pScene )->AcquireWriteLock();
         }
     }
 
@@ -1322,7 +1326,7 @@ namespace KRG::Physics
     {
         if ( auto pScene = m_pArticulation->getScene() )
         {
-            pScene->unlockWrite();
+            Scene::FromPx( pScene )->ReleaseWriteLock();
         }
     }
 
@@ -1,5 +1,10 @@
 #include "PhysicsScene.h"
 #include "PhysicsRagdoll.h"
+#include "PhysicsSystem.h"
+#include "PhysicsLayers.h"
+#include "Systems/WorldSystem_Physics.h"
+#include "System/Math/MathRandom.h"
+#include "System/Time/Timers.h"
 
 #include <PxScene.h>
 
@@ -15,14 +20,31 @@ namespace KRG::Physics
         : m_pScene( pScene )
     {
         KRG_ASSERT( pScene != nullptr );
+        m_pScene->userData = this;
     }
 
     Scene::~Scene()
     {
+        #if KRG_DEVELOPMENT_TOOLS
+        AcquireWriteLock();
+        for ( auto pActor : m_staticTestActors )
+        {
+            pActor->release();
+        }
+        m_staticTestActors.clear();
+        ReleaseWriteLock();
+        #endif
+
         m_pScene->release();
         m_pScene = nullptr;
     }
 
+    Scene* Scene::FromPx( physx::PxScene* pPxScene )
+    {
+        KRG_ASSERT( pPxScene != nullptr && pPxScene->userData != nullptr );
+        return reinterpret_cast<Scene*>( pPxScene->userData );
+    }
+
     Ragdoll* Scene::CreateRagdoll( RagdollDefinition const* pDefinition, StringID const& profileID, uint64_t userID )
     {
         KRG_ASSERT( m_pScene != nullptr && pDefinition != nullptr );
@@ -31,6 +53,33 @@ namespace KRG::Physics
         return pRagdoll;
     }
 
+    #if KRG_DEVELOPMENT_TOOLS
+    void Scene::AddStaticTestBox( Transform const& worldTransform, Vector const& halfExtents, uint32_t layerMask )
+    {
+        KRG_ASSERT( m_pScene != nullptr );
+        KRG_ASSERT( halfExtents.m_x > 0 && halfExtents.m_y > 0 && halfExtents.m_z > 0 );
+
+        PxPhysics& physics = m_pScene->getPhysics();
+        PxMaterial* pMaterial = physics.createMaterial( 0.5f, 0.5f, 0.0f );
+
+        PxShape* pShape = physics.createShape( PxBoxGeometry( ToPx( halfExtents ) ), *pMaterial, true );
+        pShape->setQueryFilterData( PxFilterData( layerMask, 0, 0, 0 ) );
+
+        PxRigidStatic* pActor = physics.createRigidStatic( ToPx( worldTransform ) );
+        pActor->attachShape( *pShape );
+
+        // The actor holds references to the shape and material
+        pShape->release();
+        pMaterial->release();
+
+        AcquireWriteLock();
+        m_pScene->addActor( *pActor );
+        ReleaseWriteLock();
+
+        m_staticTestActors.emplace_back( pActor );
+    }
+    #endif
+
     //-------------------------------------------------------------------------
 
     void Scene::AcquireReadLock()
@@ -47,6 +96,12 @@ namespace KRG::Physics
 
     void Scene::AcquireWriteLock()
     {
+        // Scene modifications are not allowed while simulating
+        if ( m_pWorldSystem != nullptr )
+        {
+            m_pWorldSystem->FetchSimulationResults();
+        }
+
         m_pScene->lockWrite();
         KRG_DEVELOPMENT_TOOLS_ONLY( m_writeLockAcquired = true );
     }
@@ -56,4 +111,238 @@ namespace KRG::Physics
         m_pScene->unlockWrite();
         KRG_DEVELOPMENT_TOOLS_ONLY( m_writeLockAcquired = false );
     }
-}
\ No newline at end of file
+}
+
+//-------------------------------------------------------------------------
+
+#if KRG_DEVELOPMENT_TOOLS
+namespace KRG::Physics
+{
+    namespace
+    {
+        template<typename HitType>
+        static bool AreHitsEqual( HitType const& a, HitType const& b )
+        {
+            return a.actor == b.actor && a.shape == b.shape && memcmp( &a.position, &b.position, sizeof( PxVec3 ) ) == 0 && memcmp( &a.distance, &b.distance, sizeof( float ) ) == 0;
+        }
+
+        template<typename HitType>
+        static bool AreResultsEqual( PxHitBuffer<HitType> const& a, PxHitBuffer<HitType> const& b )
+        {
+            if ( a.hasBlock != b.hasBlock || a.nbTouches != b.nbTouches )
+            {
+                return false;
+            }
+
+            if ( a.hasBlock && !AreHitsEqual( a.block, b.block ) )
+            {
+                return false;
+            }
+
+            for ( uint32_t i = 0; i < a.nbTouches; i++ )
+            {
+                if ( !AreHitsEqual( a.touches[i], b.touches[i] ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // Overlap hits have no position or distance
+        static bool AreResultsEqual( PxHitBuffer<PxOverlapHit> const& a, PxHitBuffer<PxOverlapHit> const& b )
+        {
+            if ( a.hasBlock != b.hasBlock || a.nbTouches != b.nbTouches )
+            {
+                return false;
+            }
+
+            for ( uint32_t i = 0; i < a.nbTouches; i++ )
+            {
+                if ( a.touches[i].actor != b.touches[i].actor || a.touches[i].shape != b.touches[i].shape )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    BatchQueryTestResult RunBatchQueryTest( PhysicsSystem& physicsSystem, TaskSystem* pTaskSystem, uint32_t numRequests, uint32_t seed )
+    {
+        static constexpr float const s_groundHalfExtent = 25.0f;
+        static constexpr uint32_t const s_numBoxes = 128;
+        static constexpr int32_t const s_maxHits = 8;
+
+        BatchQueryTestResult result;
+        result.m_numRequests = numRequests;
+
+        Math::RNG rng( seed );
+        uint32_t const environmentLayerMask = CreateLayerMask( Layers::Environment );
+
+        // Create the environment: a ground box and a set of random boxes on top of it
+        //-------------------------------------------------------------------------
+
+        Scene* pScene = physicsSystem.CreateScene();
+        pScene->AddStaticTestBox( Transform( Quaternion::Identity, Vector( 0, 0, -0.5f ) ), Vector( s_groundHalfExtent, s_groundHalfExtent, 0.5f ), environmentLayerMask );
+
+        for ( uint32_t i = 0; i < s_numBoxes; i++ )
+        {
+            Vector const position( rng.GetFloat( -s_groundHalfExtent, s_groundHalfExtent ), rng.GetFloat( -s_groundHalfExtent, s_groundHalfExtent ), rng.GetFloat( 0.0f, 4.0f ) );
+            Vector const halfExtents( rng.GetFloat( 0.25f, 2.0f ), rng.GetFloat( 0.25f, 2.0f ), rng.GetFloat( 0.25f, 2.0f ) );
+            Quaternion const orientation( EulerAngles( 0.0f, 0.0f, rng.GetFloat( 0.0f, 360.0f ) ) );
+            pScene->AddStaticTestBox( Transform( orientation, position ), halfExtents, environmentLayerMask );
+        }
+
+        // Create the requests, roughly one in sixteen ray casts and sweeps is zero-length
+        //-------------------------------------------------------------------------
+
+        auto GetRandomPosition = [&rng] ()
+        {
+            return Vector( rng.GetFloat( -s_groundHalfExtent, s_groundHalfExtent ), rng.GetFloat( -s_groundHalfExtent, s_groundHalfExtent ), rng.GetFloat( 0.0f, 6.0f ) );
+        };
+
+        auto GetRandomShape = [&rng] ()
+        {
+            switch ( rng.GetUInt( 0, 3 ) )
+            {
+                case 0: return QueryShape::Sphere( rng.GetFloat( 0.1f, 1.0f ) );
+                case 1: return QueryShape::Capsule( rng.GetFloat( 0.1f, 1.0f ), rng.GetFloat( 0.1f, 0.5f ) );
+                case 2: return QueryShape::Cylinder( rng.GetFloat( 0.1f, 1.0f ), rng.GetFloat( 0.1f, 0.5f ) );
+                default: return QueryShape::Box( Float3( rng.GetFloat( 0.1f, 1.0f ), rng.GetFloat( 0.1f, 1.0f ), rng.GetFloat( 0.1f, 1.0f ) ) );
+            }
+        };
+
+        QueryFilter filter( environmentLayerMask );
+
+        TVector<RayCastRequest> rayCastRequests( numRequests );
+        TVector<SweepRequest> sweepRequests( numRequests );
+        TVector<OverlapRequest> overlapRequests( numRequests );
+
+        for ( uint32_t i = 0; i < numRequests; i++ )
+        {
+            rayCastRequests[i].m_start = GetRandomPosition();
+            rayCastRequests[i].m_end = ( rng.GetUInt( 0, 15 ) == 0 ) ? rayCastRequests[i].m_start : GetRandomPosition();
+            rayCastRequests[i].m_pFilter = &filter;
+
+            sweepRequests[i].m_shape = GetRandomShape();
+            sweepRequests[i].m_orientation = Quaternion( EulerAngles( rng.GetFloat( 0.0f, 360.0f ), rng.GetFloat( 0.0f, 360.0f ), rng.GetFloat( 0.0f, 360.0f ) ) );
+            sweepRequests[i].m_start = GetRandomPosition();
+            sweepRequests[i].m_end = ( rng.GetUInt( 0, 15 ) == 0 ) ? sweepRequests[i].m_start : GetRandomPosition();
+            sweepRequests[i].m_pFilter = &filter;
+
+            overlapRequests[i].m_shape = GetRandomShape();
+            overlapRequests[i].m_orientation = Quaternion( EulerAngles( rng.GetFloat( 0.0f, 360.0f ), rng.GetFloat( 0.0f, 360.0f ), rng.GetFloat( 0.0f, 360.0f ) ) );
+            overlapRequests[i].m_position = GetRandomPosition();
+            overlapRequests[i].m_pFilter = &filter;
+        }
+
+        // The result buffers point into themselves, so we size them once and never move them
+        TVector<RayCastResultBuffer<s_maxHits>> singleRayCastResults( numRequests ), batchedRayCastResults( numRequests );
+        TVector<SweepResultBuffer<s_maxHits>> singleSweepResults( numRequests ), batchedSweepResults( numRequests );
+        TVector<OverlapResultBuffer<s_maxHits>> singleOverlapResults( numRequests ), batchedOverlapResults( numRequests );
+
+        // Single queries
+        //-------------------------------------------------------------------------
+        // The single ray casts and sweeps dont allow zero-length queries, the batch needs to return no hits for them
+
+        pScene->AcquireReadLock();
+
+        Timer<PlatformClock> timer;
+        for ( uint32_t i = 0; i < numRequests; i++ )
+        {
+            RayCastRequest const& rayCastRequest = rayCastRequests[i];
+            if ( !( rayCastRequest.m_end - rayCastRequest.m_start ).IsNearZero3() )
+            {
+                pScene->RayCast( rayCastRequest.m_start, rayCastRequest.m_end, filter, singleRayCastResults[i] );
+            }
+
+            SweepRequest const& sweepRequest = sweepRequests[i];
+            if ( !( sweepRequest.m_end - sweepRequest.m_start ).IsNearZero3() )
+            {
+                switch ( sweepRequest.m_shape.m_type )
+                {
+                    case QueryShape::Type::Sphere:
+                    pScene->SphereSweep( sweepRequest.m_shape.GetRadius(), sweepRequest.m_start, sweepRequest.m_end, filter, singleSweepResults[i] );
+                    break;
+
+                    case QueryShape::Type::Capsule:
+                    pScene->CapsuleSweep( sweepRequest.m_shape.GetHalfHeight(), sweepRequest.m_shape.GetRadius(), sweepRequest.m_orientation, sweepRequest.m_start, sweepRequest.m_end, filter, singleSweepResults[i] );
+                    break;
+
+                    case QueryShape::Type::Cylinder:
+                    pScene->CylinderSweep( sweepRequest.m_shape.GetHalfHeight(), sweepRequest.m_shape.GetRadius(), sweepRequest.m_orientation, sweepRequest.m_start, sweepRequest.m_end, filter, singleSweepResults[i] );
+                    break;
+
+                    case QueryShape::Type::Box:
+                    pScene->BoxSweep( sweepRequest.m_shape.GetHalfExtents(), sweepRequest.m_orientation, sweepRequest.m_start, sweepRequest.m_end, filter, singleSweepResults[i] );
+                    break;
+                }
+            }
+
+            OverlapRequest const& overlapRequest = overlapRequests[i];
+            switch ( overlapRequest.m_shape.m_type )
+            {
+                case QueryShape::Type::Sphere:
+                pScene->SphereOverlap( overlapRequest.m_shape.GetRadius(), overlapRequest.m_position, filter, singleOverlapResults[i] );
+                break;
+
+                case QueryShape::Type::Capsule:
+                pScene->CapsuleOverlap( overlapRequest.m_shape.GetHalfHeight(), overlapRequest.m_shape.GetRadius(), overlapRequest.m_orientation, overlapRequest.m_position, filter, singleOverlapResults[i] );
+                break;
+
+                case QueryShape::Type::Cylinder:
+                pScene->CylinderOverlap( overlapRequest.m_shape.GetHalfHeight(), overlapRequest.m_shape.GetRadius(), overlapRequest.m_orientation, overlapRequest.m_position, filter, singleOverlapResults[i] );
+                break;
+
+                case QueryShape::Type::Box:
+                pScene->BoxOverlap( overlapRequest.m_shape.GetHalfExtents(), overlapRequest.m_orientation, overlapRequest.m_position, filter, singleOverlapResults[i] );
+                break;
+            }
+        }
+        result.m_singleTime = timer.GetElapsedTimeMilliseconds();
+
+        pScene->ReleaseReadLock();
+
+        // Batched queries
+        //-------------------------------------------------------------------------
+        // The batches acquire their own read locks
+
+        timer.Start();
+        pScene->RayCastBatch( pTaskSystem, rayCastRequests.data(), numRequests, batchedRayCastResults.data() );
+        pScene->SweepBatch( pTaskSystem, sweepRequests.data(), numRequests, batchedSweepResults.data() );
+        pScene->OverlapBatch( pTaskSystem, overlapRequests.data(), numRequests, batchedOverlapResults.data() );
+        result.m_batchedTime = timer.GetElapsedTimeMilliseconds();
+
+        // Compare
+        //-------------------------------------------------------------------------
+
+        for ( uint32_t i = 0; i < numRequests; i++ )
+        {
+            if ( !AreResultsEqual( singleRayCastResults[i], batchedRayCastResults[i] ) )
+            {
+                result.m_numMismatches++;
+            }
+
+            if ( !AreResultsEqual( singleSweepResults[i], batchedSweepResults[i] ) )
+            {
+                result.m_numMismatches++;
+            }
+
+            if ( !AreResultsEqual( singleOverlapResults[i], batchedOverlapResults[i] ) )
+            {
+                result.m_numMismatches++;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        KRG::Delete( pScene );
+        return result;
+    }
+}
+#endif
\ No newline at end of file
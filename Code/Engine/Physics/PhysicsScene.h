@@ -3,6 +3,9 @@
 #include "Engine/_Module/API.h"
 #include "Engine/Physics/PhysicsQuery.h"
 #include "Engine/Physics/PhysX.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Time/Time.h"
+#include "System/Profiling.h"
 #include <atomic>
 
 //-------------------------------------------------------------------------
@@ -18,6 +21,8 @@ namespace KRG::Physics
 {
     class Ragdoll;
     struct RagdollDefinition;
+    class PhysicsSystem;
+    class PhysicsWorldSystem;
 
     //-------------------------------------------------------------------------
 
@@ -30,13 +35,22 @@ namespace KRG::Physics
         // The distance that the shape is pushed away from a detected collision after a sweep - currently set to 5mm as that is a relatively standard value
         static constexpr float const s_sweepSeperationDistance = 0.005f;
 
+        // The min number of queries per batch task, batches smaller than this are run directly on the calling thread
+        static constexpr uint32_t const s_minBatchQueryTaskSize = 16;
+
     public:
 
         Scene( physx::PxScene* pScene );
         ~Scene();
 
+        // Get the scene for a physx scene, i.e. the scene that an actor belongs to
+        static Scene* FromPx( physx::PxScene* pPxScene );
+
         // Locks
         //-------------------------------------------------------------------------
+        // The physics world system can leave a simulation step running in the background and the scene must not be modified while it runs
+        // Acquiring the write lock completes any running step first, so all scene modifications need to go through the write lock
+        // Never acquire the write lock on a thread that is holding the read lock
 
         void AcquireReadLock();
         void ReleaseReadLock();
@@ -48,6 +62,15 @@ namespace KRG::Physics
 
         Ragdoll* CreateRagdoll( RagdollDefinition const* pDefinition, StringID const& profileID, uint64_t userID );
 
+        // Test Environment
+        //-------------------------------------------------------------------------
+        // Adds a static box that isnt owned by any component, this is only meant for building headless test scenes (no entity world required)
+        // The actor is released with the scene, since it has no owning component, dont query against it with ignored component/entity filters
+
+        #if KRG_DEVELOPMENT_TOOLS
+        void AddStaticTestBox( Transform const& worldTransform, Vector const& halfExtents, uint32_t layerMask );
+        #endif
+
         // Queries
         //-------------------------------------------------------------------------
         // The  versions of the queries allow you to provide your own result container, generally only useful if you hit the 32 hit limit the default results provides
@@ -355,6 +378,193 @@ namespace KRG::Physics
             return result;
         }
 
+        // Batched Queries
+        //-------------------------------------------------------------------------
+        // Runs all the requests in parallel across the task system and blocks until they are complete (if no task system is provided, the batch is run inline)
+        // Results are written into the caller-owned results array (which needs to be at least as large as the request array), at the same index as the request
+        // Zero-length ray casts and sweeps are valid in a batch and will return no hits
+        // Unlike the single queries, each batch task acquires (and releases) its own read lock, since PhysX read locks are per thread
+        // WARNING!!! The caller must NOT hold a read lock when running a batch: if a writer is waiting on the lock, the workers' read locks will block until
+        // the caller's lock is released, which only happens once the batch completes i.e. a deadlock
+
+        template<int N>
+        void RayCastBatch( TaskSystem* pTaskSystem, RayCastRequest const* pRequests, uint32_t numRequests, RayCastResultBuffer<N>* pOutResults )
+        {
+            KRG_ASSERT( numRequests == 0 || ( pRequests != nullptr && pOutResults != nullptr ) );
+
+            ExecuteBatch( pTaskSystem, numRequests, [this, pRequests, pOutResults] ( uint32_t i )
+            {
+                RayCastRequest const& request = pRequests[i];
+                KRG_ASSERT( request.m_pFilter != nullptr );
+
+                if ( ( request.m_end - request.m_start ).IsNearZero3() )
+                {
+                    RayCastResultBuffer<N>& outResults = pOutResults[i];
+                    outResults.m_start = outResults.m_end = request.m_start;
+                    outResults.hasBlock = false;
+                    outResults.nbTouches = 0;
+                    return;
+                }
+
+                RayCast( request.m_start, request.m_end, *request.m_pFilter, pOutResults[i] );
+            } );
+        }
+
+        template<int N>
+        void SweepBatch( TaskSystem* pTaskSystem, SweepRequest const* pRequests, uint32_t numRequests, SweepResultBuffer<N>* pOutResults )
+        {
+            KRG_ASSERT( numRequests == 0 || ( pRequests != nullptr && pOutResults != nullptr ) );
+
+            ExecuteBatch( pTaskSystem, numRequests, [this, pRequests, pOutResults] ( uint32_t i )
+            {
+                SweepRequest const& request = pRequests[i];
+                KRG_ASSERT( request.m_pFilter != nullptr );
+
+                // The single sweeps require a valid direction, so we handle zero-length sweeps here
+                if ( ( request.m_end - request.m_start ).IsNearZero3() )
+                {
+                    SweepResultBuffer<N>& outResults = pOutResults[i];
+                    outResults.m_sweepStart = outResults.m_sweepEnd = request.m_start;
+                    outResults.m_orientation = request.m_orientation;
+                    outResults.hasBlock = false;
+                    outResults.nbTouches = 0;
+                    outResults.CalculateFinalShapePosition( s_sweepSeperationDistance );
+                    return;
+                }
+
+                switch ( request.m_shape.m_type )
+                {
+                    case QueryShape::Type::Sphere:
+                    SphereSweep( request.m_shape.GetRadius(), request.m_start, request.m_end, *request.m_pFilter, pOutResults[i] );
+                    break;
+
+                    case QueryShape::Type::Capsule:
+                    CapsuleSweep( request.m_shape.GetHalfHeight(), request.m_shape.GetRadius(), request.m_orientation, request.m_start, request.m_end, *request.m_pFilter, pOutResults[i] );
+                    break;
+
+                    case QueryShape::Type::Cylinder:
+                    CylinderSweep( request.m_shape.GetHalfHeight(), request.m_shape.GetRadius(), request.m_orientation, request.m_start, request.m_end, *request.m_pFilter, pOutResults[i] );
+                    break;
+
+                    case QueryShape::Type::Box:
+                    BoxSweep( request.m_shape.GetHalfExtents(), request.m_orientation, request.m_start, request.m_end, *request.m_pFilter, pOutResults[i] );
+                    break;
+                }
+            } );
+        }
+
+        // Note: Overlap results will never have the block hit set!
+        template<int N>
+        void OverlapBatch( TaskSystem* pTaskSystem, OverlapRequest const* pRequests, uint32_t numRequests, OverlapResultBuffer<N>* pOutResults )
+        {
+            KRG_ASSERT( numRequests == 0 || ( pRequests != nullptr && pOutResults != nullptr ) );
+
+            ExecuteBatch( pTaskSystem, numRequests, [this, pRequests, pOutResults] ( uint32_t i )
+            {
+                OverlapRequest const& request = pRequests[i];
+                KRG_ASSERT( request.m_pFilter != nullptr );
+
+                OverlapResultBuffer<N>& outResults = pOutResults[i];
+                outResults.m_position = request.m_position;
+                outResults.m_orientation = request.m_orientation;
+
+                // The single overlap queries temporarily modify the filter, which isnt safe when the filter is shared across threads, so we set the no block value on a copy
+                physx::PxQueryFilterData filterData = request.m_pFilter->m_filterData;
+                filterData.flags |= physx::PxQueryFlag::eNO_BLOCK;
+
+                physx::PxTransform const pose( ToPx( request.m_position ), ToPx( request.m_orientation ) );
+
+                switch ( request.m_shape.m_type )
+                {
+                    case QueryShape::Type::Sphere:
+                    {
+                        physx::PxSphereGeometry const sphereGeo( request.m_shape.GetRadius() );
+                        m_pScene->overlap( sphereGeo, pose, outResults, filterData, request.m_pFilter );
+                    }
+                    break;
+
+                    case QueryShape::Type::Capsule:
+                    {
+                        physx::PxCapsuleGeometry const capsuleGeo( request.m_shape.GetRadius(), request.m_shape.GetHalfHeight() );
+                        m_pScene->overlap( capsuleGeo, pose, outResults, filterData, request.m_pFilter );
+                    }
+                    break;
+
+                    case QueryShape::Type::Cylinder:
+                    {
+                        float const halfHeight = request.m_shape.GetHalfHeight();
+                        float const radius = request.m_shape.GetRadius();
+                        physx::PxConvexMeshGeometry const cylinderGeo( SharedMeshes::s_pUnitCylinderMesh, physx::PxMeshScale( physx::PxVec3( 2.0f * halfHeight, 2.0f * radius, 2.0f * radius ) ) );
+                        m_pScene->overlap( cylinderGeo, pose, outResults, filterData, request.m_pFilter );
+                    }
+                    break;
+
+                    case QueryShape::Type::Box:
+                    {
+                        physx::PxBoxGeometry const boxGeo( ToPx( request.m_shape.GetHalfExtents() ) );
+                        m_pScene->overlap( boxGeo, pose, outResults, filterData, request.m_pFilter );
+                    }
+                    break;
+                }
+            } );
+        }
+
+    private:
+
+        // Run the supplied query function for each index in [0, numRequests) across the task system
+        // Each task range is run under its own read lock, see the batched query functions
+        template<typename QueryFunction>
+        void ExecuteBatch( TaskSystem* pTaskSystem, uint32_t numRequests, QueryFunction const& queryFunction )
+        {
+            struct BatchQueryTask : public ITaskSet
+            {
+                BatchQueryTask( Scene* pScene, uint32_t numRequests, QueryFunction const& queryFunction )
+                    : m_pScene( pScene )
+                    , m_queryFunction( queryFunction )
+                {
+                    m_SetSize = numRequests;
+                    m_MinRange = s_minBatchQueryTaskSize;
+                }
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    KRG_PROFILE_SCOPE_PHYSICS( "Batched Scene Query Task" );
+
+                    m_pScene->AcquireReadLock();
+                    for ( uint32_t i = range.start; i < range.end; i++ )
+                    {
+                        m_queryFunction( i );
+                    }
+                    m_pScene->ReleaseReadLock();
+                }
+
+            private:
+
+                Scene*                      m_pScene = nullptr;
+                QueryFunction const&        m_queryFunction;
+            };
+
+            //-------------------------------------------------------------------------
+
+            KRG_PROFILE_SCOPE_PHYSICS( "Batched Scene Query" );
+
+            if ( pTaskSystem == nullptr || numRequests < s_minBatchQueryTaskSize )
+            {
+                AcquireReadLock();
+                for ( uint32_t i = 0; i < numRequests; i++ )
+                {
+                    queryFunction( i );
+                }
+                ReleaseReadLock();
+            }
+            else
+            {
+                BatchQueryTask batchTask( this, numRequests, queryFunction );
+                pTaskSystem->ScheduleTask( &batchTask );
+                pTaskSystem->WaitForTask( &batchTask );
+            }
+        }
+
     private:
 
         Scene( Scene const& ) = delete;
@@ -365,10 +575,33 @@ namespace KRG::Physics
     private:
 
         physx::PxScene*                                         m_pScene = nullptr;
+        PhysicsWorldSystem*                                     m_pWorldSystem = nullptr;       // The world system that runs the simulation (if any)
 
         #if KRG_DEVELOPMENT_TOOLS
+        TVector<physx::PxRigidStatic*>                          m_staticTestActors;
         std::atomic<int32_t>                                    m_readLockCount = false;        // Assertion helper
         std::atomic<bool>                                       m_writeLockAcquired = false;    // Assertion helper
         #endif
     };
+
+    // Headless Batch Query Test
+    //-------------------------------------------------------------------------
+    // Builds a standalone physics scene (ground plus random boxes) and runs a set of random ray casts, sweeps and overlaps (including zero-length ones)
+    // Each set is run as single queries and as a batch across the task system, and all results need to match bitwise for the test to pass
+
+    #if KRG_DEVELOPMENT_TOOLS
+    struct BatchQueryTestResult
+    {
+        inline bool WasSuccessful() const { return m_numMismatches == 0; }
+
+    public:
+
+        uint32_t                                                m_numRequests = 0;
+        uint32_t                                                m_numMismatches = 0;
+        Milliseconds                                            m_singleTime = 0.0f;
+        Milliseconds                                            m_batchedTime = 0.0f;
+    };
+
+    KRG_ENGINE_API BatchQueryTestResult RunBatchQueryTest( PhysicsSystem& physicsSystem, TaskSystem* pTaskSystem, uint32_t numRequests, uint32_t seed );
+    #endif
 }
\ No newline at end of file
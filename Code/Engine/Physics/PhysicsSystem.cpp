@@ -156,7 +156,7 @@ namespace KRG::Physics
         sceneDesc.cpuDispatcher = m_pDispatcher;
         sceneDesc.filterShader = SimulationFilter::Shader;
         sceneDesc.filterCallback = m_pSimulationFilterCallback;
-        sceneDesc.flags = PxSceneFlag::eENABLE_CCD | PxSceneFlag::eREQUIRE_RW_LOCK;
+        sceneDesc.flags = PxSceneFlag::eENABLE_CCD | PxSceneFlag::eREQUIRE_RW_LOCK | PxSceneFlag::eENABLE_ACTIVE_ACTORS;
         auto pPxScene = m_pPhysics->createScene( sceneDesc );
 
         #if KRG_DEVELOPMENT_TOOLS
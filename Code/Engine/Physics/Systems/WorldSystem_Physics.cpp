@@ -9,9 +9,11 @@
 #include "Engine/Physics/PhysX.h"
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Engine/RuntimeSettings/RuntimeSettings.h"
 #include "System/Math/BoundingVolumes.h"
 #include "System/Profiling.h"
 #include "System/Drawing/DebugDrawing.h"
+#include "System/Time/Timers.h"
 
 //-------------------------------------------------------------------------
 
@@ -21,6 +23,13 @@ using namespace physx;
 
 namespace KRG::Physics
 {
+    static RuntimeSettingBool g_useFixedTimeStep( "FixedTimeStep", "Physics", "Simulate with a fixed time step and interpolate the dynamic actor transforms", true );
+    static RuntimeSettingInt g_fixedTimeStepFrequency( "FixedTimeStepFrequency", "Physics", "The number of fixed simulation steps per second", 60, 10, 240 );
+    static RuntimeSettingInt g_maxSimulationSubsteps( "MaxSimulationSubsteps", "Physics", "The max number of fixed steps per frame, any time beyond that is dropped", 4, 1, 16 );
+    static RuntimeSettingBool g_overlapPhysicsSimulation( "OverlapSimulation", "Physics", "Let the last fixed step run in the background until the next physics update", true );
+
+    //-------------------------------------------------------------------------
+
     static inline PxBoxGeometry CreateBoxGeometry( Vector const& scale, Vector const& extents, OBB* pLocalBounds = nullptr )
     {
         KRG_ASSERT( !scale.GetWithW1().IsAnyEqualsZero());
@@ -96,6 +105,7 @@ namespace KRG::Physics
 
         m_pScene = m_pPhysicsSystem->CreateScene();
         KRG_ASSERT( m_pScene != nullptr );
+        m_pScene->m_pWorldSystem = this;
 
         #if KRG_DEVELOPMENT_TOOLS
         SetDebugFlags( 1 << PxVisualizationParameter::eCOLLISION_SHAPES );
@@ -104,7 +114,10 @@ namespace KRG::Physics
 
     void PhysicsWorldSystem::ShutdownSystem()
     {
+        CompleteSimulationStep();
+
         // Destroy scene
+        m_pScene->m_pWorldSystem = nullptr;
         KRG::Delete( m_pScene );
         m_pPhysicsSystem = nullptr;
 
@@ -148,6 +161,14 @@ namespace KRG::Physics
 
     void PhysicsWorldSystem::UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent )
     {
+        // Never release actors while the scene is simulating
+        if ( TryCast<PhysicsShapeComponent>( pComponent ) != nullptr || TryCast<CharacterComponent>( pComponent ) != nullptr )
+        {
+            CompleteSimulationStep();
+        }
+
+        //-------------------------------------------------------------------------
+
         if ( auto pPhysicsComponent = TryCast<PhysicsShapeComponent>( pComponent ) )
         {
             if ( pPhysicsComponent->m_pPhysicsActor != nullptr && pPhysicsComponent->m_actorType != ActorType::Static )
@@ -156,6 +177,13 @@ namespace KRG::Physics
             }
 
             m_staticActorShapeUpdateList.erase_first_unsorted( pPhysicsComponent );
+
+            if ( pPhysicsComponent->m_isInActiveActorList )
+            {
+                m_activeDynamicComponents.erase_first_unsorted( pPhysicsComponent );
+                pPhysicsComponent->m_isInActiveActorList = false;
+                pPhysicsComponent->m_isActivePhysicsActor = false;
+            }
             m_physicsShapeComponents.Remove( pComponent->GetID() );
 
             DestroyActor( pPhysicsComponent );
@@ -198,11 +226,10 @@ namespace KRG::Physics
             return false;
         }
 
-        // Add actor to scene
-        PxScene* pPxScene = m_pScene->m_pScene;
-        pPxScene->lockWrite();
-        pPxScene->addActor( *pPhysicsActor );
-        pPxScene->unlockWrite();
+        // Add actor to scene - this will complete any running simulation step
+        m_pScene->AcquireWriteLock();
+        m_pScene->m_pScene->addActor( *pPhysicsActor );
+        m_pScene->ReleaseWriteLock();
         return true;
     }
 
@@ -231,6 +258,7 @@ namespace KRG::Physics
             case ActorType::Dynamic:
             {
                 pPhysicsActor = pPhysics->createRigidDynamic( actorPose );
+                pComponent->m_previousPhysicsPose = pComponent->m_currentPhysicsPose = FromPx( actorPose );
             }
             break;
 
@@ -451,12 +479,11 @@ namespace KRG::Physics
 
     void PhysicsWorldSystem::DestroyActor( PhysicsShapeComponent* pComponent ) const
     {
-        PxScene* pPxScene = m_pScene->m_pScene;
         if ( pComponent->m_pPhysicsActor != nullptr )
         {
-            pPxScene->lockWrite();
-            pPxScene->removeActor( *pComponent->m_pPhysicsActor );
-            pPxScene->unlockWrite();
+            m_pScene->AcquireWriteLock();
+            m_pScene->m_pScene->removeActor( *pComponent->m_pPhysicsActor );
+            m_pScene->ReleaseWriteLock();
 
             pComponent->m_pPhysicsActor->release();
         }
@@ -530,24 +557,22 @@ namespace KRG::Physics
         OBB const localBounds( Vector::Origin, Vector( pComponent->m_cylinderPortionHalfHeight + pComponent->m_radius, pComponent->m_radius, pComponent->m_radius ) );
         pComponent->SetLocalBounds( localBounds );
 
-        // Add to scene
+        // Add to scene - this will complete any running simulation step
         //-------------------------------------------------------------------------
 
-        PxScene* pPxScene = m_pScene->m_pScene;
-        pPxScene->lockWrite();
-        pPxScene->addActor( *pComponent->m_pPhysicsActor );
-        pPxScene->unlockWrite();
+        m_pScene->AcquireWriteLock();
+        m_pScene->m_pScene->addActor( *pComponent->m_pPhysicsActor );
+        m_pScene->ReleaseWriteLock();
         return true;
     }
 
     void PhysicsWorldSystem::DestroyCharacterActor( CharacterComponent* pComponent ) const
     {
-        PxScene* pPxScene = m_pScene->m_pScene;
         if ( pComponent->m_pPhysicsActor != nullptr )
         {
-            pPxScene->lockWrite();
-            pPxScene->removeActor( *pComponent->m_pPhysicsActor );
-            pPxScene->unlockWrite();
+            m_pScene->AcquireWriteLock();
+            m_pScene->m_pScene->removeActor( *pComponent->m_pPhysicsActor );
+            m_pScene->ReleaseWriteLock();
 
             pComponent->m_pPhysicsActor->release();
         }
@@ -581,17 +606,139 @@ namespace KRG::Physics
 
     //-------------------------------------------------------------------------
     
-    void PhysicsWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    void PhysicsWorldSystem::StartSimulationStep( float stepTime )
     {
-        PxScene* pPxScene = m_pScene->m_pScene;
+        KRG_ASSERT( !m_isSimulationRunning && !m_isPoseReadbackPending && stepTime > 0.0f );
+        KRG_PROFILE_SCOPE_PHYSICS( "Simulate" );
+
+        GetPxScene()->lockWrite();
+        GetPxScene()->simulate( stepTime );
+        GetPxScene()->unlockWrite();
+
+        m_isSimulationRunning = true;
+        KRG_DEVELOPMENT_TOOLS_ONLY( m_numSimulationStepsLastFrame++ );
+    }
+
+    void PhysicsWorldSystem::FetchSimulationResults()
+    {
+        if ( !m_isSimulationRunning )
+        {
+            return;
+        }
+
+        // Any thread that modifies the scene can get here, only the first one fetches the results
+        Threading::ScopeLock lock( m_simulationMutex );
+        if ( !m_isSimulationRunning )
+        {
+            return;
+        }
+
+        {
+            KRG_PROFILE_SCOPE_PHYSICS( "Fetch Results" );
+
+            #if KRG_DEVELOPMENT_TOOLS
+            Nanoseconds const waitStartTime = PlatformClock::GetTime();
+            #endif
 
+            // We cant use the scene's write lock here since acquiring it fetches the simulation results
+            GetPxScene()->lockWrite();
+            GetPxScene()->fetchResults( true );
+            GetPxScene()->unlockWrite();
+
+            #if KRG_DEVELOPMENT_TOOLS
+            Milliseconds const waitTime = ( PlatformClock::GetTime() - waitStartTime ).ToMilliseconds();
+            m_simulationWaitTimeLastFrame += waitTime;
+            if ( !m_isInPhysicsUpdate )
+            {
+                m_outOfUpdateWaitTime += waitTime;
+            }
+            #endif
+        }
+
+        m_isPoseReadbackPending = true;
+        m_isSimulationRunning = false;
+    }
+
+    void PhysicsWorldSystem::CompleteSimulationStep()
+    {
+        FetchSimulationResults();
+
+        if ( m_isPoseReadbackPending )
+        {
+            ReadBackActiveActorPoses();
+            m_isPoseReadbackPending = false;
+        }
+    }
+
+    void PhysicsWorldSystem::ReadBackActiveActorPoses()
+    {
+        KRG_PROFILE_SCOPE_PHYSICS( "Read Back Active Actor Poses" );
+
+        // Components that moved during the previous step are considered at rest unless they show up in the active list again
+        for ( auto pComponent : m_activeDynamicComponents )
+        {
+            pComponent->m_previousPhysicsPose = pComponent->m_currentPhysicsPose;
+            pComponent->m_isActivePhysicsActor = false;
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_pScene->AcquireReadLock();
+
+        uint32_t numActiveActors = 0;
+        PxActor** ppActiveActors = GetPxScene()->getActiveActors( numActiveActors );
+        for ( uint32_t i = 0; i < numActiveActors; i++ )
+        {
+            // Only simulated rigid bodies need to be read back, kinematic actors (characters, ragdoll targets) and articulation links are driven elsewhere
+            PxRigidDynamic* pRigidDynamicActor = ppActiveActors[i]->is<PxRigidDynamic>();
+            if ( pRigidDynamicActor == nullptr || pRigidDynamicActor->userData == nullptr || pRigidDynamicActor->getRigidBodyFlags().isSet( PxRigidBodyFlag::eKINEMATIC ) )
+            {
+                continue;
+            }
+
+            auto pComponent = reinterpret_cast<PhysicsShapeComponent*>( pRigidDynamicActor->userData );
+            KRG_ASSERT( pComponent->m_actorType == ActorType::Dynamic );
+
+            if ( !pComponent->m_isInActiveActorList )
+            {
+                pComponent->m_previousPhysicsPose = pComponent->m_currentPhysicsPose;
+                pComponent->m_isInActiveActorList = true;
+                m_activeDynamicComponents.emplace_back( pComponent );
+            }
+
+            pComponent->m_currentPhysicsPose = FromPx( pRigidDynamicActor->getGlobalPose() );
+            pComponent->m_isActivePhysicsActor = true;
+        }
+
+        m_pScene->ReleaseReadLock();
+
+        KRG_DEVELOPMENT_TOOLS_ONLY( m_numActiveActorsLastStep = numActiveActors );
+    }
+
+    //-------------------------------------------------------------------------
+    
+    void PhysicsWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
         if ( ctx.GetUpdateStage() == UpdateStage::Physics )
         {
-            m_pScene->AcquireWriteLock();
+            #if KRG_DEVELOPMENT_TOOLS
+            UpdateSimulationOverlapTest();
+
+            m_numSimulationStepsLastFrame = 0;
+            m_simulationWaitTimeLastFrame = 0;
+            ScopedTimer<PlatformClock> physicsUpdateTimer( m_physicsUpdateTimeLastFrame );
+            TScopedGuardValue<bool> const physicsUpdateGuard( m_isInPhysicsUpdate, true );
+            #endif
+
+            // Handle any static component updates this should not happen in the running game
+            //-------------------------------------------------------------------------
+            // Shape modifications are not allowed while simulating so we need to complete any running step first
+
+            if ( !m_staticActorShapeUpdateList.empty() )
             {
-                KRG_PROFILE_SCOPE_PHYSICS( "Simulate" );
-             
-                // Handle any static component updates this should not happen in the running game
+                CompleteSimulationStep();
+
+                m_pScene->AcquireWriteLock();
                 for ( auto pShapeComponent : m_staticActorShapeUpdateList )
                 {
                     if ( ctx.IsGameWorld() )
@@ -601,60 +748,120 @@ namespace KRG::Physics
 
                     UpdateStaticActorAndShape( pShapeComponent );
                 }
-                m_staticActorShapeUpdateList.clear();
+                m_pScene->ReleaseWriteLock();
 
-                // TODO: run at fixed time step
-                pPxScene->simulate( ctx.GetDeltaTime() );
+                m_staticActorShapeUpdateList.clear();
             }
 
+            // Variable time step - simulate the whole frame and wait for the results
             //-------------------------------------------------------------------------
 
+            float const deltaTime = ctx.GetDeltaTime();
+
+            if ( !g_useFixedTimeStep )
             {
-                KRG_PROFILE_SCOPE_PHYSICS( "Fetch Results" );
-                pPxScene->fetchResults( true );
+                CompleteSimulationStep();
+
+                m_timeAccumulator = 0.0f;
+                m_interpolationAlpha = 1.0f;
+
+                if ( deltaTime > 0.0f )
+                {
+                    StartSimulationStep( deltaTime );
+                    CompleteSimulationStep();
+                }
+
+                return;
             }
-            m_pScene->ReleaseWriteLock();
-        }
-        else if ( ctx.GetUpdateStage() == UpdateStage::PostPhysics )
-        {
-            KRG_PROFILE_SCOPE_PHYSICS( "Update Dynamic Objects" );
+
+            // Fixed time step
+            //-------------------------------------------------------------------------
+            // We run as many fixed steps as needed to catch up, dropping any time beyond the max number of sub-steps.
+            // When overlapping, the last step is left running in the background (during the post-physics and frame end stages) and is only completed
+            // once we need to start the next step. This means we always display results that are one step older than the last started step.
+
+            float const stepTime = 1.0f / g_fixedTimeStepFrequency;
+            m_timeAccumulator += deltaTime;
+
+            int32_t const numSteps = Math::Min( (int32_t) ( m_timeAccumulator / stepTime ), (int32_t) g_maxSimulationSubsteps );
+            m_timeAccumulator = Math::Clamp( m_timeAccumulator - ( numSteps * stepTime ), 0.0f, stepTime );
 
             #if KRG_DEVELOPMENT_TOOLS
-            Drawing::DrawContext drawingContext = ctx.GetDrawingContext();
+            // The debug renderer needs to read the scene's render buffer, which is not allowed while simulating
+            bool const overlapSimulation = IsSimulationOverlapTestRunning() ? m_overlapTest.m_isOverlapEnabled : (bool) g_overlapPhysicsSimulation;
+            bool const shouldOverlapSimulation = overlapSimulation && !IsDebugDrawingEnabled();
+            #else
+            bool const shouldOverlapSimulation = g_overlapPhysicsSimulation;
             #endif
 
-            m_pScene->AcquireReadLock();
+            for ( int32_t i = 0; i < numSteps; i++ )
+            {
+                CompleteSimulationStep();
+                StartSimulationStep( stepTime );
+            }
+
+            if ( !shouldOverlapSimulation )
+            {
+                CompleteSimulationStep();
+            }
 
+            m_interpolationAlpha = m_timeAccumulator / stepTime;
+        }
+        else if ( ctx.GetUpdateStage() == UpdateStage::PostPhysics )
+        {
+            // A scene modification during the physics stage could have fetched the results of the last step
+            if ( m_isPoseReadbackPending )
+            {
+                ReadBackActiveActorPoses();
+                m_isPoseReadbackPending = false;
+            }
+
+            // Transfer physics poses back to the components that moved
             //-------------------------------------------------------------------------
+            // Components that came to rest get one final update (previous == current pose) and are then removed from the list
 
-            for ( auto const& pDynamicPhysicsComponent : m_dynamicShapeComponents )
             {
-                // Transfer physics pose back to component
-                if ( pDynamicPhysicsComponent->m_pPhysicsActor != nullptr && pDynamicPhysicsComponent->m_actorType == ActorType::Dynamic )
+                KRG_PROFILE_SCOPE_PHYSICS( "Write Back Active Actor Transforms" );
+
+                for ( int32_t i = (int32_t) m_activeDynamicComponents.size() - 1; i >= 0; i-- )
                 {
-                    auto physicsPose = pDynamicPhysicsComponent->m_pPhysicsActor->getGlobalPose();
-                    pDynamicPhysicsComponent->SetWorldTransform( FromPx( physicsPose ) );
-                }
+                    PhysicsShapeComponent* pComponent = m_activeDynamicComponents[i];
 
-                // Debug
-                //-------------------------------------------------------------------------
+                    Transform const interpolatedPose = Transform::Lerp( pComponent->m_previousPhysicsPose, pComponent->m_currentPhysicsPose, m_interpolationAlpha );
+                    pComponent->SetWorldTransform( interpolatedPose );
 
-                #if KRG_DEVELOPMENT_TOOLS
-                if ( m_drawDynamicActorBounds && pDynamicPhysicsComponent->m_actorType == ActorType::Dynamic )
-                {
-                    drawingContext.DrawBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::Orange.GetAlphaVersion( 0.5f ) );
-                    drawingContext.DrawWireBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::Orange );
+                    if ( !pComponent->m_isActivePhysicsActor )
+                    {
+                        pComponent->m_isInActiveActorList = false;
+                        m_activeDynamicComponents.erase_unsorted( m_activeDynamicComponents.begin() + i );
+                    }
                 }
+            }
+
+            // Debug
+            //-------------------------------------------------------------------------
+
+            #if KRG_DEVELOPMENT_TOOLS
+            if ( m_drawDynamicActorBounds || m_drawKinematicActorBounds )
+            {
+                Drawing::DrawContext drawingContext = ctx.GetDrawingContext();
 
-                if ( m_drawKinematicActorBounds && pDynamicPhysicsComponent->m_actorType == ActorType::Kinematic )
+                for ( auto const& pDynamicPhysicsComponent : m_dynamicShapeComponents )
                 {
-                    drawingContext.DrawBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::HotPink.GetAlphaVersion( 0.5f ) );
-                    drawingContext.DrawWireBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::HotPink );
+                    if ( m_drawDynamicActorBounds && pDynamicPhysicsComponent->m_actorType == ActorType::Dynamic )
+                    {
+                        drawingContext.DrawBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::Orange.GetAlphaVersion( 0.5f ) );
+                        drawingContext.DrawWireBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::Orange );
+                    }
+
+                    if ( m_drawKinematicActorBounds && pDynamicPhysicsComponent->m_actorType == ActorType::Kinematic )
+                    {
+                        drawingContext.DrawBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::HotPink.GetAlphaVersion( 0.5f ) );
+                        drawingContext.DrawWireBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::HotPink );
+                    }
                 }
-                #endif
             }
-
-            m_pScene->ReleaseReadLock();
+            #endif
         }
         else
         {
@@ -693,6 +900,9 @@ namespace KRG::Physics
         PxScene* pPxScene = m_pScene->m_pScene;
         m_sceneDebugFlags = debugFlags;
 
+        // Scene parameters cannot be changed while simulating
+        CompleteSimulationStep();
+
         //-------------------------------------------------------------------------
 
         auto SetVisualizationParameter = [this, pPxScene] ( PxVisualizationParameter::Enum flag, float onValue, float offValue )
@@ -721,8 +931,73 @@ namespace KRG::Physics
         m_pScene->ReleaseWriteLock();
     }
 
+    void PhysicsWorldSystem::StartSimulationOverlapTest( uint32_t numFramesPerMode )
+    {
+        KRG_ASSERT( numFramesPerMode > 0 );
+
+        if ( IsSimulationOverlapTestRunning() )
+        {
+            return;
+        }
+
+        if ( !g_useFixedTimeStep || IsDebugDrawingEnabled() )
+        {
+            KRG_LOG_ERROR( "Physics", "Simulation overlap test requires the fixed time step and no physics debug drawing" );
+            return;
+        }
+
+        m_overlapTest = SimulationOverlapTest();
+        m_overlapTest.m_numFramesPerMode = numFramesPerMode;
+        m_overlapTest.m_skipNextFrame = true;
+    }
+
+    void PhysicsWorldSystem::UpdateSimulationOverlapTest()
+    {
+        auto& test = m_overlapTest;
+        if ( test.m_numFramesPerMode == 0 )
+        {
+            m_outOfUpdateWaitTime = 0;
+            return;
+        }
+
+        // The last physics update was run with the previous mode
+        if ( test.m_skipNextFrame )
+        {
+            test.m_skipNextFrame = false;
+            m_outOfUpdateWaitTime = 0;
+            return;
+        }
+
+        // Record the main thread time for the last frame: the last physics update and any waits on the running step since then
+        test.m_mainThreadTime[test.m_isOverlapEnabled ? 1 : 0] += m_physicsUpdateTimeLastFrame + m_outOfUpdateWaitTime;
+        m_outOfUpdateWaitTime = 0;
+        test.m_numFramesCompleted++;
+
+        if ( test.m_numFramesCompleted < test.m_numFramesPerMode )
+        {
+            return;
+        }
+
+        // Switch modes or complete the test
+        if ( !test.m_isOverlapEnabled )
+        {
+            test.m_isOverlapEnabled = true;
+            test.m_numFramesCompleted = 0;
+            test.m_skipNextFrame = true;
+        }
+        else
+        {
+            float const averageWithoutOverlap = test.m_mainThreadTime[0].ToFloat() / test.m_numFramesPerMode;
+            float const averageWithOverlap = test.m_mainThreadTime[1].ToFloat() / test.m_numFramesPerMode;
+            KRG_LOG_MESSAGE( "Physics", "Simulation overlap test (%u frames per mode): main thread physics time avg %.3fms without overlap, %.3fms with overlap (%.3fms recovered per frame)", test.m_numFramesPerMode, averageWithoutOverlap, averageWithOverlap, averageWithoutOverlap - averageWithOverlap );
+            test = SimulationOverlapTest();
+        }
+    }
+
     void PhysicsWorldSystem::SetDebugCullingBox( AABB const& cullingBox )
     {
+        CompleteSimulationStep();
+
         PxScene* pPxScene = m_pScene->m_pScene;
         m_pScene->AcquireWriteLock();
         pPxScene->setVisualizationCullingBox( ToPx( cullingBox ) );
@@ -8,6 +8,8 @@
 #include "System/Types/IDVector.h"
 #include "System/Types/ScopedValue.h"
 #include "System/Types/Event.h"
+#include "System/Threading/Threading.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
@@ -41,6 +43,7 @@ namespace KRG::Physics
     {
         friend class PhysicsDebugView;
         friend class PhysicsRenderer;
+        friend class Scene;
 
         struct EntityPhysicsRecord
         {
@@ -65,6 +68,9 @@ namespace KRG::Physics
         // Get the scene
         Scene* GetScene() { return m_pScene; }
 
+        // Is there a simulation step running in the background, this is only the case between the physics update and the next frame's physics update
+        inline bool IsSimulationRunning() const { return m_isSimulationRunning; }
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -78,6 +84,17 @@ namespace KRG::Physics
         inline void SetDebugDrawDistance( float drawDistance ) { m_debugDrawDistance = Math::Max( drawDistance, 0.0f ); }
 
         void SetDebugCullingBox( AABB const& cullingBox );
+
+        // Stats for the last physics update
+        inline uint32_t GetNumSimulationStepsLastFrame() const { return m_numSimulationStepsLastFrame; }
+        inline Milliseconds GetSimulationWaitTimeLastFrame() const { return m_simulationWaitTimeLastFrame; }
+        inline uint32_t GetNumActiveActorsLastStep() const { return m_numActiveActorsLastStep; }
+        inline uint32_t GetNumActiveDynamicComponents() const { return (uint32_t) m_activeDynamicComponents.size(); }
+
+        // Headless benchmark: runs the same number of frames without and with the overlapped simulation and logs the main thread time spent on physics
+        // Includes the time spent in the physics update and any time spent waiting on a running step from other updates (i.e. scene modifications)
+        void StartSimulationOverlapTest( uint32_t numFramesPerMode );
+        inline bool IsSimulationOverlapTestRunning() const { return m_overlapTest.m_numFramesPerMode > 0; }
         #endif
 
     private:
@@ -102,6 +119,21 @@ namespace KRG::Physics
         void UpdateStaticActorAndShape( PhysicsShapeComponent* pComponent ) const;
         void OnStaticShapeTransformUpdated( PhysicsShapeComponent* pComponent );
 
+        // Simulation
+        void StartSimulationStep( float stepTime );
+        void ReadBackActiveActorPoses();
+
+        // Blocks until the running step (if any) has completed, can be called from any thread (the scene's write lock relies on this)
+        // The active actor poses are not read back here since the active dynamic component list is only safe to modify on the main thread
+        void FetchSimulationResults();
+
+        // Fetches the results of the running step (if any) and reads back the active actor poses, main thread only
+        void CompleteSimulationStep();
+
+        #if KRG_DEVELOPMENT_TOOLS
+        void UpdateSimulationOverlapTest();
+        #endif
+
     private:
 
         PhysicsSystem*                                          m_pPhysicsSystem = nullptr;
@@ -114,11 +146,35 @@ namespace KRG::Physics
         EventBindingID                                          m_shapeTransformChangedBindingID;
         TVector<PhysicsShapeComponent*>                         m_staticActorShapeUpdateList;
 
+        float                                                   m_timeAccumulator = 0.0f;           // Time not yet simulated when using a fixed time step
+        float                                                   m_interpolationAlpha = 1.0f;        // Blend between the previous and current physics poses for dynamic actors
+        std::atomic<bool>                                       m_isSimulationRunning = false;
+        bool                                                    m_isPoseReadbackPending = false;    // The results of the last step were fetched but not yet read back
+        Threading::Mutex                                        m_simulationMutex;                  // Serializes fetching the results of the running step, since any thread modifying the scene can trigger it
+        TVector<PhysicsShapeComponent*>                         m_activeDynamicComponents;          // Dynamic components that moved since their transforms were last written back
+
         #if KRG_DEVELOPMENT_TOOLS
         bool                                                    m_drawDynamicActorBounds = false;
         bool                                                    m_drawKinematicActorBounds = false;
         uint32_t                                                m_sceneDebugFlags = 0;
         float                                                   m_debugDrawDistance = 10.0f;
+        uint32_t                                                m_numSimulationStepsLastFrame = 0;
+        uint32_t                                                m_numActiveActorsLastStep = 0;
+        Milliseconds                                            m_simulationWaitTimeLastFrame = 0;
+        Milliseconds                                            m_physicsUpdateTimeLastFrame = 0;
+        Milliseconds                                            m_outOfUpdateWaitTime = 0;          // Time spent waiting on a running step outside of the physics update
+        bool                                                    m_isInPhysicsUpdate = false;
+
+        struct SimulationOverlapTest
+        {
+            uint32_t                                            m_numFramesPerMode = 0;
+            uint32_t                                            m_numFramesCompleted = 0;
+            Milliseconds                                        m_mainThreadTime[2] = { 0, 0 }; // Without overlap, with overlap
+            bool                                                m_isOverlapEnabled = false;
+            bool                                                m_skipNextFrame = false;
+        };
+
+        SimulationOverlapTest                                   m_overlapTest;
         #endif
     };
 }
\ No newline at end of file
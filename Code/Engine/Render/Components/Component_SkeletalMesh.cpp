@@ -1,5 +1,6 @@
 #include "Component_SkeletalMesh.h"
 #include "System/Animation/AnimationPose.h"
+#include "System/Animation/AnimationSkinning.h"
 #include "System/Drawing/DebugDrawing.h"
 #include "System/Profiling.h"
 
@@ -21,16 +22,17 @@ namespace KRG::Render
                 GenerateAnimationBoneMap();
             }
 
-            // Set mesh to reference pose
+            // Allocate skinning transforms, these will be generated for the reference pose
             //-------------------------------------------------------------------------
 
             m_boneTransforms.resize( m_pMesh->GetNumBones() );
-            ResetPose();
+            m_skinningTransforms.resize( m_boneTransforms.size() );
 
+            // Set mesh to reference pose and calculate initial values
             //-------------------------------------------------------------------------
 
-            // Allocate skinning transforms and calculate initial values
-            m_skinningTransforms.resize( m_boneTransforms.size() );
+            ResetPose();
+            m_skinningTransformsDirty = true;
             FinalizePose();
         }
     }
@@ -105,17 +107,20 @@ namespace KRG::Render
         KRG_ASSERT( HasMeshResourceSet() && HasSkeletonResourceSet() );
         KRG_ASSERT( !m_animToMeshBoneMap.empty() );
         KRG_ASSERT( pPose != nullptr && pPose->HasGlobalTransforms() );
-
-        int32_t const numAnimBones = pPose->GetNumBones();
-        for ( auto animBoneIdx = 0; animBoneIdx < numAnimBones; animBoneIdx++ )
-        {
-            int32_t const meshBoneIdx = m_animToMeshBoneMap[animBoneIdx];
-            if ( meshBoneIdx != InvalidIndex )
-            {
-                Transform const boneTransform = pPose->GetGlobalTransform( animBoneIdx );
-                m_boneTransforms[meshBoneIdx] = boneTransform;
-            }
-        }
+        KRG_ASSERT( m_skinningTransforms.size() == m_boneTransforms.size() );
+
+        auto const& poseTransforms = pPose->GetGlobalTransforms();
+        KRG_ASSERT( poseTransforms.size() == m_animToMeshBoneMap.size() );
+
+        Animation::SkinningTask task;
+        task.m_pPoseTransforms = poseTransforms.data();
+        task.m_pPoseToMeshBoneMap = m_animToMeshBoneMap.data();
+        task.m_pInverseBindPose = m_pMesh->GetInverseBindPoseMatrices().data();
+        task.m_pMeshBoneTransforms = m_boneTransforms.data();
+        task.m_pSkinningTransforms = m_skinningTransforms.data();
+        task.m_numPoseBones = (uint32_t) poseTransforms.size();
+        task.m_numMeshBones = (uint32_t) m_boneTransforms.size();
+        Animation::ExecuteSkinningTasks( &task, 1 );
     }
 
     void SkeletalMeshComponent::ResetPose()
@@ -131,6 +136,7 @@ namespace KRG::Render
         else
         {
             m_boneTransforms = m_pMesh->GetBindPose();
+            m_skinningTransformsDirty = true;
         }
     }
 
@@ -140,8 +146,15 @@ namespace KRG::Render
         KRG_ASSERT( m_pMesh.IsValid() && m_pMesh.IsLoaded() );
 
         NotifySocketsUpdated();
+
+        // Skinning transforms are generated when setting the pose, only regenerate them if the bones were modified manually
+        if ( m_skinningTransformsDirty )
+        {
+            UpdateSkinningTransforms();
+        }
+
+        // The bounds are calculated from the skinning transforms so need to be updated last
         UpdateBounds();
-        UpdateSkinningTransforms();
     }
 
     //-------------------------------------------------------------------------
@@ -150,13 +163,21 @@ namespace KRG::Render
     {
         KRG_ASSERT( m_pMesh.IsValid() && m_pMesh.IsLoaded() );
 
-        AABB newBounds;
-        for ( auto const& boneTransform : m_boneTransforms )
+        // Meshes without any per-bone vertex bounds fall back to the bind pose bounds
+        auto const& boneVertexBounds = m_pMesh->GetBoneVertexBounds();
+        if ( !boneVertexBounds.empty() )
         {
-            newBounds.AddPoint( boneTransform.GetTranslation() );
+            KRG_ASSERT( boneVertexBounds.size() == m_skinningTransforms.size() );
+
+            AABB skinnedBounds;
+            if ( Animation::CalculateSkinnedBounds( boneVertexBounds.data(), m_skinningTransforms.data(), (uint32_t) m_skinningTransforms.size(), skinnedBounds ) )
+            {
+                SetLocalBounds( OBB( skinnedBounds ) );
+                return;
+            }
         }
 
-        SetLocalBounds( OBB( newBounds ) );
+        SetLocalBounds( m_pMesh->GetBounds() );
     }
 
     void SkeletalMeshComponent::UpdateSkinningTransforms()
@@ -166,12 +187,8 @@ namespace KRG::Render
         auto const numBones = m_boneTransforms.size();
         KRG_ASSERT( m_skinningTransforms.size() == numBones );
 
-        auto const& inverseBindPose = m_pMesh->GetInverseBindPose();
-        for ( auto i = 0; i < numBones; i++ )
-        {
-            Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
-            m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
-        }
+        Animation::CalculateSkinningTransforms( m_pMesh->GetInverseBindPoseMatrices().data(), m_boneTransforms.data(), m_skinningTransforms.data(), (uint32_t) numBones );
+        m_skinningTransformsDirty = false;
     }
 
     void SkeletalMeshComponent::GenerateAnimationBoneMap()
@@ -222,5 +239,31 @@ namespace KRG::Render
             drawingContext.DrawAxis( boneWorldTransform, 0.03f, 2.0f );
         }
     }
+
+    AABB SkeletalMeshComponent::CalculateSkinnedVertexBounds() const
+    {
+        KRG_ASSERT( IsInitialized() && m_pMesh.IsValid() && m_pMesh.IsLoaded() );
+
+        AABB skinnedBounds;
+        skinnedBounds.Reset();
+
+        // Use the same quantized weights as the GPU
+        auto pVertices = (SkeletalMeshVertex const*) m_pMesh->GetVertexData().data();
+        int32_t const numVertices = m_pMesh->GetNumVertices();
+        for ( auto v = 0; v < numVertices; v++ )
+        {
+            Vector const skinnedPosition = CalculateSkinnedVertexPosition( pVertices[v], m_skinningTransforms.data() );
+            if ( skinnedBounds.IsValid() )
+            {
+                skinnedBounds.AddPoint( skinnedPosition );
+            }
+            else
+            {
+                skinnedBounds = AABB( skinnedPosition );
+            }
+        }
+
+        return skinnedBounds;
+    }
     #endif
 }
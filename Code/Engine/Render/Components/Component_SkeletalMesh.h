@@ -49,6 +49,7 @@ namespace KRG::Render
         {
             KRG_ASSERT( boneIdx >= 0 && boneIdx < m_boneTransforms.size() );
             m_boneTransforms[boneIdx] = transform;
+            m_skinningTransformsDirty = true;
         }
 
         // This function will finalize the pose, run any procedural bone solvers and generate the skinning transforms
@@ -65,6 +66,7 @@ namespace KRG::Render
         inline Animation::Skeleton const* GetSkeleton() const { return m_pSkeleton.GetPtr(); }
         void SetSkeleton( ResourceID skeletonResourceID );
 
+        // Sets the bone transforms from the pose and generates the skinning transforms for them in the same pass
         void SetPose( Animation::Pose const* pPose );
 
         void ResetPose();
@@ -74,6 +76,9 @@ namespace KRG::Render
 
         #if KRG_DEVELOPMENT_TOOLS
         void DrawPose( Drawing::DrawContext& drawingContext ) const;
+
+        // Skins every vertex on the CPU and returns the exact local space bounds - this is very expensive and only used to validate the per-bone bounds
+        AABB CalculateSkinnedVertexBounds() const;
         #endif
 
     protected:
@@ -97,6 +102,7 @@ namespace KRG::Render
         TVector<int32_t>                                  m_animToMeshBoneMap;
         TVector<Transform>                              m_boneTransforms;
         TVector<Matrix>                                 m_skinningTransforms;
+        bool                                            m_skinningTransformsDirty = true; // Set when the bone transforms were modified without updating the skinning transforms
     };
 
     //-------------------------------------------------------------------------
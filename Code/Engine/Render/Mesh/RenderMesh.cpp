@@ -12,6 +12,26 @@ namespace KRG::Render
 
     //-------------------------------------------------------------------------
 
+    int32_t Mesh::SelectLOD( float screenSize ) const
+    {
+        // LODs are sorted by decreasing threshold, so pick the last one we are under
+        int32_t selectedLOD = 0;
+        int32_t const numLODs = (int32_t) m_LODs.size();
+        for ( int32_t i = 0; i < numLODs; i++ )
+        {
+            if ( screenSize >= m_LODs[i].m_screenSizeThreshold )
+            {
+                break;
+            }
+
+            selectedLOD = i + 1;
+        }
+
+        return selectedLOD;
+    }
+
+    //-------------------------------------------------------------------------
+
     #if KRG_DEVELOPMENT_TOOLS
     void Mesh::DrawNormals( Drawing::DrawContext& drawingContext, Transform const& worldTransform ) const
     {
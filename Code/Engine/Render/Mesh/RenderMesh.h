@@ -28,7 +28,7 @@ namespace KRG::Render
         friend class MeshCompiler;
         friend class MeshLoader;
 
-        KRG_SERIALIZE( m_vertices, m_indices, m_sections, m_materials, m_vertexBuffer, m_indexBuffer, m_bounds );
+        KRG_SERIALIZE( m_vertices, m_indices, m_sections, m_LODs, m_materials, m_vertexBuffer, m_indexBuffer, m_bounds );
 
     public:
 
@@ -44,6 +44,16 @@ namespace KRG::Render
             uint32_t                        m_numIndices = 0;
         };
 
+        // A simplified version of the mesh - shares the vertex buffer and materials with the full detail mesh
+        // The LOD sections index into the shared index buffer and are in the same order as the full detail sections
+        struct KRG_ENGINE_API LOD
+        {
+            KRG_SERIALIZE( m_sections, m_screenSizeThreshold );
+
+            TVector<GeometrySection>        m_sections;
+            float                           m_screenSizeThreshold = 0.0f;   // This LOD is used once the mesh covers less than this fraction of the viewport height
+        };
+
     public:
 
         virtual bool IsValid() const override
@@ -60,9 +70,11 @@ namespace KRG::Render
         inline VertexFormat const& GetVertexFormat() const { return m_vertexBuffer.m_vertexFormat; }
         inline RenderBuffer const& GetVertexBuffer() const { return m_vertexBuffer; }
 
-        // Indices
-        inline TVector<uint32_t> const& GetIndices() const { return m_indices; }
-        inline int32_t const GetNumIndices() const { return (int32_t) m_indices.size(); }
+        // Indices - stored as 16bit indices whenever the vertex count allows it
+        inline Blob const& GetIndexData() const { return m_indices; }
+        inline int32_t const GetNumIndices() const { return m_indexBuffer.m_byteSize / m_indexBuffer.m_byteStride; }
+        inline bool Has16BitIndices() const { return m_indexBuffer.m_byteStride == sizeof( uint16_t ); }
+        inline uint32_t GetIndex( int32_t i ) const { KRG_ASSERT( i >= 0 && i < GetNumIndices() ); return Has16BitIndices() ? ( (uint16_t const*) m_indices.data() )[i] : ( (uint32_t const*) m_indices.data() )[i]; }
         inline RenderBuffer const& GetIndexBuffer() const { return m_indexBuffer; }
 
         // Mesh Sections
@@ -70,6 +82,14 @@ namespace KRG::Render
         inline uint32_t GetNumSections() const { return (uint32_t) m_sections.size(); }
         inline GeometrySection GetSection( uint32_t i ) const { KRG_ASSERT( i < GetNumSections() ); return m_sections[i]; }
 
+        // LODs - LOD 0 is always the full detail mesh
+        inline int32_t GetNumLODs() const { return (int32_t) m_LODs.size() + 1; }
+        inline TVector<GeometrySection> const& GetSections( int32_t lodIdx ) const { KRG_ASSERT( lodIdx >= 0 && lodIdx < GetNumLODs() ); return ( lodIdx == 0 ) ? m_sections : m_LODs[lodIdx - 1].m_sections; }
+        inline GeometrySection const& GetSection( int32_t lodIdx, uint32_t i ) const { KRG_ASSERT( i < GetNumSections() ); return GetSections( lodIdx )[i]; }
+
+        // Select the LOD to use for a given screen size (the fraction of the viewport height covered by the mesh)
+        int32_t SelectLOD( float screenSize ) const;
+
         // Materials
         TVector<TResourcePtr<Material>> const& GetMaterials() const { return m_materials; }
 
@@ -81,8 +101,9 @@ namespace KRG::Render
     protected:
 
         Blob                                m_vertices;
-        TVector<uint32_t>                   m_indices;
+        Blob                                m_indices;
         TVector<GeometrySection>            m_sections;
+        TVector<LOD>                        m_LODs;
         TVector<TResourcePtr<Material>>     m_materials;
         VertexBuffer                        m_vertexBuffer;
         RenderBuffer                        m_indexBuffer;
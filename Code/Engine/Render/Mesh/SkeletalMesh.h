@@ -11,7 +11,7 @@ namespace KRG::Render
         friend class MeshLoader;
 
         KRG_REGISTER_RESOURCE( 'smsh', "Skeletal Mesh" );
-        KRG_SERIALIZE( KRG_SERIALIZE_BASE( Mesh ), m_boneIDs, m_parentBoneIndices, m_bindPose, m_inverseBindPose );
+        KRG_SERIALIZE( KRG_SERIALIZE_BASE( Mesh ), m_boneIDs, m_parentBoneIndices, m_bindPose, m_inverseBindPose, m_boneVertexBounds );
 
     public:
 
@@ -27,6 +27,10 @@ namespace KRG::Render
         // Bind Poses
         inline TVector<Transform> const& GetBindPose() const { return m_bindPose; }
         inline TVector<Transform> const& GetInverseBindPose() const { return m_inverseBindPose; }
+        inline TVector<Matrix> const& GetInverseBindPoseMatrices() const { return m_inverseBindPoseMatrices; }
+
+        // Get the bind space bounds of all the vertices influenced by each bone (invalid for bones that dont influence any vertices)
+        inline TVector<AABB> const& GetBoneVertexBounds() const { return m_boneVertexBounds; }
 
         // Debug
         #if KRG_DEVELOPMENT_TOOLS
@@ -39,5 +43,7 @@ namespace KRG::Render
         TVector<int32_t>                      m_parentBoneIndices;
         TVector<Transform>                  m_bindPose;             // Note: bind pose is in global space
         TVector<Transform>                  m_inverseBindPose;
+        TVector<Matrix>                     m_inverseBindPoseMatrices; // Generated at load time, used for skinning
+        TVector<AABB>                       m_boneVertexBounds;     // Per bone, used to calculate the skinned bounds
     };
 }
\ No newline at end of file
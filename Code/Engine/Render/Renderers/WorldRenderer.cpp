@@ -536,8 +536,10 @@ namespace KRG::Render
 
         //-------------------------------------------------------------------------
 
-        for ( StaticMeshComponent const* pMeshComponent : data.m_staticMeshComponents )
+        KRG_ASSERT( data.m_staticMeshComponents.size() == data.m_staticMeshLODs.size() );
+        for ( auto c = 0u; c < data.m_staticMeshComponents.size(); c++ )
         {
+            StaticMeshComponent const* pMeshComponent = data.m_staticMeshComponents[c];
             auto pMesh = pMeshComponent->GetMesh();
             Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
             ObjectTransforms transforms = data.m_transforms;
@@ -556,6 +558,7 @@ namespace KRG::Render
             renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
 
             TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
+            int32_t const lodIdx = data.m_staticMeshLODs[c];
 
             auto const numSubMeshes = pMesh->GetNumSections();
             for ( auto i = 0u; i < numSubMeshes; i++ )
@@ -569,7 +572,7 @@ namespace KRG::Render
                     SetDefaultMaterial( renderContext, *pPipelineState->m_pPixelShader );
                 }
 
-                auto const& subMesh = pMesh->GetSection( i );
+                auto const& subMesh = pMesh->GetSection( lodIdx, i );
                 renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
             }
         }
@@ -596,8 +599,11 @@ namespace KRG::Render
 
         SkeletalMesh const* pCurrentMesh = nullptr;
 
-        for ( SkeletalMeshComponent const* pMeshComponent : data.m_skeletalMeshComponents )
+        KRG_ASSERT( data.m_skeletalMeshComponents.size() == data.m_skeletalMeshLODs.size() );
+        for ( auto c = 0u; c < data.m_skeletalMeshComponents.size(); c++ )
         {
+            SkeletalMeshComponent const* pMeshComponent = data.m_skeletalMeshComponents[c];
+
             if ( pMeshComponent->GetMesh() != pCurrentMesh )
             {
                 pCurrentMesh = pMeshComponent->GetMesh();
@@ -632,6 +638,7 @@ namespace KRG::Render
             //-------------------------------------------------------------------------
 
             TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
+            int32_t const lodIdx = data.m_skeletalMeshLODs[c];
 
             auto const numSubMeshes = pCurrentMesh->GetNumSections();
             for ( auto i = 0u; i < numSubMeshes; i++ )
@@ -646,7 +653,7 @@ namespace KRG::Render
                 }
 
                 // Draw mesh
-                auto const& subMesh = pCurrentMesh->GetSection( i );
+                auto const& subMesh = pCurrentMesh->GetSection( lodIdx, i );
                 renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
             }
         }
@@ -699,8 +706,9 @@ namespace KRG::Render
         renderContext.SetShaderInputBinding( m_inputBindingStatic );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
-        for ( StaticMeshComponent const* pMeshComponent : data.m_staticMeshComponents )
+        for ( auto c = 0u; c < data.m_staticMeshComponents.size(); c++ )
         {
+            StaticMeshComponent const* pMeshComponent = data.m_staticMeshComponents[c];
             auto pMesh = pMeshComponent->GetMesh();
             Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
             transforms.m_worldTransform = worldTransform;
@@ -709,10 +717,11 @@ namespace KRG::Render
             renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
             renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
 
+            int32_t const lodIdx = data.m_staticMeshLODs[c];
             auto const numSubMeshes = pMesh->GetNumSections();
             for ( auto i = 0u; i < numSubMeshes; i++ )
             {
-                auto const& subMesh = pMesh->GetSection( i );
+                auto const& subMesh = pMesh->GetSection( lodIdx, i );
                 renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
             }
         }
@@ -724,8 +733,9 @@ namespace KRG::Render
         renderContext.SetShaderInputBinding( m_inputBindingSkeletal );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
-        for ( SkeletalMeshComponent const* pMeshComponent : data.m_skeletalMeshComponents )
+        for ( auto c = 0u; c < data.m_skeletalMeshComponents.size(); c++ )
         {
+            SkeletalMeshComponent const* pMeshComponent = data.m_skeletalMeshComponents[c];
             auto pMesh = pMeshComponent->GetMesh();
 
             // Update Bones and Transforms
@@ -746,11 +756,12 @@ namespace KRG::Render
 
             // Draw sub-meshes
             //-------------------------------------------------------------------------
+            int32_t const lodIdx = data.m_skeletalMeshLODs[c];
             auto const numSubMeshes = pMesh->GetNumSections();
             for ( auto i = 0u; i < numSubMeshes; i++ )
             {
                 // Draw mesh
-                auto const& subMesh = pMesh->GetSection( i );
+                auto const& subMesh = pMesh->GetSection( lodIdx, i );
                 renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
             }
         }
@@ -783,6 +794,8 @@ namespace KRG::Render
             nullptr,
             pWorldSystem->m_visibleStaticMeshComponents,
             pWorldSystem->m_visibleSkeletalMeshComponents,
+            pWorldSystem->m_visibleStaticMeshLODs,
+            pWorldSystem->m_visibleSkeletalMeshLODs,
         };
 
         renderData.m_transforms.m_viewprojTransform = viewport.GetViewVolume().GetViewProjectionMatrix();
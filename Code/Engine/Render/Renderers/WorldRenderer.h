@@ -99,6 +99,8 @@ namespace KRG::Render
             CubemapTexture const*                   m_pSkyboxTexture;
             TVector<StaticMeshComponent const*>&    m_staticMeshComponents;
             TVector<SkeletalMeshComponent const*>&  m_skeletalMeshComponents;
+            TVector<int8_t> const&                  m_staticMeshLODs;
+            TVector<int8_t> const&                  m_skeletalMeshLODs;
         };
 
     public:
@@ -33,6 +33,13 @@ namespace KRG::Render
             SkeletalMesh* pSkeletalMesh = KRG::New<SkeletalMesh>();
             archive << *pSkeletalMesh;
             pMeshResource = pSkeletalMesh;
+
+            // Pre-convert the inverse bind pose so that skinning only needs to convert the animated bones
+            pSkeletalMesh->m_inverseBindPoseMatrices.reserve( pSkeletalMesh->m_inverseBindPose.size() );
+            for ( auto const& inverseBindTransform : pSkeletalMesh->m_inverseBindPose )
+            {
+                pSkeletalMesh->m_inverseBindPoseMatrices.emplace_back( inverseBindTransform.ToMatrix() );
+            }
         }
 
         KRG_ASSERT( !pMeshResource->m_vertices.empty() );
@@ -63,6 +63,15 @@ struct PixelShaderInput
     float2 m_uv : TEXCOORD;
 };
 
+// Mesh normals are stored octahedral encoded (see EncodeOctahedralNormal in RenderVertexFormats.cpp)
+float3 DecodeOctahedralNormal(float2 encodedNormal)
+{
+    float3 normal = float3(encodedNormal.xy, 1.0 - abs(encodedNormal.x) - abs(encodedNormal.y));
+    float t = saturate(-normal.z);
+    normal.xy += (normal.xy >= 0.0) ? -t : t;
+    return normalize(normal);
+}
+
 PixelShaderInput GeneratePixelShaderInput(float3 objectPos, float3 objectNormal, float2 uv)
 {
     PixelShaderInput output;
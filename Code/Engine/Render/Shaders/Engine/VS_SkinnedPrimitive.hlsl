@@ -8,10 +8,10 @@ cbuffer Skeleton : register( b1 )
 struct VertexShaderInput
 {
     float3 m_pos : POSITION;
-    float3 m_normal : NORMAL;
+    float2 m_normal : NORMAL;
     float2 m_uv0 : TEXCOORD0;
     float2 m_uv1 : TEXCOORD1;
-    int4   m_boneIndices : BLENDINDICES0;
+    uint4  m_boneIndices : BLENDINDICES0;
     float4 m_boneWeights : BLENDWEIGHTS0;
 };
 
@@ -19,14 +19,16 @@ PixelShaderInput main( VertexShaderInput vsInput )
 {
     float3 blendPos = float3(0, 0, 0);
     float3 blendNormal = float3(0, 0, 0);
+    float3 objectNormal = DecodeOctahedralNormal(vsInput.m_normal);
 
+    // Unused influences have a zero weight
     for ( int i = 0; i < 4; ++i )
     {
-        if ( vsInput.m_boneIndices[i] != -1 )
+        if ( vsInput.m_boneWeights[i] > 0 )
         {
             matrix boneTransform = m_boneTransforms[vsInput.m_boneIndices[i]];
             blendPos += mul( boneTransform, float4(vsInput.m_pos, 1.0) ).xyz * vsInput.m_boneWeights[i];
-            blendNormal += mul( boneTransform, float4(vsInput.m_normal, 0.0) ).xyz * vsInput.m_boneWeights[i]; // HACK: check idea, assumes orthonormal matrix, without scaling
+            blendNormal += mul( boneTransform, float4(objectNormal, 0.0) ).xyz * vsInput.m_boneWeights[i]; // HACK: check idea, assumes orthonormal matrix, without scaling
         }
     }
 
@@ -22,10 +22,54 @@ namespace KRG::Render
     static RuntimeSettingBool g_showSkeletalMeshBounds( "ShowSkeletalMeshBounds", "Rendering/Skeletal Meshes", "", false );
     static RuntimeSettingBool g_showSkeletalMeshBones( "ShowSkeletalMeshBones", "Rendering/Skeletal Meshes", "", false );
     static RuntimeSettingBool g_showSkeletalMeshBindPoses( "ShowSkeletalMeshBindPoses", "Rendering/Skeletal Meshes", "", false );
+    static RuntimeSettingBool g_validateSkeletalMeshBounds( "ValidateSkeletalMeshBounds", "Rendering/Skeletal Meshes", "CPU skins all vertices and checks that they are contained in the mesh bounds (very slow)", false );
+    static RuntimeSettingInt g_forcedMeshLOD( "ForcedMeshLOD", "Rendering/Meshes", "Force all meshes to use this LOD, -1 for automatic selection", -1, -1, 7 );
     #endif
 
     //-------------------------------------------------------------------------
 
+    // Calculate the approximate fraction of the viewport height covered by the bounds
+    static float CalculateScreenSize( Math::ViewVolume const& viewVolume, OBB const& worldBounds )
+    {
+        float const boundsDiameter = 2.0f * worldBounds.m_extents.GetLength3();
+
+        if ( viewVolume.IsPerspective() )
+        {
+            // The view volume FOV is horizontal, we need the vertical FOV since we are measuring against the viewport height
+            Float2 const viewDimensions = viewVolume.GetViewDimensions();
+            Radians const verticalFOV = Math::ViewVolume::ConvertHorizontalToVerticalFOV( viewDimensions.m_x, viewDimensions.m_y, viewVolume.GetFOV() );
+
+            float const distance = viewVolume.GetViewPosition().GetDistance3( worldBounds.m_center );
+            float const viewHeightAtDistance = 2.0f * distance * Math::Tan( verticalFOV.ToFloat() / 2 );
+            return ( viewHeightAtDistance > Math::Epsilon ) ? boundsDiameter / viewHeightAtDistance : 1.0f;
+        }
+        else
+        {
+            return boundsDiameter / viewVolume.GetViewDimensions().m_y;
+        }
+    }
+
+    template<typename T>
+    static int8_t SelectMeshLOD( Math::ViewVolume const& viewVolume, T const* pMeshComponent )
+    {
+        auto pMesh = pMeshComponent->GetMesh();
+        if ( pMesh->GetNumLODs() == 1 )
+        {
+            return 0;
+        }
+
+        #if KRG_DEVELOPMENT_TOOLS
+        if ( g_forcedMeshLOD >= 0 )
+        {
+            return (int8_t) Math::Min( (int32_t) g_forcedMeshLOD, pMesh->GetNumLODs() - 1 );
+        }
+        #endif
+
+        return (int8_t) pMesh->SelectLOD( CalculateScreenSize( viewVolume, pMeshComponent->GetWorldBounds() ) );
+    }
+
+    //-------------------------------------------------------------------------
+
     void RendererWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
     {
         m_staticMeshMobilityChangedEventBinding = StaticMeshComponent::OnMobilityChanged().Bind( [this] ( StaticMeshComponent* pMeshComponent ) { OnStaticMeshMobilityUpdated( pMeshComponent ); } );
@@ -247,6 +291,25 @@ namespace KRG::Render
 
     //-------------------------------------------------------------------------
 
+    void RendererWorldSystem::SelectVisibleMeshLODs( Math::ViewVolume const& viewVolume )
+    {
+        KRG_PROFILE_FUNCTION_RENDER();
+
+        m_visibleStaticMeshLODs.resize( m_visibleStaticMeshComponents.size() );
+        for ( auto i = 0u; i < m_visibleStaticMeshComponents.size(); i++ )
+        {
+            m_visibleStaticMeshLODs[i] = SelectMeshLOD( viewVolume, m_visibleStaticMeshComponents[i] );
+        }
+
+        m_visibleSkeletalMeshLODs.resize( m_visibleSkeletalMeshComponents.size() );
+        for ( auto i = 0u; i < m_visibleSkeletalMeshComponents.size(); i++ )
+        {
+            m_visibleSkeletalMeshLODs[i] = SelectMeshLOD( viewVolume, m_visibleSkeletalMeshComponents[i] );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void RendererWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         KRG_PROFILE_FUNCTION_RENDER();
@@ -337,6 +400,12 @@ namespace KRG::Render
             }
         }
 
+        //-------------------------------------------------------------------------
+        // LOD Selection
+        //-------------------------------------------------------------------------
+
+        SelectVisibleMeshLODs( ctx.GetViewport()->GetViewVolume() );
+
         //-------------------------------------------------------------------------
         // Debug
         //-------------------------------------------------------------------------
@@ -370,6 +439,21 @@ namespace KRG::Render
             {
                 pMeshComponent->GetMesh()->DrawBindPose( drawCtx, pMeshComponent->GetWorldTransform() );
             }
+
+            // Any skinned vertices outside of the bounds mean that the per-bone vertex bounds are not conservative
+            if ( g_validateSkeletalMeshBounds && pMeshComponent->IsInitialized() )
+            {
+                AABB const skinnedBounds = pMeshComponent->CalculateSkinnedVertexBounds();
+                AABB const localBounds = pMeshComponent->GetLocalBounds().GetAABB();
+
+                Vector const tolerance( 0.001f );
+                bool const isContained = skinnedBounds.GetMin().IsGreaterThanEqual3( localBounds.GetMin() - tolerance ) && skinnedBounds.GetMax().IsLessThanEqual3( localBounds.GetMax() + tolerance );
+                if ( !isContained )
+                {
+                    KRG_LOG_ERROR( "Render", "Skeletal mesh bounds do not contain all skinned vertices: %s", pMeshComponent->GetMesh()->GetResourceID().c_str() );
+                    drawCtx.DrawWireBox( OBB( skinnedBounds, pMeshComponent->GetWorldTransform() ), Colors::Red );
+                }
+            }
         }
         #endif
     }
@@ -12,6 +12,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace KRG::Math { class ViewVolume; }
+
+//-------------------------------------------------------------------------
+
 namespace KRG::Render
 {
     class SkeletalMeshComponent;
@@ -97,6 +101,11 @@ namespace KRG::Render
         void RegisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
         void UnregisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
 
+        // LODs
+        //-------------------------------------------------------------------------
+
+        void SelectVisibleMeshLODs( Math::ViewVolume const& viewVolume );
+
     private:
 
         // Static meshes
@@ -104,6 +113,7 @@ namespace KRG::Render
         TIDVector<ComponentID, StaticMeshComponent*>                    m_staticStaticMeshComponents;
         TIDVector<ComponentID, StaticMeshComponent*>                    m_dynamicStaticMeshComponents;
         TVector<StaticMeshComponent const*>                             m_visibleStaticMeshComponents;
+        TVector<int8_t>                                                 m_visibleStaticMeshLODs;                // The selected LOD for each visible component (same order as the visible list)
         EventBindingID                                                  m_staticMeshMobilityChangedEventBinding;
         EventBindingID                                                  m_staticMeshStaticTransformUpdatedEventBinding;
         Threading::Mutex                                                m_mobilityUpdateListLock;               // Mobility switches can occur on any thread so the list needs to be threadsafe. We use a simple lock for now since we dont expect too many switches
@@ -115,6 +125,7 @@ namespace KRG::Render
         TIDVector<ComponentID, SkeletalMeshComponent*>                  m_registeredSkeletalMeshComponents;
         TIDVector<uint32_t, SkeletalMeshGroup>                            m_skeletalMeshGroups;
         TVector<SkeletalMeshComponent const*>                           m_visibleSkeletalMeshComponents;
+        TVector<int8_t>                                                 m_visibleSkeletalMeshLODs;              // The selected LOD for each visible component (same order as the visible list)
 
         // Lights
         TIDVector<ComponentID, DirectionalLightComponent*>              m_registeredDirectionLightComponents;
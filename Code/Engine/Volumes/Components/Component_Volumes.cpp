@@ -5,6 +5,10 @@
 
 namespace KRG
 {
+    TEvent<TriggerVolumeComponent*> TriggerVolumeComponent::s_transformUpdatedEvent;
+
+    //-------------------------------------------------------------------------
+
     void BoxVolumeComponent::Initialize()
     {
         VolumeComponent::Initialize();
@@ -24,4 +28,14 @@ namespace KRG
         drawingCtx.DrawWireBox( worldBounds, volumeBorderColor, 2.0f, Drawing::EnableDepthTest );
     }
     #endif
+
+    //-------------------------------------------------------------------------
+
+    void TriggerVolumeComponent::OnWorldTransformUpdated()
+    {
+        if ( IsInitialized() )
+        {
+            s_transformUpdatedEvent.Execute( this );
+        }
+    }
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntitySpatialComponent.h"
 #include "System/Types/Color.h"
+#include "System/Types/Event.h"
 
 //-------------------------------------------------------------------------
 
@@ -49,4 +50,33 @@ namespace KRG
 
         virtual void Initialize() override;
     };
+
+    //-------------------------------------------------------------------------
+    // A volume that generates enter/stay/exit events for characters (see VolumeWorldSystem)
+
+    class KRG_ENGINE_API TriggerVolumeComponent : public BoxVolumeComponent
+    {
+        KRG_REGISTER_ENTITY_COMPONENT( TriggerVolumeComponent );
+
+        friend class VolumeWorldSystem;
+
+        static TEvent<TriggerVolumeComponent*> s_transformUpdatedEvent; // Fired whenever a trigger volume is moved
+
+    public:
+
+        inline static TEventHandle<TriggerVolumeComponent*> OnTransformUpdated() { return s_transformUpdatedEvent; }
+
+    public:
+
+        inline TriggerVolumeComponent() = default;
+        inline TriggerVolumeComponent( StringID name ) : BoxVolumeComponent( name ) {}
+
+        #if KRG_DEVELOPMENT_TOOLS
+        virtual Color GetVolumeColor() const override { return Colors::Orange; }
+        #endif
+
+    protected:
+
+        virtual void OnWorldTransformUpdated() override;
+    };
 }
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "WorldSystem_Volumes.h"
+#include "Engine/Volumes/Components/Component_Volumes.h"
+#include "Engine/Physics/Components/Component_PhysicsCharacter.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG
+{
+    VolumeWorldSystem::RegisteredTriggerer::RegisteredTriggerer( Physics::CharacterComponent* pComponent )
+        : m_pComponent( pComponent )
+        , m_ID( pComponent->GetID() )
+        , m_bounds( pComponent->GetWorldBounds().GetAABB() )
+    {}
+
+    //-------------------------------------------------------------------------
+
+    void VolumeWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_volumeTransformUpdatedEventBinding = TriggerVolumeComponent::OnTransformUpdated().Bind( [this] ( TriggerVolumeComponent* pComponent ) { OnVolumeTransformUpdated( pComponent ); } );
+    }
+
+    void VolumeWorldSystem::ShutdownSystem()
+    {
+        TriggerVolumeComponent::OnTransformUpdated().Unbind( m_volumeTransformUpdatedEventBinding );
+
+        KRG_ASSERT( m_volumes.empty() );
+        KRG_ASSERT( m_triggerers.empty() );
+    }
+
+    void VolumeWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        if ( auto pVolumeComponent = TryCast<TriggerVolumeComponent>( pComponent ) )
+        {
+            m_volumes.Add( pVolumeComponent );
+            m_overlapTracker.AddVolume( pVolumeComponent->GetID().ToUint64(), pVolumeComponent->GetWorldBounds().GetAABB() );
+        }
+        else if ( auto pCharacterComponent = TryCast<Physics::CharacterComponent>( pComponent ) )
+        {
+            auto pTriggerer = m_triggerers.Add( RegisteredTriggerer( pCharacterComponent ) );
+            m_overlapTracker.AddTriggerer( pTriggerer->m_ID.ToUint64(), pTriggerer->m_bounds );
+        }
+    }
+
+    void VolumeWorldSystem::UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        if ( auto pVolumeComponent = TryCast<TriggerVolumeComponent>( pComponent ) )
+        {
+            {
+                Threading::ScopeLock lock( m_volumeTransformUpdateListLock );
+                int32_t const transformUpdateListIdx = VectorFindIndex( m_volumeTransformUpdateList, pVolumeComponent );
+                if ( transformUpdateListIdx != InvalidIndex )
+                {
+                    m_volumeTransformUpdateList.erase_unsorted( m_volumeTransformUpdateList.begin() + transformUpdateListIdx );
+                }
+            }
+
+            m_overlapTracker.RemoveVolume( pVolumeComponent->GetID().ToUint64() );
+            m_volumes.Remove( pVolumeComponent->GetID() );
+        }
+        else if ( auto pCharacterComponent = TryCast<Physics::CharacterComponent>( pComponent ) )
+        {
+            m_overlapTracker.RemoveTriggerer( pCharacterComponent->GetID().ToUint64() );
+            m_triggerers.Remove( pCharacterComponent->GetID() );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void VolumeWorldSystem::OnVolumeTransformUpdated( TriggerVolumeComponent* pComponent )
+    {
+        KRG_ASSERT( pComponent != nullptr && pComponent->IsInitialized() );
+
+        // This event is shared across all worlds
+        if ( m_volumes.HasItemForID( pComponent->GetID() ) )
+        {
+            Threading::ScopeLock lock( m_volumeTransformUpdateListLock );
+            if ( !VectorContains( m_volumeTransformUpdateList, pComponent ) )
+            {
+                m_volumeTransformUpdateList.emplace_back( pComponent );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void VolumeWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
+        KRG_PROFILE_FUNCTION_GAMEPLAY();
+
+        // Update broadphase
+        //-------------------------------------------------------------------------
+
+        for ( auto pVolumeComponent : m_volumeTransformUpdateList )
+        {
+            m_overlapTracker.UpdateVolume( pVolumeComponent->GetID().ToUint64(), pVolumeComponent->GetWorldBounds().GetAABB() );
+        }
+        m_volumeTransformUpdateList.clear();
+
+        // Only update triggerers that have actually moved
+        for ( auto& triggerer : m_triggerers )
+        {
+            AABB const bounds = triggerer.m_pComponent->GetWorldBounds().GetAABB();
+            if ( !bounds.GetCenter().IsEqual3( triggerer.m_bounds.GetCenter() ) || !bounds.GetExtents().IsEqual3( triggerer.m_bounds.GetExtents() ) )
+            {
+                triggerer.m_bounds = bounds;
+                m_overlapTracker.UpdateTriggerer( triggerer.m_ID.ToUint64(), bounds );
+            }
+        }
+
+        // Generate events
+        //-------------------------------------------------------------------------
+
+        // Both IDs are guaranteed to refer to registered components when this is called
+        auto NarrowPhase = [] ( uint64_t volumeID, uint64_t triggererID )
+        {
+            auto pVolumeComponent = reinterpret_cast<TriggerVolumeComponent const*>( volumeID );
+            auto pCharacterComponent = reinterpret_cast<Physics::CharacterComponent const*>( triggererID );
+            return pVolumeComponent->GetWorldBounds().Overlaps( pCharacterComponent->GetWorldBounds() );
+        };
+
+        m_overlapTracker.Update( NarrowPhase );
+
+        m_events.clear();
+        for ( auto const& trackerEvent : m_overlapTracker.GetEvents() )
+        {
+            auto& event = m_events.emplace_back();
+            event.m_volumeID = ComponentID( trackerEvent.m_volumeID );
+            event.m_triggererID = ComponentID( trackerEvent.m_triggererID );
+            event.m_type = trackerEvent.m_type;
+        }
+    }
+}
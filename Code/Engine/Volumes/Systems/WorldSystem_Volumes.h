@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Entity/EntityWorldSystem.h"
+#include "System/Math/VolumeOverlapTracker.h"
+#include "System/Types/IDVector.h"
+#include "System/Types/Event.h"
+#include "System/Threading/Threading.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG
+{
+    class TriggerVolumeComponent;
+    namespace Physics { class CharacterComponent; }
+
+    //-------------------------------------------------------------------------
+
+    struct VolumeEvent
+    {
+        using Type = Math::VolumeOverlapTracker::Event::Type;
+
+        ComponentID                                         m_volumeID;
+        ComponentID                                         m_triggererID;
+        Type                                                m_type = Type::Enter;
+    };
+
+    //-------------------------------------------------------------------------
+    // Tracks all character components against all trigger volumes in the world
+    // Events are generated once per frame (post-physics) and are valid until the next update
+    // Note: events only contain component IDs since the components in exit events may already have been unregistered
+
+    class KRG_ENGINE_API VolumeWorldSystem final : public IWorldEntitySystem
+    {
+        struct RegisteredTriggerer
+        {
+            RegisteredTriggerer( Physics::CharacterComponent* pComponent );
+
+            inline ComponentID GetID() const { return m_ID; }
+
+            Physics::CharacterComponent*                    m_pComponent = nullptr;
+            ComponentID                                     m_ID;
+            AABB                                            m_bounds;
+        };
+
+    public:
+
+        KRG_REGISTER_TYPE( VolumeWorldSystem );
+        KRG_ENTITY_WORLD_SYSTEM( VolumeWorldSystem, RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::Low ) );
+
+        // Get all the volume events for this frame
+        inline TVector<VolumeEvent> const& GetEvents() const { return m_events; }
+
+        #if KRG_DEVELOPMENT_TOOLS
+        inline uint32_t GetNumRegisteredVolumes() const { return m_overlapTracker.GetNumVolumes(); }
+        inline uint32_t GetNumRegisteredTriggerers() const { return m_overlapTracker.GetNumTriggerers(); }
+        #endif
+
+    private:
+
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
+        virtual void ShutdownSystem() override final;
+        virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+
+        void OnVolumeTransformUpdated( TriggerVolumeComponent* pComponent );
+
+    private:
+
+        TIDVector<ComponentID, TriggerVolumeComponent*>     m_volumes;
+        TIDVector<ComponentID, RegisteredTriggerer>         m_triggerers;
+        Math::VolumeOverlapTracker                          m_overlapTracker;
+        TVector<VolumeEvent>                                m_events;
+
+        // Volumes moved since the last update
+        TVector<TriggerVolumeComponent*>                    m_volumeTransformUpdateList;
+        Threading::Mutex                                    m_volumeTransformUpdateListLock;
+        EventBindingID                                      m_volumeTransformUpdatedEventBinding;
+    };
+}
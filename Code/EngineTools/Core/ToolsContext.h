@@ -5,6 +5,7 @@
 namespace KRG
 {
     class ResourceID;
+    class TaskSystem;
     namespace Resource { class ResourceSystem; class ResourceDatabase; }
     namespace TypeSystem { class TypeRegistry; }
     namespace FileSystem { class Path; }
@@ -26,5 +27,6 @@ namespace KRG
         TypeSystem::TypeRegistry const*                     m_pTypeRegistry = nullptr;
         Resource::ResourceDatabase const*                   m_pResourceDatabase = nullptr;
         Resource::ResourceSystem*                           m_pResourceSystem = nullptr;
+        TaskSystem*                                         m_pTaskSystem = nullptr;
     };
 }
\ No newline at end of file
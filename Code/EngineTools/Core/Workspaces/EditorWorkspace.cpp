@@ -38,6 +38,11 @@ namespace KRG
         SetDisplayName( m_displayName );
         m_viewportWindowID.sprintf( "Viewport##%u", GetID() );
         m_dockspaceID.sprintf( "Dockspace##%u", GetID() );
+
+        if ( m_pWorld != nullptr )
+        {
+            m_pWorld->SetIndependent( CanUpdateWorldInParallel() );
+        }
     }
 
     //-------------------------------------------------------------------------
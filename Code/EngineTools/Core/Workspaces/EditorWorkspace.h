@@ -80,6 +80,10 @@ namespace KRG
         // Get the world associated with this workspace
         inline EntityWorld* GetWorld() const { return m_pWorld; }
 
+        // Can this workspace's world be updated in parallel with the other worlds (this includes the UpdateWorld calls)?
+        // Only return true if none of the world's systems, entities or this workspace's world update touch any global or shared state
+        virtual bool CanUpdateWorldInParallel() const { return false; }
+
         // Lifetime/Update Functions
         //-------------------------------------------------------------------------
 
@@ -28,7 +28,7 @@ namespace KRG::EntityModel
         {
             ScopedTimer<PlatformClock> timer( elapsedTime );
 
-            if ( !Serializer::ReadEntityCollectionFromFile( *m_pTypeRegistry, ctx.m_inputFilePath, collectionDesc ) )
+            if ( !Serializer::ReadEntityCollectionFromFile( *m_pTypeRegistry, ctx.m_inputFilePath, collectionDesc, GetTaskSystem() ) )
             {
                 return Resource::CompilationResult::Failure;
             }
@@ -60,7 +60,7 @@ namespace KRG::EntityModel
 
         // Read map descriptor
         FileSystem::Path const collectionFilePath = resourceID.GetResourcePath().ToFileSystemPath( m_rawResourceDirectoryPath );
-        if ( !EntityModel::Serializer::ReadEntityCollectionFromFile( *m_pTypeRegistry, collectionFilePath, collectionDesc ) )
+        if ( !EntityModel::Serializer::ReadEntityCollectionFromFile( *m_pTypeRegistry, collectionFilePath, collectionDesc, GetTaskSystem() ) )
         {
             return false;
         }
@@ -29,7 +29,7 @@ namespace KRG::EntityModel
         {
             ScopedTimer<PlatformClock> timer( elapsedTime );
 
-            if ( !Serializer::ReadEntityCollectionFromFile( *m_pTypeRegistry, ctx.m_inputFilePath, map ) )
+            if ( !Serializer::ReadEntityCollectionFromFile( *m_pTypeRegistry, ctx.m_inputFilePath, map, GetTaskSystem() ) )
             {
                 return Resource::CompilationResult::Failure;
             }
@@ -87,7 +87,7 @@ namespace KRG::EntityModel
 
         // Read map descriptor
         FileSystem::Path const collectionFilePath = resourceID.GetResourcePath().ToFileSystemPath( m_rawResourceDirectoryPath );
-        if ( !EntityModel::Serializer::ReadEntityCollectionFromFile( *m_pTypeRegistry, collectionFilePath, collectionDesc ) )
+        if ( !EntityModel::Serializer::ReadEntityCollectionFromFile( *m_pTypeRegistry, collectionFilePath, collectionDesc, GetTaskSystem() ) )
         {
             return false;
         }
@@ -155,7 +155,7 @@ namespace KRG::EntityModel
             return;
         }
 
-        if ( Serializer::WriteEntityCollectionToFile( *m_pToolsContext->m_pTypeRegistry, ecd, mapFilePath ) )
+        if ( Serializer::WriteEntityCollectionToFile( *m_pToolsContext->m_pTypeRegistry, ecd, mapFilePath, m_pToolsContext->m_pTaskSystem ) )
         {
             ResourceID const mapResourcePath = GetResourcePath( mapFilePath );
             LoadMap( mapResourcePath );
@@ -181,7 +181,7 @@ namespace KRG::EntityModel
         }
 
         FileSystem::Path const filePath = GetFileSystemPath( m_loadedMap );
-        return Serializer::WriteEntityCollectionToFile( *m_pToolsContext->m_pTypeRegistry, ecd, filePath );
+        return Serializer::WriteEntityCollectionToFile( *m_pToolsContext->m_pTypeRegistry, ecd, filePath, m_pToolsContext->m_pTaskSystem );
     }
 
     //-------------------------------------------------------------------------
@@ -61,7 +61,7 @@ namespace KRG::Navmesh
         {
             ScopedTimer<PlatformClock> timer( elapsedTime );
 
-            if ( !EntityModel::Serializer::ReadEntityCollectionFromFile( *m_pTypeRegistry, mapPath, mapDesc ) )
+            if ( !EntityModel::Serializer::ReadEntityCollectionFromFile( *m_pTypeRegistry, mapPath, mapDesc, GetTaskSystem() ) )
             {
                 Error( "Entity map file (%s) is malformed!", mapPath.c_str() );
                 return Resource::CompilationResult::Failure;
@@ -13,7 +13,45 @@
 
 namespace KRG::Render
 {
-    void MeshCompiler::TransferMeshGeometry( RawAssets::RawMesh const& rawMesh, Mesh& mesh, int32_t maxBoneInfluences ) const
+    static void QuantizeVertexAttributes( RawAssets::RawMesh::VertexData const& vert, int32_t numUVChannels, StaticMeshVertex* pVertex )
+    {
+        pVertex->m_position = vert.m_position.ToFloat3();
+        EncodeOctahedralNormal( Vector( vert.m_normal ).GetNormalized3().ToFloat3(), pVertex->m_normal );
+
+        Float2 const& UV0 = vert.m_texCoords[0];
+        Float2 const& UV1 = ( numUVChannels > 1 ) ? vert.m_texCoords[1] : vert.m_texCoords[0];
+        pVertex->m_UV0[0] = meshopt_quantizeHalf( UV0.m_x );
+        pVertex->m_UV0[1] = meshopt_quantizeHalf( UV0.m_y );
+        pVertex->m_UV1[0] = meshopt_quantizeHalf( UV1.m_x );
+        pVertex->m_UV1[1] = meshopt_quantizeHalf( UV1.m_y );
+    }
+
+    // Quantize the bone weights to unorm8 while ensuring they still sum to exactly one
+    static void QuantizeBoneWeights( float const weights[4], uint8_t quantizedWeights[4] )
+    {
+        float const totalWeight = weights[0] + weights[1] + weights[2] + weights[3];
+        KRG_ASSERT( totalWeight > 0.0f ); // Validated before the geometry is transferred
+
+        int32_t quantizedTotal = 0;
+        int32_t largestWeightIdx = 0;
+        for ( int32_t i = 0; i < 4; i++ )
+        {
+            quantizedWeights[i] = (uint8_t) Math::RoundToInt( weights[i] / totalWeight * 255.0f );
+            quantizedTotal += quantizedWeights[i];
+
+            if ( weights[i] > weights[largestWeightIdx] )
+            {
+                largestWeightIdx = i;
+            }
+        }
+
+        // Apply any rounding error to the largest influence
+        quantizedWeights[largestWeightIdx] = (uint8_t) ( quantizedWeights[largestWeightIdx] + ( 255 - quantizedTotal ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void MeshCompiler::TransferMeshGeometry( RawAssets::RawMesh const& rawMesh, Mesh& mesh, TVector<uint32_t>& outIndices, int32_t maxBoneInfluences ) const
     {
         KRG_ASSERT( maxBoneInfluences > 0 && maxBoneInfluences <= 8 );
         KRG_ASSERT( maxBoneInfluences <= 4 );// TEMP HACK - we dont support 8 bones for now
@@ -31,7 +69,7 @@ namespace KRG::Render
 
             for ( auto idx : geometrySection.m_indices )
             {
-                mesh.m_indices.push_back( numVertices + idx );
+                outIndices.push_back( numVertices + idx );
             }
 
             numIndices += (uint32_t) geometrySection.m_indices.size();
@@ -60,33 +98,23 @@ namespace KRG::Render
                 for ( auto const& vert : geometrySection.m_vertices )
                 {
                     auto pVertex = new( pVertexMemory ) SkeletalMeshVertex();
-
-                    pVertex->m_position = vert.m_position;
-                    pVertex->m_normal = vert.m_normal;
-                    pVertex->m_UV0 = vert.m_texCoords[0];
-                    pVertex->m_UV1 = ( geometrySection.GetNumUVChannels() > 1 ) ? vert.m_texCoords[1] : vert.m_texCoords[0];
+                    QuantizeVertexAttributes( vert, geometrySection.GetNumUVChannels(), pVertex );
 
                     int32_t const numInfluences = (int32_t) vert.m_boneIndices.size();
                     KRG_ASSERT( numInfluences <= maxBoneInfluences && vert.m_boneIndices.size() == vert.m_boneWeights.size() );
 
-                    pVertex->m_boneIndices = Int4( InvalidIndex, InvalidIndex, InvalidIndex, InvalidIndex );
-                    pVertex->m_boneWeights = Float4::Zero;
+                    // Unused influences are left with a zero weight
+                    float weights[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
 
                     int32_t const numWeights = Math::Min( numInfluences, 4 );
                     for ( int32_t i = 0; i < numWeights; i++ )
                     {
-                        pVertex->m_boneIndices[i] = vert.m_boneIndices[i];
-                        pVertex->m_boneWeights[i] = vert.m_boneWeights[i];
+                        KRG_ASSERT( vert.m_boneIndices[i] >= 0 && vert.m_boneIndices[i] <= UINT8_MAX );
+                        pVertex->m_boneIndices[i] = (uint8_t) vert.m_boneIndices[i];
+                        weights[i] = vert.m_boneWeights[i];
                     }
 
-                    // Re-enable this when we add back support for 8 bone weights
-                    /*pVertex->m_boneIndices1 = Int4( InvalidIndex, InvalidIndex, InvalidIndex, InvalidIndex );
-                    pVertex->m_boneWeights1 = Float4::Zero;
-                    for ( int32_t i = 4; i < numInfluences; i++ )
-                    {
-                        pVertex->m_boneIndices1[i - 4] = vert.m_boneIndices[i];
-                        pVertex->m_boneWeights1[i - 4] = vert.m_boneWeights[i];
-                    }*/
+                    QuantizeBoneWeights( weights, pVertex->m_boneWeights );
 
                     pVertexMemory++;
 
@@ -111,11 +139,7 @@ namespace KRG::Render
                 for ( auto const& vert : geometrySection.m_vertices )
                 {
                     auto pVertex = new( pVertexMemory ) StaticMeshVertex();
-
-                    pVertex->m_position = vert.m_position;
-                    pVertex->m_normal = vert.m_normal;
-                    pVertex->m_UV0 = vert.m_texCoords[0];
-                    pVertex->m_UV1 = ( geometrySection.GetNumUVChannels() > 1 ) ? vert.m_texCoords[1] : vert.m_texCoords[0];
+                    QuantizeVertexAttributes( vert, geometrySection.GetNumUVChannels(), pVertex );
 
                     pVertexMemory++;
 
@@ -134,11 +158,6 @@ namespace KRG::Render
         mesh.m_vertexBuffer.m_type = RenderBuffer::Type::Vertex;
         mesh.m_vertexBuffer.m_usage = RenderBuffer::Usage::GPU_only;
 
-        mesh.m_indexBuffer.m_byteStride = sizeof( uint32_t );
-        mesh.m_indexBuffer.m_byteSize = (uint32_t) mesh.m_indices.size() * sizeof( uint32_t );
-        mesh.m_indexBuffer.m_type = RenderBuffer::Type::Index;
-        mesh.m_indexBuffer.m_usage = RenderBuffer::Usage::GPU_only;
-
         // Calculate bounding volume
         //-------------------------------------------------------------------------
         // TODO: use real algorithm to find minimal bounding box, for now use AABB
@@ -146,19 +165,140 @@ namespace KRG::Render
         mesh.m_bounds = OBB( meshAlignedBounds );
     }
 
-    void MeshCompiler::OptimizeMeshGeometry( Mesh& mesh ) const
+    void MeshCompiler::OptimizeMeshGeometry( Mesh& mesh, TVector<uint32_t>& indices ) const
     {
         size_t const vertexSize = (size_t) mesh.m_vertexBuffer.m_byteStride;
         size_t const numVertices = (size_t) mesh.GetNumVertices();
+        float const* pVertexPositions = (float const*) mesh.m_vertices.data();
+
+        // Triangles are only reordered within each section so that the section ranges stay valid
+        for ( auto const& section : mesh.m_sections )
+        {
+            uint32_t* pSectionIndices = &indices[section.m_startIndex];
+            meshopt_optimizeVertexCache( pSectionIndices, pSectionIndices, section.m_numIndices, numVertices );
+
+            // Reorder indices for overdraw, balancing overdraw and vertex cache efficiency
+            const float kThreshold = 1.01f; // allow up to 1% worse ACMR to get more reordering opportunities for overdraw
+            meshopt_optimizeOverdraw( pSectionIndices, pSectionIndices, section.m_numIndices, pVertexPositions, numVertices, vertexSize, kThreshold );
+        }
+    }
+
+    bool MeshCompiler::GenerateMeshLODs( MeshResourceDescriptor const& descriptor, Mesh& mesh, TVector<uint32_t>& indices ) const
+    {
+        KRG_ASSERT( mesh.m_LODs.empty() );
+
+        if ( descriptor.m_LODs.empty() )
+        {
+            return true;
+        }
+
+        // Validate settings
+        //-------------------------------------------------------------------------
+
+        float previousScreenSize = 1.0f;
+        for ( auto const& LODSettings : descriptor.m_LODs )
+        {
+            if ( LODSettings.m_triangleRatio <= 0.0f || LODSettings.m_triangleRatio >= 1.0f )
+            {
+                Error( "Invalid LOD triangle ratio (%.2f), needs to be in the range (0, 1)", LODSettings.m_triangleRatio );
+                return false;
+            }
+
+            if ( LODSettings.m_screenSize <= 0.0f || LODSettings.m_screenSize >= previousScreenSize )
+            {
+                Error( "Invalid LOD screen size (%.2f), LODs need to be sorted by decreasing screen size in the range (0, 1)", LODSettings.m_screenSize );
+                return false;
+            }
+
+            previousScreenSize = LODSettings.m_screenSize;
+        }
+
+        // Simplify each section separately so that materials remain correctly assigned
+        //-------------------------------------------------------------------------
+        // All LODs share the vertex buffer of the full detail mesh, the LOD indices are appended to the main index buffer
+        // The positions are always the first element of the vertex so we can simplify directly on the vertex data
+
+        size_t const vertexSize = (size_t) mesh.m_vertexBuffer.m_byteStride;
+        size_t const numVertices = (size_t) mesh.GetNumVertices();
+        float const* pVertexPositions = (float const*) mesh.m_vertices.data();
+        float const maxError = Math::Max( descriptor.m_maxLODError, 0.0f );
 
-        meshopt_optimizeVertexCache( &mesh.m_indices[0], &mesh.m_indices[0], mesh.m_indices.size(), mesh.m_vertices.size() );
+        TVector<uint32_t> simplifiedIndices;
+        uint32_t previousLODNumIndices = (uint32_t) indices.size();
 
-        // Reorder indices for overdraw, balancing overdraw and vertex cache efficiency
-        const float kThreshold = 1.01f; // allow up to 1% worse ACMR to get more reordering opportunities for overdraw
-        meshopt_optimizeOverdraw( &mesh.m_indices[0], &mesh.m_indices[0], mesh.m_indices.size(), (float*) &mesh.m_vertices[0], numVertices, vertexSize, kThreshold );
+        for ( auto const& LODSettings : descriptor.m_LODs )
+        {
+            Mesh::LOD lod;
+            lod.m_screenSizeThreshold = LODSettings.m_screenSize;
+
+            uint32_t numLODIndices = 0;
+            for ( auto const& section : mesh.m_sections )
+            {
+                size_t const targetNumIndices = Math::Max( size_t( 3 ), (size_t) ( section.m_numIndices * LODSettings.m_triangleRatio ) / 3 * 3 );
+                simplifiedIndices.resize( section.m_numIndices );
+
+                float resultError = 0.0f;
+                size_t const numSimplifiedIndices = meshopt_simplify( simplifiedIndices.data(), &indices[section.m_startIndex], section.m_numIndices, pVertexPositions, numVertices, vertexSize, targetNumIndices, maxError, &resultError );
+                simplifiedIndices.resize( numSimplifiedIndices );
 
-        // Vertex fetch optimization should go last as it depends on the final index order
-        meshopt_optimizeVertexFetch( &mesh.m_vertices[0], &mesh.m_indices[0], mesh.m_indices.size(), &mesh.m_vertices[0], numVertices, vertexSize );
+                // Simplification doesnt preserve vertex cache order
+                if ( numSimplifiedIndices > 0 )
+                {
+                    meshopt_optimizeVertexCache( simplifiedIndices.data(), simplifiedIndices.data(), numSimplifiedIndices, numVertices );
+                }
+
+                lod.m_sections.emplace_back( Mesh::GeometrySection( section.m_ID, (uint32_t) indices.size(), (uint32_t) numSimplifiedIndices ) );
+                indices.insert( indices.end(), simplifiedIndices.begin(), simplifiedIndices.end() );
+                numLODIndices += (uint32_t) numSimplifiedIndices;
+            }
+
+            // If the simplifier could not make any meaningful progress (error limit reached), there is no point in generating further LODs
+            if ( numLODIndices >= previousLODNumIndices * 0.95f )
+            {
+                indices.resize( indices.size() - numLODIndices );
+                Warning( "Mesh LOD generation stopped after %d LODs, the simplifier could not reduce the mesh further within the error limit (%.3f)", (int32_t) mesh.m_LODs.size(), maxError );
+                break;
+            }
+
+            mesh.m_LODs.emplace_back( lod );
+            previousLODNumIndices = numLODIndices;
+        }
+
+        return true;
+    }
+
+    void MeshCompiler::FinalizeMeshGeometry( Mesh& mesh, TVector<uint32_t>& indices ) const
+    {
+        size_t const vertexSize = (size_t) mesh.m_vertexBuffer.m_byteStride;
+        size_t const numVertices = (size_t) mesh.GetNumVertices();
+
+        // Vertex fetch optimization should go last as it depends on the final index order (including all LODs)
+        meshopt_optimizeVertexFetch( mesh.m_vertices.data(), indices.data(), indices.size(), mesh.m_vertices.data(), numVertices, vertexSize );
+
+        // Use 16bit indices whenever possible
+        //-------------------------------------------------------------------------
+
+        if ( numVertices <= UINT16_MAX )
+        {
+            mesh.m_indexBuffer.m_byteStride = sizeof( uint16_t );
+            mesh.m_indices.resize( indices.size() * sizeof( uint16_t ) );
+
+            auto pIndices = (uint16_t*) mesh.m_indices.data();
+            for ( auto i = 0u; i < indices.size(); i++ )
+            {
+                pIndices[i] = (uint16_t) indices[i];
+            }
+        }
+        else
+        {
+            mesh.m_indexBuffer.m_byteStride = sizeof( uint32_t );
+            mesh.m_indices.resize( indices.size() * sizeof( uint32_t ) );
+            memcpy( mesh.m_indices.data(), indices.data(), mesh.m_indices.size() );
+        }
+
+        mesh.m_indexBuffer.m_byteSize = (uint32_t) mesh.m_indices.size();
+        mesh.m_indexBuffer.m_type = RenderBuffer::Type::Index;
+        mesh.m_indexBuffer.m_usage = RenderBuffer::Usage::GPU_only;
     }
 
     void MeshCompiler::SetMeshDefaultMaterials( MeshResourceDescriptor const& descriptor, Mesh& mesh ) const
@@ -248,8 +388,16 @@ namespace KRG::Render
         //-------------------------------------------------------------------------
 
         StaticMesh staticMesh;
-        TransferMeshGeometry( *pRawMesh, staticMesh, 4 );
-        OptimizeMeshGeometry( staticMesh );
+        TVector<uint32_t> indices;
+        TransferMeshGeometry( *pRawMesh, staticMesh, indices, 4 );
+        OptimizeMeshGeometry( staticMesh, indices );
+
+        if ( !GenerateMeshLODs( resourceDescriptor, staticMesh, indices ) )
+        {
+            return CompilationFailed( ctx );
+        }
+
+        FinalizeMeshGeometry( staticMesh, indices );
         SetMeshDefaultMaterials( resourceDescriptor, staticMesh );
 
         // Serialize
@@ -324,9 +472,29 @@ namespace KRG::Render
         // Reflect FBX data into runtime format
         //-------------------------------------------------------------------------
 
+        // Bone indices are stored as 8bit values
+        if ( pRawMesh->GetNumBones() > UINT8_MAX + 1 )
+        {
+            return Error( "Skeletal meshes are limited to %d bones, this mesh has %d", UINT8_MAX + 1, pRawMesh->GetNumBones() );
+        }
+
+        if ( !ValidateSkinningData( *pRawMesh, maxBoneInfluences ) )
+        {
+            return CompilationFailed( ctx );
+        }
+
         SkeletalMesh skeletalMesh;
-        TransferMeshGeometry( *pRawMesh, skeletalMesh, maxBoneInfluences );
-        OptimizeMeshGeometry( skeletalMesh );
+        TVector<uint32_t> indices;
+        TransferMeshGeometry( *pRawMesh, skeletalMesh, indices, maxBoneInfluences );
+        OptimizeMeshGeometry( skeletalMesh, indices );
+
+        if ( !GenerateMeshLODs( resourceDescriptor, skeletalMesh, indices ) )
+        {
+            return CompilationFailed( ctx );
+        }
+
+        FinalizeMeshGeometry( skeletalMesh, indices );
+
         TransferSkeletalMeshData( *pRawMesh, skeletalMesh );
         SetMeshDefaultMaterials( resourceDescriptor, skeletalMesh );
 
@@ -356,6 +524,48 @@ namespace KRG::Render
         }
     }
 
+    bool SkeletalMeshCompiler::ValidateSkinningData( RawAssets::RawMesh const& rawMesh, int32_t maxBoneInfluences ) const
+    {
+        int32_t const numBones = rawMesh.GetNumBones();
+        int32_t const numSections = (int32_t) rawMesh.GetGeometrySections().size();
+        for ( int32_t sectionIdx = 0; sectionIdx < numSections; sectionIdx++ )
+        {
+            auto const& geometrySection = rawMesh.GetGeometrySections()[sectionIdx];
+            int32_t const numVertices = (int32_t) geometrySection.m_vertices.size();
+            for ( int32_t vertexIdx = 0; vertexIdx < numVertices; vertexIdx++ )
+            {
+                auto const& vert = geometrySection.m_vertices[vertexIdx];
+                if ( vert.m_boneIndices.size() != vert.m_boneWeights.size() || (int32_t) vert.m_boneIndices.size() > maxBoneInfluences )
+                {
+                    Error( "Invalid bone influences for vertex %d in geometry section %d", vertexIdx, sectionIdx );
+                    return false;
+                }
+
+                // Only the first 4 influences are stored (see TransferMeshGeometry)
+                float totalWeight = 0.0f;
+                int32_t const numWeights = Math::Min( (int32_t) vert.m_boneIndices.size(), 4 );
+                for ( int32_t i = 0; i < numWeights; i++ )
+                {
+                    if ( vert.m_boneIndices[i] < 0 || vert.m_boneIndices[i] >= numBones )
+                    {
+                        Error( "Vertex %d in geometry section %d references an invalid bone index (%d), the mesh has %d bones", vertexIdx, sectionIdx, vert.m_boneIndices[i], numBones );
+                        return false;
+                    }
+
+                    totalWeight += vert.m_boneWeights[i];
+                }
+
+                if ( totalWeight <= 0.0f )
+                {
+                    Error( "Vertex %d in geometry section %d has no weighted bone influences", vertexIdx, sectionIdx );
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
     void SkeletalMeshCompiler::TransferSkeletalMeshData( RawAssets::RawMesh const& rawMesh, SkeletalMesh& mesh ) const
     {
         KRG_ASSERT( rawMesh.IsSkeletalMesh() );
@@ -371,5 +581,13 @@ namespace KRG::Render
             mesh.m_bindPose.push_back( boneData[i].m_globalTransform );
             mesh.m_inverseBindPose.push_back( boneData[i].m_globalTransform.GetInverse() );
         }
+
+        // Calculate the bounds of the vertices influenced by each bone
+        // We use the final quantized vertex data since this is exactly what gets skinned at runtime
+        //-------------------------------------------------------------------------
+
+        auto pVertices = (SkeletalMeshVertex const*) mesh.m_vertices.data();
+        uint32_t const numVertices = (uint32_t) ( mesh.m_vertices.size() / sizeof( SkeletalMeshVertex ) );
+        CalculateBoneVertexBounds( pVertices, numVertices, (uint32_t) numBones, mesh.m_boneVertexBounds );
     }
 }
\ No newline at end of file
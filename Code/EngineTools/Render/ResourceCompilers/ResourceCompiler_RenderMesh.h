@@ -27,8 +27,11 @@ namespace KRG::Render
 
     protected:
 
-        void TransferMeshGeometry( RawAssets::RawMesh const& rawMesh, Mesh& mesh, int32_t maxBoneInfluences ) const;
-        void OptimizeMeshGeometry( Mesh& mesh ) const;
+        // The index data is built in a 32bit working buffer and only written to the mesh (in the smallest possible format) once finalized
+        void TransferMeshGeometry( RawAssets::RawMesh const& rawMesh, Mesh& mesh, TVector<uint32_t>& outIndices, int32_t maxBoneInfluences ) const;
+        void OptimizeMeshGeometry( Mesh& mesh, TVector<uint32_t>& indices ) const;
+        bool GenerateMeshLODs( MeshResourceDescriptor const& descriptor, Mesh& mesh, TVector<uint32_t>& indices ) const;
+        void FinalizeMeshGeometry( Mesh& mesh, TVector<uint32_t>& indices ) const;
         void SetMeshDefaultMaterials( MeshResourceDescriptor const& descriptor, Mesh& mesh ) const;
         void SetMeshInstallDependencies( Mesh const& mesh, Resource::ResourceHeader& hdr ) const;
         virtual bool GetReferencedResources( ResourceID const& resourceID, TVector<ResourceID>& outReferencedResources ) const override;
@@ -39,7 +42,7 @@ namespace KRG::Render
     class StaticMeshCompiler : public MeshCompiler
     {
         KRG_REGISTER_TYPE( StaticMeshCompiler );
-        static const int32_t s_version = 1;
+        static const int32_t s_version = 3;
 
     public:
 
@@ -52,7 +55,7 @@ namespace KRG::Render
     class SkeletalMeshCompiler : public MeshCompiler
     {
         KRG_REGISTER_TYPE( SkeletalMeshCompiler );
-        static const int32_t s_version = 4;
+        static const int32_t s_version = 7;
 
     public:
 
@@ -61,6 +64,8 @@ namespace KRG::Render
 
     private:
 
+        // Check that every vertex has at least one weighted influence and only references valid bones, the geometry transfer relies on this
+        bool ValidateSkinningData( RawAssets::RawMesh const& rawMesh, int32_t maxBoneInfluences ) const;
         void TransferSkeletalMeshData( RawAssets::RawMesh const& rawMesh, SkeletalMesh& mesh ) const;
     };
 }
\ No newline at end of file
@@ -19,6 +19,16 @@ namespace KRG::Render
 
     //-------------------------------------------------------------------------
 
+    struct KRG_ENGINETOOLS_API MeshLODSettings : public IRegisteredType
+    {
+        KRG_REGISTER_TYPE( MeshLODSettings );
+
+        KRG_EXPOSE float                                m_triangleRatio = 0.5f; // The fraction of the full detail triangle count this LOD should target
+        KRG_EXPOSE float                                m_screenSize = 0.25f; // Switch to this LOD once the mesh covers less than this fraction of the viewport height
+    };
+
+    //-------------------------------------------------------------------------
+
     struct KRG_ENGINETOOLS_API MeshResourceDescriptor : public Resource::ResourceDescriptor
     {
         KRG_REGISTER_TYPE( MeshResourceDescriptor );
@@ -31,6 +41,12 @@ namespace KRG::Render
 
         // Optional value that specifies the specific sub-mesh to compile, if this is not set, all sub-meshes contained in the source will be combined into a single mesh object
         KRG_EXPOSE String                               m_meshName;
+
+        // Optional LOD chain, each LOD is generated by simplifying the full detail mesh - LODs must be sorted by decreasing screen size
+        KRG_EXPOSE TVector<MeshLODSettings>             m_LODs;
+
+        // The maximum allowed simplification error (relative to the mesh extents) when generating LODs
+        KRG_EXPOSE float                                m_maxLODError = 0.05f;
     };
 
     //-------------------------------------------------------------------------
@@ -120,17 +120,20 @@ namespace KRG::Render
 
             if ( m_showVertices || m_showNormals )
             {
-                auto pVertex = reinterpret_cast<StaticMeshVertex const*>( m_pResource->GetVertexData().data() );
+                auto pVertex = reinterpret_cast<SkeletalMeshVertex const*>( m_pResource->GetVertexData().data() );
                 for ( auto i = 0; i < m_pResource->GetNumVertices(); i++ )
                 {
+                    Vector const vertexPosition( pVertex->m_position );
+
                     if ( m_showVertices )
                     {
-                        drawingCtx.DrawPoint( pVertex->m_position, Colors::Cyan );
+                        drawingCtx.DrawPoint( vertexPosition, Colors::Cyan );
                     }
 
                     if ( m_showNormals )
                     {
-                        drawingCtx.DrawLine( pVertex->m_position, pVertex->m_position + ( pVertex->m_normal * 0.15f ), Colors::Yellow );
+                        Vector const vertexNormal( DecodeOctahedralNormal( pVertex->m_normal ), 0.0f );
+                        drawingCtx.DrawLine( vertexPosition, vertexPosition + ( vertexNormal * 0.15f ), Colors::Yellow );
                     }
                     pVertex++;
                 }
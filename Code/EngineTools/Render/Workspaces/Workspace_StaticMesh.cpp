@@ -149,14 +149,17 @@ namespace KRG::Render
             auto pVertex = reinterpret_cast<StaticMeshVertex const*>( m_pResource->GetVertexData().data() );
             for ( auto i = 0; i < m_pResource->GetNumVertices(); i++ )
             {
+                Vector const vertexPosition( pVertex->m_position );
+
                 if ( m_showVertices )
                 {
-                    drawingContext.DrawPoint( pVertex->m_position, Colors::Cyan );
+                    drawingContext.DrawPoint( vertexPosition, Colors::Cyan );
                 }
 
                 if ( m_showNormals )
                 {
-                    drawingContext.DrawLine( pVertex->m_position, pVertex->m_position + ( pVertex->m_normal * 0.15f ), Colors::Yellow );
+                    Vector const vertexNormal( DecodeOctahedralNormal( pVertex->m_normal ), 0.0f );
+                    drawingContext.DrawLine( vertexPosition, vertexPosition + ( vertexNormal * 0.15f ), Colors::Yellow );
                 }
 
                 pVertex++;
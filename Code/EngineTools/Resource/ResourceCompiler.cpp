@@ -1,5 +1,6 @@
 #include "ResourceCompiler.h"
 #include "System/FileSystem/FileSystem.h"
+#include "System/Threading/TaskSystem.h"
 
 //-------------------------------------------------------------------------
 
@@ -30,15 +31,39 @@ namespace KRG::Resource
 
     //-------------------------------------------------------------------------
 
-    void Compiler::Initialize( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath )
+    CompilerTaskSystem::~CompilerTaskSystem()
+    {
+        if ( m_pTaskSystem != nullptr )
+        {
+            m_pTaskSystem->Shutdown();
+            KRG::Delete( m_pTaskSystem );
+        }
+    }
+
+    TaskSystem* CompilerTaskSystem::Get()
+    {
+        if ( m_pTaskSystem == nullptr )
+        {
+            m_pTaskSystem = KRG::New<TaskSystem>( m_maxWorkers );
+            m_pTaskSystem->Initialize();
+        }
+
+        return m_pTaskSystem;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void Compiler::Initialize( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, CompilerTaskSystem* pTaskSystem )
     {
         m_pTypeRegistry = &typeRegistry;
+        m_pTaskSystem = pTaskSystem;
         m_rawResourceDirectoryPath = rawResourceDirectoryPath;
     }
 
     void Compiler::Shutdown()
     {
         m_pTypeRegistry = nullptr;
+        m_pTaskSystem = nullptr;
         m_rawResourceDirectoryPath.Clear();
     }
 
@@ -8,6 +8,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace KRG { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace KRG::Resource
 {
     enum class CompilationResult
@@ -17,6 +21,48 @@ namespace KRG::Resource
         SuccessWithWarnings = 1,
     };
 
+    //-------------------------------------------------------------------------
+    // Persistent compiler workers
+    //-------------------------------------------------------------------------
+    // A resource compiler started with "-worker" stays alive and reads one request per line from stdin: "<compile|package> <resource path>"
+    // All compiler output is written to stdout and each request is terminated by a line containing the result marker followed by the result
+
+    namespace CompilerWorker
+    {
+        constexpr static char const* const s_compileCommand = "compile";
+        constexpr static char const* const s_packageCommand = "package";
+        constexpr static char const* const s_resultMarker = "#KRG_COMPILATION_RESULT#";
+
+        // The resource server runs a worker per core, so each worker only gets a couple of task threads
+        constexpr static uint32_t const s_maxTaskSystemWorkers = 2;
+    }
+
+    //-------------------------------------------------------------------------
+    // Compiler task system
+    //-------------------------------------------------------------------------
+    // Only a few compilers (e.g. large entity collections) split their work across threads, so the task system is only created on first use
+
+    class KRG_ENGINETOOLS_API CompilerTaskSystem
+    {
+    public:
+
+        explicit CompilerTaskSystem( uint32_t maxWorkers = UINT32_MAX ) : m_maxWorkers( maxWorkers ) {}
+        ~CompilerTaskSystem();
+
+        // Creates and initializes the task system if needed
+        TaskSystem* Get();
+
+    private:
+
+        CompilerTaskSystem( CompilerTaskSystem const& ) = delete;
+        CompilerTaskSystem& operator=( CompilerTaskSystem const& ) = delete;
+
+    private:
+
+        TaskSystem*                                     m_pTaskSystem = nullptr;
+        uint32_t const                                  m_maxWorkers;
+    };
+
     //-------------------------------------------------------------------------
 
     struct KRG_ENGINETOOLS_API CompileContext
@@ -54,7 +100,7 @@ namespace KRG::Resource
         String const& GetName() const { return m_name; }
         inline int32_t GetVersion() const { return m_version; }
 
-        void Initialize( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath );
+        void Initialize( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, CompilerTaskSystem* pTaskSystem = nullptr );
         void Shutdown();
 
         // The list of resource type we can compile
@@ -81,6 +127,9 @@ namespace KRG::Resource
         CompilationResult CompilationSucceededWithWarnings( CompileContext const& ctx ) const;
         CompilationResult CompilationFailed( CompileContext const& ctx ) const;
 
+        // Optional, only available when compiling in the resource compiler - only request it if the compilation will actually use it
+        inline TaskSystem* GetTaskSystem() const { return ( m_pTaskSystem != nullptr ) ? m_pTaskSystem->Get() : nullptr; }
+
         inline bool ConvertResourcePathToFilePath( ResourcePath const& resourcePath, FileSystem::Path& filePath ) const
         {
             if ( resourcePath.IsValid() )
@@ -98,6 +147,7 @@ namespace KRG::Resource
     protected:
 
         TypeSystem::TypeRegistry const*                 m_pTypeRegistry = nullptr;
+        CompilerTaskSystem*                             m_pTaskSystem = nullptr;
         FileSystem::Path                                m_rawResourceDirectoryPath;
         int32_t const                                   m_version;
         String const                                    m_name;
@@ -5,14 +5,14 @@
 
 namespace KRG::Resource
 {
-    CompilerRegistry::CompilerRegistry( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath )
+    CompilerRegistry::CompilerRegistry( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, CompilerTaskSystem* pTaskSystem )
     {
         TVector<TypeSystem::TypeInfo const*> compilerTypes = typeRegistry.GetAllDerivedTypes( Compiler::GetStaticTypeID(), false, false, true );
 
         for ( auto pCompilerType : compilerTypes )
         {
             auto pCreatedCompiler = Cast<Compiler>( pCompilerType->CreateType() );
-            pCreatedCompiler->Initialize( typeRegistry, rawResourceDirectoryPath );
+            pCreatedCompiler->Initialize( typeRegistry, rawResourceDirectoryPath, pTaskSystem );
             m_compilers.emplace_back( pCreatedCompiler );
             RegisterCompiler( pCreatedCompiler );
         }
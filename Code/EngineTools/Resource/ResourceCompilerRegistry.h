@@ -14,7 +14,7 @@ namespace KRG::Resource
     {
     public:
 
-        CompilerRegistry( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath );
+        CompilerRegistry( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, CompilerTaskSystem* pTaskSystem = nullptr );
         ~CompilerRegistry();
 
         //-------------------------------------------------------------------------
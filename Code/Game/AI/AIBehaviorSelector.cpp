@@ -46,4 +46,37 @@ namespace KRG::AI
             m_pActiveBehavior->Update( m_actionContext );
         }
     }
+
+    void BehaviorSelector::Reset()
+    {
+        if ( m_pActiveBehavior != nullptr )
+        {
+            m_pActiveBehavior->Stop( m_actionContext, Behavior::StopReason::Interrupted );
+            m_pActiveBehavior = nullptr;
+        }
+
+        #if KRG_DEVELOPMENT_TOOLS
+        m_actionLog.clear();
+        #endif
+    }
+
+    #if KRG_DEVELOPMENT_TOOLS
+    bool BehaviorSelector::IsReset() const
+    {
+        if ( m_pActiveBehavior != nullptr )
+        {
+            return false;
+        }
+
+        for ( auto pBehavior : m_behaviors )
+        {
+            if ( pBehavior->IsActive() )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    #endif
 }
\ No newline at end of file
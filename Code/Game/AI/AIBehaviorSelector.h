@@ -45,6 +45,14 @@ namespace KRG::AI
         // Update the currently active actions
         void Update();
 
+        // Stop the active behavior (releasing anything it has requested) and return to the initial state
+        void Reset();
+
+        #if KRG_DEVELOPMENT_TOOLS
+        // Is the selector in its initial state i.e. no behavior has been started since the last reset
+        bool IsReset() const;
+        #endif
+
     private:
 
         BehaviorContext const&                                    m_actionContext;
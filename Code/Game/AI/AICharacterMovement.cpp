@@ -0,0 +1,255 @@
+#include "AICharacterMovement.h"
+#include "Engine/Physics/PhysicsScene.h"
+#include "Engine/Physics/PhysicsSystem.h"
+#include "Engine/Physics/PhysicsLayers.h"
+#include "System/Math/MathRandom.h"
+#include "System/Time/Timers.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG::AI
+{
+    void CharacterMovementBatch::Resolve( TaskSystem* pTaskSystem, Physics::Scene* pPhysicsScene, Seconds deltaTime, CharacterMoveRequest const* pRequests, uint32_t numRequests )
+    {
+        KRG_PROFILE_FUNCTION_AI();
+        KRG_ASSERT( pPhysicsScene != nullptr );
+        KRG_ASSERT( numRequests == 0 || pRequests != nullptr );
+
+        if ( numRequests == 0 )
+        {
+            return;
+        }
+
+        // The result buffers point into themselves, so we never move them, we only grow by recreating the whole array
+        if ( m_sweepResults.size() < numRequests )
+        {
+            m_sweepResults.clear();
+            m_sweepResults.resize( numRequests );
+        }
+
+        m_filters.resize( numRequests );
+        m_sweepRequests.resize( numRequests );
+        m_finalCapsuleWorldTransforms.resize( numRequests );
+
+        // Create sweep requests
+        //-------------------------------------------------------------------------
+        // Sweep from the translated position to the bottom of the capsule including some "gravity"
+
+        float const verticalDistanceAllowedToTravelThisFrame = ( deltaTime * 0.5f );
+
+        for ( uint32_t i = 0; i < numRequests; i++ )
+        {
+            CharacterMoveRequest const& request = pRequests[i];
+
+            Physics::QueryFilter& filter = m_filters[i];
+            filter = Physics::QueryFilter( Physics::CreateLayerMask( Physics::Layers::Environment ) );
+            if ( request.m_entityID.IsValid() )
+            {
+                filter.AddIgnoredEntity( request.m_entityID );
+            }
+
+            float const halfHeight = request.m_capsuleCylinderPortionHalfHeight + s_sphereRadiusReduction;
+            Physics::SweepRequest& sweepRequest = m_sweepRequests[i];
+            sweepRequest.m_shape = Physics::QueryShape::Sphere( request.m_capsuleRadius );
+            sweepRequest.m_start = request.m_capsuleWorldTransform.GetTranslation() + request.m_deltaTranslation + Vector( 0, 0, halfHeight );
+            sweepRequest.m_end = sweepRequest.m_start - Vector( 0, 0, ( halfHeight * 2 ) + verticalDistanceAllowedToTravelThisFrame );
+            sweepRequest.m_pFilter = &filter;
+        }
+
+        // Run all sweeps
+        //-------------------------------------------------------------------------
+        // The batch acquires the read locks itself, one per task
+
+        pPhysicsScene->SweepBatch( pTaskSystem, m_sweepRequests.data(), numRequests, m_sweepResults.data() );
+
+        // Calculate final transforms
+        //-------------------------------------------------------------------------
+
+        for ( uint32_t i = 0; i < numRequests; i++ )
+        {
+            CharacterMoveRequest const& request = pRequests[i];
+            Physics::SweepResultBuffer<1> const& sweepResults = m_sweepResults[i];
+            Vector const halfHeightVector( 0, 0, request.m_capsuleCylinderPortionHalfHeight + s_sphereRadiusReduction );
+
+            Vector capsuleFinalPosition = request.m_capsuleWorldTransform.GetTranslation();
+            if ( sweepResults.hasBlock )
+            {
+                // If we started inside something, we stay where we are
+                if ( !sweepResults.HadInitialOverlap() )
+                {
+                    capsuleFinalPosition = sweepResults.GetShapePosition() + halfHeightVector;
+                }
+            }
+            else
+            {
+                capsuleFinalPosition = m_sweepRequests[i].m_end + halfHeightVector;
+            }
+
+            m_finalCapsuleWorldTransforms[i] = request.m_capsuleWorldTransform;
+            m_finalCapsuleWorldTransforms[i].SetTranslation( capsuleFinalPosition );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if KRG_DEVELOPMENT_TOOLS
+    // A copy of the original per-AI capsule move (CharacterPhysicsController::TryMoveCapsule): one read lock and one sphere sweep per call
+    // This is kept independent of the batch code so that it can serve as the reference for the batched results
+    static Transform ReferenceMoveCapsule( Physics::Scene* pPhysicsScene, Seconds deltaTime, CharacterMoveRequest const& request )
+    {
+        Transform const& capsuleWorldTransform = request.m_capsuleWorldTransform;
+
+        // Create sphere to correct Z-position
+        //-------------------------------------------------------------------------
+
+        float const sphereRadiusReduction = 0.2f;
+        Vector const sphereOrigin = capsuleWorldTransform.GetTranslation();
+
+        // Attempt a sweep from current position to the bottom of the capsule including some "gravity"
+        float const verticalDistanceAllowedToTravelThisFrame = ( deltaTime * 0.5f );
+        Vector halfHeightVector = Vector( 0, 0, request.m_capsuleCylinderPortionHalfHeight + sphereRadiusReduction );
+        Vector sweepStartPos = sphereOrigin + request.m_deltaTranslation + halfHeightVector;
+        Vector sweepEndPos = sweepStartPos - Vector( 0, 0, ( ( request.m_capsuleCylinderPortionHalfHeight + sphereRadiusReduction ) * 2 ) + verticalDistanceAllowedToTravelThisFrame );
+        Vector capsuleFinalPosition = sphereOrigin;
+
+        //-------------------------------------------------------------------------
+
+        Physics::QueryFilter filter;
+        filter.SetLayerMask( Physics::CreateLayerMask( Physics::Layers::Environment ) );
+        if ( request.m_entityID.IsValid() )
+        {
+            filter.AddIgnoredEntity( request.m_entityID );
+        }
+
+        pPhysicsScene->AcquireReadLock();
+
+        Physics::SweepResults sweepResults;
+        if ( pPhysicsScene->SphereSweep( request.m_capsuleRadius, sweepStartPos, sweepEndPos, filter, sweepResults ) )
+        {
+            if ( !sweepResults.HadInitialOverlap() )
+            {
+                capsuleFinalPosition = sweepResults.GetShapePosition() + halfHeightVector;
+            }
+        }
+        else
+        {
+            capsuleFinalPosition = sweepEndPos + halfHeightVector;
+        }
+
+        pPhysicsScene->ReleaseReadLock();
+
+        //-------------------------------------------------------------------------
+
+        Transform finalCapsuleWorldTransform = capsuleWorldTransform;
+        finalCapsuleWorldTransform.SetTranslation( capsuleFinalPosition );
+        return finalCapsuleWorldTransform;
+    }
+
+    CharacterMovementTestResult RunCharacterMovementTest( Physics::PhysicsSystem& physicsSystem, TaskSystem* pTaskSystem, uint32_t numAgents, uint32_t numFrames, uint32_t seed )
+    {
+        static constexpr float const s_groundHalfExtent = 50.0f;
+        static constexpr float const s_capsuleRadius = 0.35f;
+        static constexpr float const s_capsuleHalfHeight = 0.5f;
+        static constexpr uint32_t const s_numSteps = 64;
+
+        CharacterMovementTestResult result;
+        result.m_numAgents = numAgents;
+        result.m_numFrames = numFrames;
+
+        Math::RNG rng( seed );
+        Seconds const deltaTime = 1.0f / 30.0f;
+        uint32_t const environmentLayerMask = Physics::CreateLayerMask( Physics::Layers::Environment );
+
+        // Create the environment: a ground box and a set of random steps on top of it
+        //-------------------------------------------------------------------------
+
+        Physics::Scene* pScene = physicsSystem.CreateScene();
+        pScene->AddStaticTestBox( Transform( Quaternion::Identity, Vector( 0, 0, -0.5f ) ), Vector( s_groundHalfExtent, s_groundHalfExtent, 0.5f ), environmentLayerMask );
+
+        for ( uint32_t i = 0; i < s_numSteps; i++ )
+        {
+            Vector const position( rng.GetFloat( -s_groundHalfExtent, s_groundHalfExtent ), rng.GetFloat( -s_groundHalfExtent, s_groundHalfExtent ), 0.0f );
+            Vector const halfExtents( rng.GetFloat( 0.5f, 4.0f ), rng.GetFloat( 0.5f, 4.0f ), rng.GetFloat( 0.05f, 0.2f ) );
+            pScene->AddStaticTestBox( Transform( Quaternion::Identity, position ), halfExtents, environmentLayerMask );
+        }
+
+        // Create the agents in a grid and all their per-frame deltas up front
+        //-------------------------------------------------------------------------
+
+        TVector<CharacterMoveRequest> requests( numAgents );
+        uint32_t const gridSize = Math::Max( 1u, (uint32_t) Math::Ceiling( Math::Sqrt( (float) numAgents ) ) );
+        float const gridSpacing = ( s_groundHalfExtent * 1.5f ) / gridSize;
+
+        for ( uint32_t i = 0; i < numAgents; i++ )
+        {
+            float const x = ( ( i % gridSize ) * gridSpacing ) - ( s_groundHalfExtent * 0.75f );
+            float const y = ( ( i / gridSize ) * gridSpacing ) - ( s_groundHalfExtent * 0.75f );
+            float const z = s_capsuleRadius + s_capsuleHalfHeight + rng.GetFloat( 0.0f, 0.5f );
+
+            requests[i].m_capsuleWorldTransform = Transform( Quaternion::Identity, Vector( x, y, z ) );
+            requests[i].m_capsuleRadius = s_capsuleRadius;
+            requests[i].m_capsuleCylinderPortionHalfHeight = s_capsuleHalfHeight;
+        }
+
+        TVector<Vector> deltaTranslations( numAgents * numFrames );
+        for ( auto& deltaTranslation : deltaTranslations )
+        {
+            deltaTranslation = Vector( rng.GetFloat( -0.1f, 0.1f ), rng.GetFloat( -0.1f, 0.1f ), 0.0f );
+        }
+
+        // Simulate
+        //-------------------------------------------------------------------------
+
+        TVector<CharacterMoveRequest> batchedRequests = requests;
+        TVector<CharacterMoveRequest> repeatedRequests = requests;
+        CharacterMovementBatch batch, repeatedBatch;
+
+        for ( uint32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+        {
+            for ( uint32_t i = 0; i < numAgents; i++ )
+            {
+                Vector const& deltaTranslation = deltaTranslations[frameIdx * numAgents + i];
+                requests[i].m_deltaTranslation = deltaTranslation;
+                batchedRequests[i].m_deltaTranslation = deltaTranslation;
+                repeatedRequests[i].m_deltaTranslation = deltaTranslation;
+            }
+
+            // Per-agent reference: one lock and one sweep per AI on the calling thread
+            Timer<PlatformClock> timer;
+            for ( uint32_t i = 0; i < numAgents; i++ )
+            {
+                requests[i].m_capsuleWorldTransform = ReferenceMoveCapsule( pScene, deltaTime, requests[i] );
+            }
+            result.m_perAgentTime += timer.GetElapsedTimeMilliseconds();
+
+            // Batched
+            timer.Start();
+            batch.Resolve( pTaskSystem, pScene, deltaTime, batchedRequests.data(), numAgents );
+            result.m_batchedTime += timer.GetElapsedTimeMilliseconds();
+
+            repeatedBatch.Resolve( pTaskSystem, pScene, deltaTime, repeatedRequests.data(), numAgents );
+
+            // Compare
+            for ( uint32_t i = 0; i < numAgents; i++ )
+            {
+                batchedRequests[i].m_capsuleWorldTransform = batch.GetFinalCapsuleWorldTransform( i );
+                repeatedRequests[i].m_capsuleWorldTransform = repeatedBatch.GetFinalCapsuleWorldTransform( i );
+
+                Float3 const expectedPosition = requests[i].m_capsuleWorldTransform.GetTranslation().ToFloat3();
+                Float3 const batchedPosition = batchedRequests[i].m_capsuleWorldTransform.GetTranslation().ToFloat3();
+                Float3 const repeatedPosition = repeatedRequests[i].m_capsuleWorldTransform.GetTranslation().ToFloat3();
+                if ( memcmp( &expectedPosition, &batchedPosition, sizeof( Float3 ) ) != 0 || memcmp( &expectedPosition, &repeatedPosition, sizeof( Float3 ) ) != 0 )
+                {
+                    result.m_numMismatches++;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        KRG::Delete( pScene );
+        return result;
+    }
+    #endif
+}
\ No newline at end of file
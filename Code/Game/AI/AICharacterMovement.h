@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Game/_Module/API.h"
+#include "Engine/Physics/PhysicsQuery.h"
+#include "Engine/Entity/EntityIDs.h"
+#include "System/Math/Transform.h"
+#include "System/Time/Time.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG { class TaskSystem; }
+
+namespace KRG::Physics
+{
+    class Scene;
+    class PhysicsSystem;
+}
+
+//-------------------------------------------------------------------------
+
+namespace KRG::AI
+{
+    // All the data needed to resolve a single capsule move, this is a copy so resolving doesnt need to touch the character component
+    struct CharacterMoveRequest
+    {
+        Transform                               m_capsuleWorldTransform;
+        Vector                                  m_deltaTranslation = Vector::Zero;
+        Quaternion                              m_deltaRotation = Quaternion::Identity;
+        float                                   m_capsuleRadius = 0.0f;
+        float                                   m_capsuleCylinderPortionHalfHeight = 0.0f;
+        EntityID                                m_entityID;     // The entity to ignore for the sweep (optional)
+    };
+
+    //-------------------------------------------------------------------------
+    // Character Movement Batch
+    //-------------------------------------------------------------------------
+    // Resolves a set of capsule moves against the environment: each move is translated and then snapped to the floor via a downwards sphere sweep
+    // All the sweeps are run as a single batched scene query (i.e. one read lock per batch task rather than one per move)
+    // Each result only depends on its own request, so the results are identical regardless of the batch size or the number of worker threads
+
+    class KRG_GAME_API CharacterMovementBatch
+    {
+    public:
+
+        // The reduction applied to the capsule's cylinder portion when sweeping for the floor
+        static constexpr float const s_sphereRadiusReduction = 0.2f;
+
+    public:
+
+        void Resolve( TaskSystem* pTaskSystem, Physics::Scene* pPhysicsScene, Seconds deltaTime, CharacterMoveRequest const* pRequests, uint32_t numRequests );
+
+        // Get the final capsule transform for the request at the specified index of the last resolve, the rotation delta is not applied
+        inline Transform const& GetFinalCapsuleWorldTransform( uint32_t requestIdx ) const { return m_finalCapsuleWorldTransforms[requestIdx]; }
+
+    private:
+
+        TVector<Physics::QueryFilter>           m_filters;
+        TVector<Physics::SweepRequest>          m_sweepRequests;
+        TVector<Physics::SweepResultBuffer<1>>  m_sweepResults;
+        TVector<Transform>                      m_finalCapsuleWorldTransforms;
+    };
+
+    //-------------------------------------------------------------------------
+    // Headless Movement Test
+    //-------------------------------------------------------------------------
+    // Builds a standalone physics scene (ground plus random steps) and moves a grid of agents over it for a number of frames
+    // Each frame is resolved three times: per-agent (a copy of the previous one read lock and one sweep per AI path), batched and batched again
+    // All three need to produce bitwise identical transforms for the test to pass
+
+    #if KRG_DEVELOPMENT_TOOLS
+    struct CharacterMovementTestResult
+    {
+        inline bool WasSuccessful() const { return m_numMismatches == 0; }
+
+    public:
+
+        uint32_t                                m_numAgents = 0;
+        uint32_t                                m_numFrames = 0;
+        uint32_t                                m_numMismatches = 0;
+        Milliseconds                            m_perAgentTime = 0.0f;
+        Milliseconds                            m_batchedTime = 0.0f;
+    };
+
+    KRG_GAME_API CharacterMovementTestResult RunCharacterMovementTest( Physics::PhysicsSystem& physicsSystem, TaskSystem* pTaskSystem, uint32_t numAgents, uint32_t numFrames, uint32_t seed );
+    #endif
+}
\ No newline at end of file
@@ -1,21 +1,21 @@
 #pragma once
 #include "System/Math/Quaternion.h"
-#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
-namespace KRG { class EntityWorldUpdateContext; }
-
 namespace KRG::Physics
 {
     class CharacterComponent;
-    class Scene;
 }
 
 //-------------------------------------------------------------------------
 
 namespace KRG::AI
 {
+    class CharacterMovementSystem;
+
+    //-------------------------------------------------------------------------
+
     class CharacterPhysicsController final
     {
     public:
@@ -26,7 +26,8 @@ namespace KRG::AI
             KRG_ASSERT( m_pCharacterComponent != nullptr );
         }
 
-        bool TryMoveCapsule( EntityWorldUpdateContext const& ctx, Physics::Scene* pPhysicsScene, Vector const& deltaTranslation, Quaternion const& deltaRotation );
+        // Request a capsule move for this frame, the move is resolved (together with all other AI moves) once all entities have been updated
+        void RequestMove( CharacterMovementSystem* pMovementSystem, Vector const& deltaTranslation, Quaternion const& deltaRotation );
 
     public:
 
@@ -0,0 +1,212 @@
+#include "AIThinkLOD.h"
+#include "System/Math/MathRandom.h"
+#include "System/Time/Timers.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG::AI
+{
+    void ThinkLODScheduler::Update( ThinkLODSettings const& settings, Seconds deltaTime, Vector const* pReferencePosition, ThinkLODState* const* ppAgents, uint32_t numAgents )
+    {
+        KRG_PROFILE_FUNCTION_AI();
+        KRG_ASSERT( numAgents == 0 || ppAgents != nullptr );
+
+        m_frameIdx++;
+        m_numThinkingAgents = 0;
+        memset( m_numAgentsPerTier, 0, sizeof( m_numAgentsPerTier ) );
+
+        // Update tiers and the interval tiers
+        //-------------------------------------------------------------------------
+
+        for ( uint32_t i = 0; i < numAgents; i++ )
+        {
+            ThinkLODState& agent = *ppAgents[i];
+            agent.m_accumulatedTime += deltaTime;
+            agent.m_timeSinceLastSeen = agent.m_isVisible ? Seconds( 0.0f ) : agent.m_timeSinceLastSeen + deltaTime;
+
+            int32_t tierIdx = 0;
+            if ( pReferencePosition != nullptr )
+            {
+                float const distanceSq = agent.m_position.GetDistanceSquared3( *pReferencePosition );
+                while ( tierIdx < ThinkLODSettings::s_numTiers - 1 && distanceSq > Math::Sqr( settings.m_tierDistances[tierIdx] ) )
+                {
+                    tierIdx++;
+                }
+
+                if ( agent.m_timeSinceLastSeen > settings.m_visibilityTimeout )
+                {
+                    tierIdx = Math::Min( tierIdx + 1, ThinkLODSettings::s_numTiers - 1 );
+                }
+            }
+
+            agent.m_tier = (ThinkTier) tierIdx;
+            m_numAgentsPerTier[tierIdx]++;
+
+            if ( agent.m_tier == ThinkTier::Low )
+            {
+                agent.m_shouldThink = false;
+            }
+            else
+            {
+                uint32_t const updateInterval = Math::Max( 1u, settings.m_tierUpdateIntervals[tierIdx] );
+                agent.m_shouldThink = ( ( m_frameIdx + i ) % updateInterval ) == 0;
+            }
+        }
+
+        // Round-robin the low tier
+        //-------------------------------------------------------------------------
+        // Low tier agents think at most once per update interval, and we never run more than the budget per frame
+
+        uint32_t const numLowTierAgents = m_numAgentsPerTier[(int32_t) ThinkTier::Low];
+        if ( numLowTierAgents > 0 )
+        {
+            uint32_t const lowTierUpdateInterval = Math::Max( 1u, settings.m_tierUpdateIntervals[(int32_t) ThinkTier::Low] );
+            uint32_t const numLowTierThinks = Math::Min( ( numLowTierAgents + lowTierUpdateInterval - 1 ) / lowTierUpdateInterval, Math::Max( 1u, settings.m_maxLowTierThinksPerFrame ) );
+
+            uint32_t agentIdx = m_lowTierCursor % numAgents;
+            uint32_t numSelected = 0;
+            for ( uint32_t i = 0; i < numAgents && numSelected < numLowTierThinks; i++ )
+            {
+                ThinkLODState& agent = *ppAgents[agentIdx];
+                if ( agent.m_tier == ThinkTier::Low )
+                {
+                    agent.m_shouldThink = true;
+                    numSelected++;
+                }
+
+                agentIdx = ( agentIdx + 1 ) % numAgents;
+            }
+
+            m_lowTierCursor = agentIdx;
+        }
+
+        // Hand out the accumulated time
+        //-------------------------------------------------------------------------
+
+        for ( uint32_t i = 0; i < numAgents; i++ )
+        {
+            ThinkLODState& agent = *ppAgents[i];
+            if ( agent.m_shouldThink )
+            {
+                agent.m_thinkDeltaTime = agent.m_accumulatedTime;
+                agent.m_accumulatedTime = 0.0f;
+                m_numThinkingAgents++;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if KRG_DEVELOPMENT_TOOLS
+    namespace
+    {
+        // A fixed cost stand-in for the behavior update
+        static float SimulateThink( ThinkLODState const& agent )
+        {
+            float result = agent.m_position.m_x;
+            for ( int32_t i = 0; i < 256; i++ )
+            {
+                result = Math::Sin( result + agent.m_thinkDeltaTime.ToFloat() ) * Math::Cos( result - agent.m_position.m_y );
+            }
+            return result;
+        }
+    }
+
+    TVector<ThinkLODCrowdTestResult> RunThinkLODCrowdTest( ThinkLODSettings const& settings, uint32_t numFrames, uint32_t seed )
+    {
+        static constexpr uint32_t const s_crowdSizes[] = { 64, 256, 1024, 4096 };
+        static constexpr float const s_areaPerAgent = 25.0f; // m2
+        static constexpr float const s_maxMoveDistance = 0.1f;
+
+        Seconds const deltaTime = 1.0f / 30.0f;
+        Vector const playerPosition = Vector::Zero;
+        Vector const playerForward = Vector::UnitX;
+        float const halfFOVCos = Math::Cos( Math::PiDivTwo / 2 );
+
+        TVector<ThinkLODCrowdTestResult> results;
+        for ( uint32_t const numAgents : s_crowdSizes )
+        {
+            ThinkLODCrowdTestResult& result = results.emplace_back();
+            result.m_numAgents = numAgents;
+
+            // Spread the agents over a disc around the player, the disc grows with the crowd size so the density stays the same
+            Math::RNG rng( seed );
+            float const crowdRadius = Math::Sqrt( ( numAgents * s_areaPerAgent ) / Math::Pi );
+
+            TVector<ThinkLODState> agents( numAgents );
+            TVector<ThinkLODState*> agentPtrs( numAgents );
+            TVector<Seconds> totalThinkTimes( numAgents, Seconds( 0.0f ) );
+            for ( uint32_t i = 0; i < numAgents; i++ )
+            {
+                float const radius = crowdRadius * Math::Sqrt( rng.GetFloat() );
+                float const angle = rng.GetFloat( 0.0f, Math::TwoPi );
+                agents[i].m_position = Vector( radius * Math::Cos( angle ), radius * Math::Sin( angle ), 0.0f );
+                agentPtrs[i] = &agents[i];
+            }
+
+            // Simulate
+            //-------------------------------------------------------------------------
+
+            ThinkLODScheduler scheduler;
+            float sink = 0.0f;
+
+            for ( uint32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                // Move the agents a little and update their visibility (a view cone in front of the player)
+                for ( auto& agent : agents )
+                {
+                    agent.m_position += Vector( rng.GetFloat( -s_maxMoveDistance, s_maxMoveDistance ), rng.GetFloat( -s_maxMoveDistance, s_maxMoveDistance ), 0.0f );
+                    Vector const directionToAgent = ( agent.m_position - playerPosition ).GetNormalized3();
+                    agent.m_isVisible = directionToAgent.GetDot3( playerForward ) >= halfFOVCos;
+                }
+
+                // LOD
+                Timer<PlatformClock> timer;
+                scheduler.Update( settings, deltaTime, &playerPosition, agentPtrs.data(), numAgents );
+                for ( uint32_t i = 0; i < numAgents; i++ )
+                {
+                    if ( agents[i].ShouldThink() )
+                    {
+                        sink += SimulateThink( agents[i] );
+                        totalThinkTimes[i] += agents[i].GetThinkDeltaTime();
+                        result.m_numThinks++;
+                    }
+                }
+                result.m_time += timer.GetElapsedTimeMilliseconds();
+
+                // Full rate reference
+                timer.Start();
+                for ( uint32_t i = 0; i < numAgents; i++ )
+                {
+                    sink += SimulateThink( agents[i] );
+                    result.m_numFullRateThinks++;
+                }
+                result.m_fullRateTime += timer.GetElapsedTimeMilliseconds();
+            }
+
+            // Validate
+            //-------------------------------------------------------------------------
+            // Every agent needs to have been given exactly the elapsed time (minus whatever is still waiting for its next think)
+
+            float const elapsedTime = deltaTime.ToFloat() * numFrames;
+            for ( uint32_t i = 0; i < numAgents; i++ )
+            {
+                float const accountedTime = ( totalThinkTimes[i] + agents[i].m_accumulatedTime ).ToFloat();
+                if ( !Math::IsNearEqual( accountedTime, elapsedTime, elapsedTime * 1e-4f ) )
+                {
+                    result.m_isTimeAccumulationValid = false;
+                }
+            }
+
+            // Make sure the think work isnt optimized out
+            if ( sink == FLT_MAX )
+            {
+                result.m_numThinks++;
+            }
+        }
+
+        return results;
+    }
+    #endif
+}
\ No newline at end of file
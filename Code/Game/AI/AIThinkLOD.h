@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Game/_Module/API.h"
+#include "System/Math/Vector.h"
+#include "System/Time/Time.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// AI Think LOD
+//-------------------------------------------------------------------------
+// Controls how often each AI runs its behaviors (i.e. "thinks"), animation and movement are still updated every frame
+//
+// * Agents are placed into tiers based on their distance to the player, agents that havent been seen recently are dropped one tier
+// * Agents in the interval tiers think every N frames, offset by their index so that the updates are spread evenly across frames
+// * The lowest tier is round-robin scheduled with a per-frame budget, so the cost of far away agents doesnt grow with the crowd size
+// * When an agent thinks, it receives the full time elapsed since its last think as its delta time
+
+namespace KRG::AI
+{
+    enum class ThinkTier : uint8_t
+    {
+        Full = 0,
+        High,
+        Medium,
+        Low,
+
+        NumTiers
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct ThinkLODSettings
+    {
+        static constexpr int32_t const s_numTiers = (int32_t) ThinkTier::NumTiers;
+
+    public:
+
+        float                                   m_tierDistances[s_numTiers - 1] = { 15.0f, 30.0f, 60.0f };  // The max distance for each tier, anything further is in the low tier
+        uint32_t                                m_tierUpdateIntervals[s_numTiers] = { 1, 2, 4, 8 };         // The number of frames between thinks for each tier
+        Seconds                                 m_visibilityTimeout = 2.0f;                                 // Agents that havent been seen for this long drop one tier
+        uint32_t                                m_maxLowTierThinksPerFrame = 32;                            // The max number of low tier agents that think per frame
+    };
+
+    //-------------------------------------------------------------------------
+
+    // The per-agent think state, the position and visibility need to be set before each scheduler update
+    struct ThinkLODState
+    {
+        inline bool ShouldThink() const { return m_shouldThink; }
+        inline Seconds GetThinkDeltaTime() const { return m_thinkDeltaTime; }
+        inline ThinkTier GetTier() const { return m_tier; }
+
+    public:
+
+        Vector                                  m_position = Vector::Zero;
+        bool                                    m_isVisible = false;
+
+        Seconds                                 m_timeSinceLastSeen = FLT_MAX;
+        Seconds                                 m_accumulatedTime = 0.0f;
+        Seconds                                 m_thinkDeltaTime = 0.0f;
+        ThinkTier                               m_tier = ThinkTier::Full;
+        bool                                    m_shouldThink = false;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class KRG_GAME_API ThinkLODScheduler
+    {
+    public:
+
+        // Update the tiers and select the agents that think this frame
+        // The agent order should be stable across frames, since it is used to spread the updates
+        // If there is no reference position (i.e. no player), all agents think every frame
+        void Update( ThinkLODSettings const& settings, Seconds deltaTime, Vector const* pReferencePosition, ThinkLODState* const* ppAgents, uint32_t numAgents );
+
+        // Stats for the last update
+        inline uint32_t GetNumThinkingAgents() const { return m_numThinkingAgents; }
+        inline uint32_t GetNumAgentsInTier( ThinkTier tier ) const { return m_numAgentsPerTier[(int32_t) tier]; }
+
+    private:
+
+        uint64_t                                m_frameIdx = 0;
+        uint32_t                                m_lowTierCursor = 0;
+        uint32_t                                m_numThinkingAgents = 0;
+        uint32_t                                m_numAgentsPerTier[ThinkLODSettings::s_numTiers] = { 0 };
+    };
+
+    //-------------------------------------------------------------------------
+    // Headless Crowd Test
+    //-------------------------------------------------------------------------
+    // Runs the scheduler and a fixed cost stand-in for the behavior update over crowds of increasing size (at a constant density around the player)
+    // Checks that no agent ever loses time (i.e. the sum of its think delta times matches the elapsed time) and records the total think cost
+
+    #if KRG_DEVELOPMENT_TOOLS
+    struct ThinkLODCrowdTestResult
+    {
+        uint32_t                                m_numAgents = 0;
+        uint32_t                                m_numThinks = 0;
+        uint32_t                                m_numFullRateThinks = 0;
+        Milliseconds                            m_time = 0.0f;
+        Milliseconds                            m_fullRateTime = 0.0f;
+        bool                                    m_isTimeAccumulationValid = true;
+    };
+
+    KRG_GAME_API TVector<ThinkLODCrowdTestResult> RunThinkLODCrowdTest( ThinkLODSettings const& settings, uint32_t numFrames, uint32_t seed );
+    #endif
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "System/Algorithm/Hash.h"
+#include "System/Math/MathRandom.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 
 #if KRG_DEVELOPMENT_TOOLS
@@ -53,7 +54,8 @@ namespace KRG::AI
         // Forwarding helper functions
         //-------------------------------------------------------------------------
 
-        KRG_FORCE_INLINE Seconds GetDeltaTime() const { return m_pEntityWorldUpdateContext->GetDeltaTime(); }
+        // The time since this AI last thought, this is not the frame delta time since distant AI dont think every frame (see AIThinkLOD.h)
+        KRG_FORCE_INLINE Seconds GetDeltaTime() const { return m_thinkDeltaTime; }
         template<typename T> inline T* GetWorldSystem() const { return m_pEntityWorldUpdateContext->GetWorldSystem<T>(); }
         template<typename T> inline T* GetSystem() const { return m_pEntityWorldUpdateContext->GetSystem<T>(); }
         template<typename T> inline T* GetAnimSubGraphController() const { return m_pAnimationController->GetSubGraphController<T>(); }
@@ -65,6 +67,7 @@ namespace KRG::AI
     public:
 
         EntityWorldUpdateContext const*             m_pEntityWorldUpdateContext = nullptr;
+        Seconds                                     m_thinkDeltaTime = 0.0f;
         Physics::Scene*                             m_pPhysicsScene = nullptr;
         Navmesh::NavmeshWorldSystem*                m_pNavmeshSystem = nullptr;
 
@@ -73,6 +76,9 @@ namespace KRG::AI
         CharacterPhysicsController*                 m_pCharacterController = nullptr;
         AnimationController*                        m_pAnimationController = nullptr;
         TInlineVector<EntityComponent*, 10>         m_components;
+
+        // Per-entity random stream (seeded from the world seed), use this instead of the global random functions since AI updates run in parallel
+        Math::RNG                                   m_rng;
     };
 
     //-------------------------------------------------------------------------
@@ -9,7 +9,7 @@ namespace KRG::AI
 {
     void WanderBehavior::StartInternal( BehaviorContext const& ctx )
     {
-        m_waitTimer.Start( Math::GetRandomFloat( 1.0f, 3.0f ) );
+        m_waitTimer.Start( ctx.m_rng.GetFloat( 1.0f, 3.0f ) );
     }
 
     Behavior::Status WanderBehavior::UpdateInternal( BehaviorContext const& ctx )
@@ -32,7 +32,7 @@ namespace KRG::AI
             {
                 Vector const boundsMin = navmeshBounds.GetMin();
                 Vector const boundsMax = navmeshBounds.GetMax();
-                Vector const moveGoalPosition( Math::GetRandomFloat( boundsMin.m_x, boundsMax.m_x ), Math::GetRandomFloat( boundsMin.m_y, boundsMax.m_y ), navmeshBounds.GetCenter().m_z );
+                Vector const moveGoalPosition( ctx.m_rng.GetFloat( boundsMin.m_x, boundsMax.m_x ), ctx.m_rng.GetFloat( boundsMin.m_y, boundsMax.m_y ), navmeshBounds.GetCenter().m_z );
 
                 m_moveToAction.Start( ctx, moveGoalPosition );
             }
@@ -49,7 +49,7 @@ namespace KRG::AI
             if ( !m_moveToAction.IsRunning() )
             {
                 m_idleAction.Start( ctx );
-                m_waitTimer.Start( Math::GetRandomFloat( 1.0f, 3.0f ) );
+                m_waitTimer.Start( ctx.m_rng.GetFloat( 1.0f, 3.0f ) );
             }
         }
 
@@ -60,6 +60,6 @@ namespace KRG::AI
 
     void WanderBehavior::StopInternal( BehaviorContext const& ctx, StopReason reason )
     {
-
+        m_moveToAction.Stop( ctx );
     }
 }
\ No newline at end of file
@@ -17,12 +17,12 @@ namespace KRG::AI
         auto pLocomotionController = ctx.m_pAnimationController->GetSubGraphController<LocomotionGraphController>();
         pLocomotionController->SetIdle();
 
-        ResetIdleBreakerTimer();
+        ResetIdleBreakerTimer( ctx );
     }
 
-    void IdleAction::ResetIdleBreakerTimer()
+    void IdleAction::ResetIdleBreakerTimer( BehaviorContext const& ctx )
     {
-        m_idleBreakerCooldown.Start( Math::GetRandomFloat( 15.0f, 25.0f ) );
+        m_idleBreakerCooldown.Start( ctx.m_rng.GetFloat( 15.0f, 25.0f ) );
     }
 
     void IdleAction::Update( BehaviorContext const& ctx )
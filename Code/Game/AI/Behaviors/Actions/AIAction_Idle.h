@@ -19,7 +19,7 @@ namespace KRG::AI
 
     private:
 
-        void ResetIdleBreakerTimer();
+        void ResetIdleBreakerTimer( BehaviorContext const& ctx );
 
     private:
 
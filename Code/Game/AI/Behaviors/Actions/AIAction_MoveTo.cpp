@@ -11,10 +11,15 @@
 
 namespace KRG::AI
 {
+    MoveToAction::~MoveToAction()
+    {
+        ReleasePathRequest();
+    }
+
     bool MoveToAction::IsRunning() const
     {
         #if KRG_ENABLE_NAVPOWER
-        return m_path.IsValid();
+        return m_path.IsValid() || m_pathRequestID != Navmesh::InvalidPathRequestID;
         #else
         return false;
         #endif
@@ -26,31 +31,66 @@ namespace KRG::AI
 
         //-------------------------------------------------------------------------
 
+        ReleasePathRequest();
+
         #if KRG_ENABLE_NAVPOWER
-        auto spaceHandle = ctx.m_pNavmeshSystem->GetSpaceHandle();
+        m_path.Release();
+        #endif
 
-        bfx::PathSpec pathSpec;
-        pathSpec.m_snapMode = bfx::SNAP_CLOSEST;
+        m_currentPathSegmentIdx = InvalidIndex;
+        m_pNavmeshSystem = ctx.m_pNavmeshSystem;
+        m_pathRequestID = m_pNavmeshSystem->RequestPath( ctx.m_pCharacter->GetPosition(), goalPosition );
+    }
 
-        bfx::PathCreationOptions pathOptions;
-        pathOptions.m_forceFirstPosOntoNavGraph = true;
+    void MoveToAction::Stop( BehaviorContext const& ctx )
+    {
+        ReleasePathRequest();
 
-        m_path = bfx::CreatePolylinePath( spaceHandle, Navmesh::ToBfx( ctx.m_pCharacter->GetPosition() ), Navmesh::ToBfx( goalPosition ), 0, pathSpec, pathOptions );
-        if ( m_path.IsValid() )
-        {
-            m_currentPathSegmentIdx = 0;
-            m_progressAlongSegment = 0.0f;
-        }
-        else
+        #if KRG_ENABLE_NAVPOWER
+        m_path.Release();
+        #endif
+
+        m_currentPathSegmentIdx = InvalidIndex;
+    }
+
+    void MoveToAction::ReleasePathRequest()
+    {
+        if ( m_pathRequestID != Navmesh::InvalidPathRequestID )
         {
-            m_currentPathSegmentIdx = InvalidIndex;
+            KRG_ASSERT( m_pNavmeshSystem != nullptr );
+            m_pNavmeshSystem->ReleasePathRequest( m_pathRequestID );
+            m_pathRequestID = Navmesh::InvalidPathRequestID;
         }
-        #endif
+
+        m_pNavmeshSystem = nullptr;
     }
 
     void MoveToAction::Update( BehaviorContext const& ctx )
     {
         #if KRG_ENABLE_NAVPOWER
+
+        // Wait for the path request to complete
+        //-------------------------------------------------------------------------
+
+        if ( m_pathRequestID != Navmesh::InvalidPathRequestID )
+        {
+            Navmesh::PathRequestStatus const requestStatus = ctx.m_pNavmeshSystem->GetPathRequestStatus( m_pathRequestID );
+            if ( requestStatus == Navmesh::PathRequestStatus::Pending )
+            {
+                return;
+            }
+
+            if ( ctx.m_pNavmeshSystem->TryGetPath( m_pathRequestID, m_path ) )
+            {
+                m_currentPathSegmentIdx = 0;
+                m_progressAlongSegment = 0.0f;
+            }
+
+            ReleasePathRequest();
+        }
+
+        //-------------------------------------------------------------------------
+
         if ( !m_path.IsValid() )
         {
             return;
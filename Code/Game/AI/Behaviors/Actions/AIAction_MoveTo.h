@@ -1,5 +1,5 @@
 #pragma once
-#include "Engine/Navmesh/NavPower.h"
+#include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
 #include "System/Math/Vector.h"
 #include "System/Types/Percentage.h"
 
@@ -16,17 +16,29 @@ namespace KRG::AI
     {
     public:
 
+        ~MoveToAction();
+
         bool IsRunning() const;
         void Start( BehaviorContext const& ctx, Vector const& goalPosition );
         void Update( BehaviorContext const& ctx );
+        void Stop( BehaviorContext const& ctx );
 
     private:
 
+        void ReleasePathRequest();
+
+    private:
+
+        // The path is requested asynchronously so we might be waiting for a few frames before we can start moving
+        // The request is released through the system it was made on, since the action can be destroyed outside of a behavior update
+        Navmesh::NavmeshWorldSystem*        m_pNavmeshSystem = nullptr;
+        Navmesh::PathRequestID              m_pathRequestID = Navmesh::InvalidPathRequestID;
+
         #if KRG_ENABLE_NAVPOWER
-        bfx::PolylinePathRCPtr      m_path;
+        bfx::PolylinePathRCPtr              m_path;
         #endif
 
-        int32_t                       m_currentPathSegmentIdx = InvalidIndex;
-        Percentage                  m_progressAlongSegment = 0.0f;
+        int32_t                             m_currentPathSegmentIdx = InvalidIndex;
+        Percentage                          m_progressAlongSegment = 0.0f;
     };
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Game/_Module/API.h"
+#include "Game/AI/AIThinkLOD.h"
 #include "Engine/Entity/EntitySpatialComponent.h"
 
 //-------------------------------------------------------------------------
@@ -14,9 +15,30 @@ namespace KRG::AI
     {
         KRG_REGISTER_SINGLETON_ENTITY_COMPONENT( AIComponent );
 
+        friend class AIManager;
+
     public:
 
         inline AIComponent() = default;
         inline AIComponent( StringID name ) : EntityComponent( name ) {}
+
+        // The think LOD state for this frame (set by the AI manager at the start of each frame)
+        inline ThinkLODState const& GetThinkLODState() const { return m_thinkLODState; }
+
+        // Unique per spawn (assigned by the AI manager in registration order), a pooled AI gets a new index each time it is respawned
+        inline uint32_t GetSpawnIndex() const { return m_spawnIndex; }
+
+        #if KRG_DEVELOPMENT_TOOLS
+        // Is the think LOD state in its initial state i.e. nothing from a previous registration has been carried over (used to validate pooled AI)
+        inline bool IsInInitialState() const
+        {
+            return m_thinkLODState.m_accumulatedTime == 0.0f && m_thinkLODState.m_thinkDeltaTime == 0.0f && m_thinkLODState.m_timeSinceLastSeen == FLT_MAX && m_thinkLODState.m_tier == ThinkTier::Full && !m_thinkLODState.m_shouldThink;
+        }
+        #endif
+
+    private:
+
+        ThinkLODState                   m_thinkLODState;
+        uint32_t                        m_spawnIndex = 0;
     };
 }
\ No newline at end of file
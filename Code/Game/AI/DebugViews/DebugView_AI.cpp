@@ -1,7 +1,11 @@
 #include "DebugView_AI.h"
 #include "Game/AI/Systems/WorldSystem_AIManager.h"
+#include "Game/AI/AICharacterMovement.h"
+#include "Game/AI/AIThinkLOD.h"
+#include "Engine/Physics/PhysicsSystem.h"
 #include "Engine/Entity/EntityWorld.h"
 #include "Engine/Entity/EntitySystem.h"
+#include "Engine/Entity/EntityPool.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/UpdateContext.h"
 #include "System/Imgui/ImguiX.h"
@@ -54,6 +58,74 @@ namespace KRG::AI
         {
             m_pAIManager->TrySpawnAI( context );
         }
+
+        if ( ImGui::Button( "Run Movement Test" ) )
+        {
+            RunMovementTest( context );
+        }
+
+        if ( ImGui::Button( "Run Think LOD Crowd Test" ) )
+        {
+            RunThinkLODCrowdTest();
+        }
+
+        if ( ImGui::Button( "Run Spawn Latency Test" ) )
+        {
+            static constexpr uint32_t const s_numSpawnsPerPath = 20;
+            m_pAIManager->StartSpawnLatencyTest( s_numSpawnsPerPath );
+        }
+    }
+
+    void AIDebugView::RunMovementTest( EntityWorldUpdateContext const& context )
+    {
+        static constexpr uint32_t const s_numAgents = 1024;
+        static constexpr uint32_t const s_numFrames = 120;
+        static constexpr uint32_t const s_seed = 12345;
+
+        auto pPhysicsSystem = context.GetSystem<Physics::PhysicsSystem>();
+        auto pTaskSystem = context.GetSystem<TaskSystem>();
+        CharacterMovementTestResult const result = RunCharacterMovementTest( *pPhysicsSystem, pTaskSystem, s_numAgents, s_numFrames, s_seed );
+
+        if ( result.WasSuccessful() )
+        {
+            KRG_LOG_MESSAGE( "AI", "Movement test passed (%u agents, %u frames): per-agent %.2fms, batched %.2fms", result.m_numAgents, result.m_numFrames, result.m_perAgentTime.ToFloat(), result.m_batchedTime.ToFloat() );
+        }
+        else
+        {
+            KRG_LOG_ERROR( "AI", "Movement test failed (%u agents, %u frames): %u mismatched transforms", result.m_numAgents, result.m_numFrames, result.m_numMismatches );
+        }
+    }
+
+    void AIDebugView::RunThinkLODCrowdTest()
+    {
+        static constexpr uint32_t const s_numFrames = 300;
+        static constexpr uint32_t const s_seed = 12345;
+
+        TVector<ThinkLODCrowdTestResult> const results = AI::RunThinkLODCrowdTest( ThinkLODSettings(), s_numFrames, s_seed );
+        KRG_ASSERT( !results.empty() );
+
+        bool isValid = true;
+        for ( auto const& result : results )
+        {
+            KRG_LOG_MESSAGE( "AI", "Think LOD crowd test - %u agents: %u thinks, %.2fms (full rate: %u thinks, %.2fms)", result.m_numAgents, result.m_numThinks, result.m_time.ToFloat(), result.m_numFullRateThinks, result.m_fullRateTime.ToFloat() );
+            isValid &= result.m_isTimeAccumulationValid;
+        }
+
+        // The think cost needs to grow slower than the number of agents
+        float const agentRatio = float( results.back().m_numAgents ) / results.front().m_numAgents;
+        float const thinkRatio = float( results.back().m_numThinks ) / results.front().m_numThinks;
+        if ( !isValid )
+        {
+            KRG_LOG_ERROR( "AI", "Think LOD crowd test failed: agents lost time when thinking at a reduced rate" );
+        }
+        else if ( thinkRatio >= agentRatio )
+        {
+            KRG_LOG_ERROR( "AI", "Think LOD crowd test failed: think count grew by %.2fx for %.2fx agents", thinkRatio, agentRatio );
+        }
+        else
+        {
+            KRG_LOG_MESSAGE( "AI", "Think LOD crowd test passed: think count grew by %.2fx for %.2fx agents", thinkRatio, agentRatio );
+        }
     }
 
     void AIDebugView::DrawOverviewWindow( EntityWorldUpdateContext const& context )
@@ -61,6 +133,19 @@ namespace KRG::AI
         if ( ImGui::Begin( "AI Overview", &m_isOverviewWindowOpen ) )
         {
             ImGui::Text( "Num AI: %u", m_pAIManager->m_AIs.size() );
+
+            ImGui::Separator();
+
+            auto const& scheduler = m_pAIManager->m_thinkLODScheduler;
+            ImGui::Text( "Thinking This Frame: %u", scheduler.GetNumThinkingAgents() );
+            ImGui::Text( "Full: %u, High: %u, Medium: %u, Low: %u", scheduler.GetNumAgentsInTier( ThinkTier::Full ), scheduler.GetNumAgentsInTier( ThinkTier::High ), scheduler.GetNumAgentsInTier( ThinkTier::Medium ), scheduler.GetNumAgentsInTier( ThinkTier::Low ) );
+
+            ImGui::Separator();
+
+            for ( auto const& poolPair : m_pAIManager->m_spawnPools )
+            {
+                ImGui::Text( "Pool %s: %d/%d available", poolPair.first.c_str(), poolPair.second->GetNumAvailableInstances(), poolPair.second->GetNumInstances() );
+            }
         }
         ImGui::End();
     }
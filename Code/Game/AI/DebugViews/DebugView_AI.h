@@ -28,6 +28,12 @@ namespace KRG::AI
         void DrawMenu( EntityWorldUpdateContext const& context );
         void DrawOverviewWindow( EntityWorldUpdateContext const& context );
 
+        // Run the headless character movement test, the results are written to the log
+        void RunMovementTest( EntityWorldUpdateContext const& context );
+
+        // Run the headless think LOD crowd test, the results are written to the log
+        void RunThinkLODCrowdTest();
+
     private:
 
         EntityWorld const*              m_pWorld = nullptr;
@@ -1,6 +1,7 @@
 #include "EntitySystem_AIController.h"
 #include "Game/AI/AIPhysicsController.h"
 #include "Game/AI/AIAnimationController.h"
+#include "Game/AI/Systems/WorldSystem_AICharacterMovement.h"
 #include "Game/AI/Components/Component_AI.h"
 #include "Engine/Navmesh/NavPower.h"
 #include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
@@ -26,6 +27,14 @@ namespace KRG::AI
         }
     }
 
+    void AIController::Deactivate()
+    {
+        // Pooled AI are deactivated and later reactivated at a new spawn point, so they need to start from scratch
+        // Stopping the active behavior also releases any path request it is waiting on
+        m_behaviorSelector.Reset();
+        m_isRandomStreamSeeded = false;
+    }
+
     void AIController::Shutdown()
     {
         KRG_ASSERT( m_behaviorContext.m_pAnimationController == nullptr );
@@ -123,22 +132,48 @@ namespace KRG::AI
             return;
         }
 
+        // Seed the random stream for this AI on its first update
+        // The entity ID is a runtime address so we use the spawn position and spawn index as the stream ID since both are stable across runs
+        // The spawn index ensures that AI spawned at the same position (or respawned from a pool) dont share a stream
+        if ( !m_isRandomStreamSeeded )
+        {
+            struct StreamKey
+            {
+                Float3      m_spawnPosition;
+                uint32_t    m_spawnIndex;
+            };
+
+            StreamKey const streamKey = { m_behaviorContext.m_pCharacter->GetPosition().ToFloat3(), m_behaviorContext.m_pAIComponent->GetSpawnIndex() };
+            static_assert( sizeof( StreamKey ) == sizeof( Float3 ) + sizeof( uint32_t ), "Stream key must not contain padding" );
+            uint64_t const streamID = Hash::XXHash::GetHash64( &streamKey, sizeof( StreamKey ) );
+            m_behaviorContext.m_rng.Reseed( ctx.GetRandomSeed(), streamID );
+            m_isRandomStreamSeeded = true;
+        }
+
         //-------------------------------------------------------------------------
 
         UpdateStage const updateStage = ctx.GetUpdateStage();
         if ( updateStage == UpdateStage::PrePhysics )
         {
-            m_behaviorSelector.Update();
+            // Only run the behaviors if the think LOD selected us for this frame
+            ThinkLODState const& thinkLODState = m_behaviorContext.m_pAIComponent->GetThinkLODState();
+            if ( thinkLODState.ShouldThink() )
+            {
+                TScopedGuardValue const thinkDeltaTimeGuard( m_behaviorContext.m_thinkDeltaTime, thinkLODState.GetThinkDeltaTime() );
+                m_behaviorSelector.Update();
+            }
 
             // Update animation and get root motion delta (remember that root motion is in character space, so we need to convert the displacement to world space)
             m_pAnimGraphComponent->EvaluateGraph( ctx.GetDeltaTime(), m_pCharacterMeshComponent->GetWorldTransform(), m_behaviorContext.m_pPhysicsScene );
             Vector const& deltaTranslation = m_pCharacterMeshComponent->GetWorldTransform().RotateVector( m_pAnimGraphComponent->GetRootMotionDelta().GetTranslation() );
             Quaternion const& deltaRotation = m_pAnimGraphComponent->GetRootMotionDelta().GetRotation();
 
-            // Move character
-            m_behaviorContext.m_pCharacterController->TryMoveCapsule( ctx, m_behaviorContext.m_pPhysicsScene, deltaTranslation, deltaRotation );
-
-            // Run animation pose tasks
+            // Request the character move, all AI moves are resolved together once all entities have been updated
+            m_behaviorContext.m_pCharacterController->RequestMove( ctx.GetWorldSystem<CharacterMovementSystem>(), deltaTranslation, deltaRotation );
+        }
+        else if ( updateStage == UpdateStage::Physics )
+        {
+            // Run animation pose tasks (the character has been moved by the time the physics stage runs)
             m_pAnimGraphComponent->ExecutePrePhysicsTasks( m_pCharacterMeshComponent->GetWorldTransform() );
         }
         else if ( updateStage == UpdateStage::PostPhysics )
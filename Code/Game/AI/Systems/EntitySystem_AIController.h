@@ -24,11 +24,19 @@ namespace KRG::AI
     {
         friend class AIDebugView;
 
-        KRG_REGISTER_ENTITY_SYSTEM( AIController, RequiresUpdate( UpdateStage::PrePhysics ), RequiresUpdate( UpdateStage::PostPhysics ) );
+        KRG_REGISTER_ENTITY_SYSTEM( AIController, RequiresUpdate( UpdateStage::PrePhysics ), RequiresUpdate( UpdateStage::Physics ), RequiresUpdate( UpdateStage::PostPhysics ) );
+
+    public:
+
+        #if KRG_DEVELOPMENT_TOOLS
+        // Is this controller in its initial state i.e. nothing from a previous activation has been carried over (used to validate pooled AI)
+        inline bool IsInInitialState() const { return !m_isRandomStreamSeeded && m_behaviorSelector.IsReset(); }
+        #endif
 
     private:
 
         virtual void Activate() override;
+        virtual void Deactivate() override;
         virtual void Shutdown() override;
 
         virtual void RegisterComponent( EntityComponent* pComponent ) override;
@@ -42,5 +50,6 @@ namespace KRG::AI
 
         Animation::AnimationGraphComponent*                     m_pAnimGraphComponent = nullptr;
         Render::CharacterMeshComponent*                         m_pCharacterMeshComponent = nullptr;
+        bool                                                    m_isRandomStreamSeeded = false;
     };
 }
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include "WorldSystem_AICharacterMovement.h"
+#include "Game/AI/Components/Component_AI.h"
+#include "Engine/Physics/Systems/WorldSystem_Physics.h"
+#include "Engine/Physics/Components/Component_PhysicsCharacter.h"
+#include "Engine/Physics/PhysicsScene.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG::AI
+{
+    void CharacterMovementSystem::ShutdownSystem()
+    {
+        KRG_ASSERT( m_numAIs == 0 && m_numRequests == 0 );
+    }
+
+    void CharacterMovementSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        // AI components are singletons so we can never have more requests per frame than AIs
+        if ( TryCast<AIComponent>( pComponent ) != nullptr )
+        {
+            m_numAIs++;
+            m_requests.resize( m_numAIs );
+            m_requestComponents.resize( m_numAIs );
+        }
+    }
+
+    void CharacterMovementSystem::UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        if ( TryCast<AIComponent>( pComponent ) != nullptr )
+        {
+            KRG_ASSERT( m_numAIs > 0 );
+            m_numAIs--;
+            m_requests.resize( m_numAIs );
+            m_requestComponents.resize( m_numAIs );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CharacterMovementSystem::RequestMove( Physics::CharacterComponent* pCharacterComponent, Vector const& deltaTranslation, Quaternion const& deltaRotation )
+    {
+        KRG_ASSERT( pCharacterComponent != nullptr );
+
+        uint32_t const requestIdx = m_numRequests.fetch_add( 1 );
+        KRG_ASSERT( requestIdx < m_requests.size() );
+
+        CharacterMoveRequest& request = m_requests[requestIdx];
+        request.m_capsuleWorldTransform = pCharacterComponent->GetCapsuleWorldTransform();
+        request.m_deltaTranslation = deltaTranslation;
+        request.m_deltaRotation = deltaRotation;
+        request.m_capsuleRadius = pCharacterComponent->GetCapsuleRadius();
+        request.m_capsuleCylinderPortionHalfHeight = pCharacterComponent->GetCapsuleCylinderPortionHalfHeight();
+        request.m_entityID = pCharacterComponent->GetEntityID();
+        m_requestComponents[requestIdx] = pCharacterComponent;
+    }
+
+    void CharacterMovementSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
+        KRG_PROFILE_FUNCTION_AI();
+
+        // The request order depends on the entity update scheduling, but each move only depends on its own request and the static environment
+        uint32_t const numRequests = m_numRequests.exchange( 0 );
+        if ( numRequests == 0 )
+        {
+            return;
+        }
+
+        // Resolve all moves
+        //-------------------------------------------------------------------------
+
+        Physics::Scene* pPhysicsScene = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>()->GetScene();
+        m_batch.Resolve( ctx.GetSystem<TaskSystem>(), pPhysicsScene, ctx.GetDeltaTime(), m_requests.data(), numRequests );
+
+        // Apply rotation deltas and move characters
+        //-------------------------------------------------------------------------
+
+        pPhysicsScene->AcquireWriteLock();
+        for ( uint32_t i = 0; i < numRequests; i++ )
+        {
+            Physics::CharacterComponent* pCharacterComponent = m_requestComponents[i];
+            Transform newCharacterTransform = pCharacterComponent->CalculateWorldTransformFromCapsuleTransform( m_batch.GetFinalCapsuleWorldTransform( i ) );
+            newCharacterTransform.AddRotation( m_requests[i].m_deltaRotation );
+            pCharacterComponent->MoveCharacter( ctx.GetDeltaTime(), newCharacterTransform );
+        }
+        pPhysicsScene->ReleaseWriteLock();
+    }
+}
\ No newline at end of file
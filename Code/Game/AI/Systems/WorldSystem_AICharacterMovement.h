@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Game/_Module/API.h"
+#include "Game/AI/AICharacterMovement.h"
+#include "Engine/Entity/EntityWorldSystem.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace KRG::Physics
+{
+    class CharacterComponent;
+}
+
+//-------------------------------------------------------------------------
+// AI Character Movement
+//-------------------------------------------------------------------------
+// Collects the character moves requested by all AI during the pre-physics entity update and resolves them together
+// The AI entity update runs in parallel, so requests are written into a pre-sized array (one slot per registered AI)
+// Once all entities have updated, all floor sweeps are run as a single batch and the final transforms written back under a single write lock
+
+namespace KRG::AI
+{
+    class KRG_GAME_API CharacterMovementSystem : public IWorldEntitySystem
+    {
+        friend class AIDebugView;
+
+    public:
+
+        KRG_REGISTER_TYPE( CharacterMovementSystem );
+        KRG_ENTITY_WORLD_SYSTEM( CharacterMovementSystem, RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::Low ) );
+
+    public:
+
+        // Request a move for this frame, the move will be applied once all entities have been updated - threadsafe
+        void RequestMove( Physics::CharacterComponent* pCharacterComponent, Vector const& deltaTranslation, Quaternion const& deltaRotation );
+
+    private:
+
+        virtual void ShutdownSystem() override final;
+        virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+
+    private:
+
+        TVector<CharacterMoveRequest>           m_requests;
+        TVector<Physics::CharacterComponent*>   m_requestComponents;
+        std::atomic<uint32_t>                   m_numRequests = 0;
+        CharacterMovementBatch                  m_batch;
+        uint32_t                                m_numAIs = 0;
+    };
+}
\ No newline at end of file
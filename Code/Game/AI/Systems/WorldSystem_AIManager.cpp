@@ -1,19 +1,47 @@
 #include "WorldSystem_AIManager.h"
 #include "Game/AI/Components/Component_AI.h"
+#include "Game/AI/Systems/EntitySystem_AIController.h"
 #include "Engine/AI/Components/Component_AISpawn.h"
+#include "Engine/Player/Systems/WorldSystem_PlayerManager.h"
+#include "Engine/Camera/Components/Component_Camera.h"
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityMap.h"
+#include "Engine/Entity/EntityPool.h"
+#include "Engine/Render/RenderViewport.h"
+#include "Engine/RuntimeSettings/RuntimeSettings.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+#include "System/Log.h"
 
 //-------------------------------------------------------------------------
 
 namespace KRG::AI
 {
+    static RuntimeSettingBool g_enableThinkLOD( "EnableThinkLOD", "AI/Think LOD", "Update distant/unseen AI behaviors at a reduced rate", true );
+    static RuntimeSettingFloat g_thinkLODHighDistance( "HighTierDistance", "AI/Think LOD", "AI further than this from the player (m) no longer think every frame", 15.0f, 0.0f, 500.0f );
+    static RuntimeSettingFloat g_thinkLODMediumDistance( "MediumTierDistance", "AI/Think LOD", "AI further than this from the player (m) are in the medium tier", 30.0f, 0.0f, 500.0f );
+    static RuntimeSettingFloat g_thinkLODLowDistance( "LowTierDistance", "AI/Think LOD", "AI further than this from the player (m) are in the low (budgeted) tier", 60.0f, 0.0f, 500.0f );
+    static RuntimeSettingInt g_thinkLODHighInterval( "HighTierInterval", "AI/Think LOD", "The number of frames between thinks for the high tier", 2, 1, 60 );
+    static RuntimeSettingInt g_thinkLODMediumInterval( "MediumTierInterval", "AI/Think LOD", "The number of frames between thinks for the medium tier", 4, 1, 60 );
+    static RuntimeSettingInt g_thinkLODLowInterval( "LowTierInterval", "AI/Think LOD", "The min number of frames between thinks for the low tier", 8, 1, 60 );
+    static RuntimeSettingInt g_thinkLODLowBudget( "LowTierBudget", "AI/Think LOD", "The max number of low tier AI that think per frame", 32, 1, 1024 );
+    static RuntimeSettingFloat g_thinkLODVisibilityTimeout( "VisibilityTimeout", "AI/Think LOD", "AI that havent been seen for this long (s) drop one tier", 2.0f, 0.0f, 60.0f );
+    static RuntimeSettingInt g_spawnPoolSize( "PoolSize", "AI/Spawning", "The number of pre-instantiated AI kept loaded per spawn collection, 0 disables pooling", 4, 0, 256 );
+
+    //-------------------------------------------------------------------------
+
     void AIManager::ShutdownSystem()
     {
         KRG_ASSERT( m_spawnPoints.empty() );
+
+        // The pools are owned (and have already been destroyed) by the persistent map
+        m_spawnPools.clear();
+
+        #if KRG_DEVELOPMENT_TOOLS
+        m_spawnLatencyTest = SpawnLatencyTest();
+        #endif
     }
 
     void AIManager::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -25,7 +53,10 @@ namespace KRG::AI
 
         if ( auto pAIComponent = TryCast<AIComponent>( pComponent ) )
         {
+            pAIComponent->m_spawnIndex = m_nextSpawnIndex++;
             m_AIs.emplace_back( pAIComponent );
+            m_AIEntities.emplace_back( pEntity );
+            m_thinkLODStates.emplace_back( &pAIComponent->m_thinkLODState );
         }
     }
 
@@ -38,7 +69,15 @@ namespace KRG::AI
 
         if ( auto pAIComponent = TryCast<AIComponent>( pComponent ) )
         {
-            m_AIs.erase_first( pAIComponent );
+            // Keep the order stable since the think LOD uses it to spread the updates across frames
+            int32_t const AIIdx = VectorFindIndex( m_AIs, pAIComponent );
+            KRG_ASSERT( AIIdx != InvalidIndex );
+            m_AIs.erase( m_AIs.begin() + AIIdx );
+            m_AIEntities.erase( m_AIEntities.begin() + AIIdx );
+            m_thinkLODStates.erase( m_thinkLODStates.begin() + AIIdx );
+
+            // Pooled AI are unregistered on despawn and registered again on the next spawn, so the accumulated time and tier must not carry over
+            pAIComponent->m_thinkLODState = ThinkLODState();
         }
     }
 
@@ -46,9 +85,115 @@ namespace KRG::AI
 
     void AIManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
-        if ( ctx.IsGameWorld() && !m_hasSpawnedAI )
+        if ( ctx.GetUpdateStage() == UpdateStage::FrameStart )
         {
-            m_hasSpawnedAI = TrySpawnAI( ctx );
+            UpdateThinkLOD( ctx );
+        }
+        else if ( ctx.IsGameWorld() )
+        {
+            UpdateSpawnPools( ctx );
+
+            if ( !m_hasSpawnedAI )
+            {
+                m_hasSpawnedAI = TrySpawnAI( ctx );
+            }
+
+            #if KRG_DEVELOPMENT_TOOLS
+            if ( m_spawnLatencyTest.IsRunning() )
+            {
+                UpdateSpawnLatencyTest( ctx );
+            }
+            #endif
+        }
+    }
+
+    void AIManager::UpdateThinkLOD( EntityWorldUpdateContext const& ctx )
+    {
+        KRG_PROFILE_FUNCTION_AI();
+
+        // Get the position we use for the LOD distances: the player if we have one, otherwise the active camera
+        //-------------------------------------------------------------------------
+
+        Vector referencePosition;
+        bool hasReferencePosition = false;
+
+        if ( g_enableThinkLOD )
+        {
+            auto pPlayerManager = ctx.GetWorldSystem<PlayerManager>();
+            if ( pPlayerManager->HasPlayer() )
+            {
+                Entity const* pPlayerEntity = ctx.GetPersistentMap()->FindEntity( pPlayerManager->GetPlayerEntityID() );
+                if ( pPlayerEntity != nullptr && pPlayerEntity->IsSpatialEntity() )
+                {
+                    referencePosition = pPlayerEntity->GetWorldTransform().GetTranslation();
+                    hasReferencePosition = true;
+                }
+            }
+            else if ( pPlayerManager->HasActiveCamera() )
+            {
+                referencePosition = pPlayerManager->GetActiveCamera()->GetPosition();
+                hasReferencePosition = true;
+            }
+        }
+
+        // Update positions and visibility
+        //-------------------------------------------------------------------------
+        // Without a viewport (e.g. headless), we only use the distance
+
+        Render::Viewport const* pViewport = ctx.GetViewport();
+        int32_t const numAIs = (int32_t) m_AIs.size();
+        for ( int32_t i = 0; i < numAIs; i++ )
+        {
+            Entity const* pEntity = m_AIEntities[i];
+            ThinkLODState* pThinkLODState = m_thinkLODStates[i];
+            if ( pEntity->IsSpatialEntity() )
+            {
+                pThinkLODState->m_position = pEntity->GetWorldTransform().GetTranslation();
+                pThinkLODState->m_isVisible = ( pViewport == nullptr ) || pViewport->GetViewVolume().Contains( pEntity->GetRootSpatialComponentWorldBounds().GetAABB() );
+            }
+            else
+            {
+                pThinkLODState->m_isVisible = true;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        ThinkLODSettings settings;
+        settings.m_tierDistances[0] = g_thinkLODHighDistance;
+        settings.m_tierDistances[1] = Math::Max( (float) g_thinkLODMediumDistance, settings.m_tierDistances[0] );
+        settings.m_tierDistances[2] = Math::Max( (float) g_thinkLODLowDistance, settings.m_tierDistances[1] );
+        settings.m_tierUpdateIntervals[0] = 1;
+        settings.m_tierUpdateIntervals[1] = (uint32_t) g_thinkLODHighInterval;
+        settings.m_tierUpdateIntervals[2] = (uint32_t) g_thinkLODMediumInterval;
+        settings.m_tierUpdateIntervals[3] = (uint32_t) g_thinkLODLowInterval;
+        settings.m_maxLowTierThinksPerFrame = (uint32_t) g_thinkLODLowBudget;
+        settings.m_visibilityTimeout = g_thinkLODVisibilityTimeout;
+
+        m_thinkLODScheduler.Update( settings, ctx.GetDeltaTime(), hasReferencePosition ? &referencePosition : nullptr, m_thinkLODStates.data(), (uint32_t) m_thinkLODStates.size() );
+    }
+
+    void AIManager::UpdateSpawnPools( EntityWorldUpdateContext const& ctx )
+    {
+        int32_t const poolSize = g_spawnPoolSize;
+        if ( poolSize <= 0 )
+        {
+            return;
+        }
+
+        // Pre-warm a pool for each spawn collection, the pools are shared by all spawn points using the same collection
+        for ( auto pSpawnPoint : m_spawnPoints )
+        {
+            ResourceID const& collectionDescID = pSpawnPoint->GetEntityCollectionDescID();
+            if ( m_spawnPools.find( collectionDescID ) != m_spawnPools.end() )
+            {
+                continue;
+            }
+
+            auto pTypeRegistry = ctx.GetSystem<TypeSystem::TypeRegistry>();
+            auto pTaskSystem = ctx.GetSystem<TaskSystem>();
+            auto pEntityPool = ctx.GetPersistentMap()->CreateEntityPool( pTaskSystem, *pTypeRegistry, *pSpawnPoint->GetEntityCollectionDesc(), poolSize );
+            m_spawnPools.insert( TPair<ResourceID, EntityModel::EntityPool*>( collectionDescID, pEntityPool ) );
         }
     }
 
@@ -63,13 +208,261 @@ namespace KRG::AI
         auto pTaskSystem = ctx.GetSystem<TaskSystem>();
         auto pPersistentMap = ctx.GetPersistentMap();
 
+        // Wait for the pools to finish warming up
+        //-------------------------------------------------------------------------
+
+        for ( auto pSpawnPoint : m_spawnPoints )
+        {
+            auto poolIter = m_spawnPools.find( pSpawnPoint->GetEntityCollectionDescID() );
+            if ( poolIter != m_spawnPools.end() && poolIter->second->GetNumAvailableInstances() == 0 )
+            {
+                return false;
+            }
+        }
+
+        // Spawn
         //-------------------------------------------------------------------------
+        // If there is no pool or the pool is exhausted, we fall back to instantiating the collection
 
         for ( auto pSpawnPoint : m_spawnPoints )
         {
+            auto poolIter = m_spawnPools.find( pSpawnPoint->GetEntityCollectionDescID() );
+            if ( poolIter != m_spawnPools.end() && poolIter->second->TrySpawn( pSpawnPoint->GetWorldTransform() ) != InvalidIndex )
+            {
+                continue;
+            }
+
             pPersistentMap->AddEntityCollection( pTaskSystem, *pTypeRegistry, *pSpawnPoint->GetEntityCollectionDesc(), pSpawnPoint->GetWorldTransform() );
         }
 
         return true;
     }
+
+    void AIManager::DespawnAI( EntityWorldUpdateContext const& ctx, EntityID const& AIEntityID )
+    {
+        for ( auto const& poolPair : m_spawnPools )
+        {
+            int32_t const instanceIdx = poolPair.second->FindInstanceIndex( AIEntityID );
+            if ( instanceIdx != InvalidIndex )
+            {
+                if ( poolPair.second->IsInstanceSpawned( instanceIdx ) )
+                {
+                    poolPair.second->Despawn( instanceIdx );
+                }
+                return;
+            }
+        }
+
+        ctx.GetPersistentMap()->DestroyEntity( AIEntityID );
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if KRG_DEVELOPMENT_TOOLS
+    void AIManager::StartSpawnLatencyTest( uint32_t numSpawnsPerPath )
+    {
+        KRG_ASSERT( numSpawnsPerPath > 0 );
+
+        if ( m_spawnLatencyTest.IsRunning() )
+        {
+            return;
+        }
+
+        if ( m_spawnPoints.empty() )
+        {
+            KRG_LOG_ERROR( "AI", "Spawn latency test failed: no spawn points" );
+            return;
+        }
+
+        m_spawnLatencyTest = SpawnLatencyTest();
+        m_spawnLatencyTest.m_numSpawnsPerPath = numSpawnsPerPath;
+        m_spawnLatencyTest.m_stage = SpawnLatencyTest::Stage::Spawn;
+    }
+
+    void AIManager::UpdateSpawnLatencyTest( EntityWorldUpdateContext const& ctx )
+    {
+        auto& test = m_spawnLatencyTest;
+        KRG_ASSERT( test.IsRunning() );
+
+        if ( m_spawnPoints.empty() )
+        {
+            KRG_LOG_ERROR( "AI", "Spawn latency test failed: spawn points were removed" );
+            test.m_stage = SpawnLatencyTest::Stage::None;
+            return;
+        }
+
+        auto pPersistentMap = ctx.GetPersistentMap();
+        AISpawnComponent const* pSpawnPoint = m_spawnPoints[0];
+        SpawnLatencyStats& stats = test.m_stats[test.m_isPooledPath ? 1 : 0];
+
+        switch ( test.m_stage )
+        {
+            case SpawnLatencyTest::Stage::Spawn:
+            {
+                auto pTypeRegistry = ctx.GetSystem<TypeSystem::TypeRegistry>();
+                auto pTaskSystem = ctx.GetSystem<TaskSystem>();
+
+                Timer<PlatformClock> requestTimer;
+                Milliseconds requestTime = 0.0f;
+                test.m_spawnedEntityIDs.clear();
+
+                if ( test.m_isPooledPath )
+                {
+                    // We use the spawn point's pool, the warm up is not part of the measurement
+                    auto poolIter = m_spawnPools.find( pSpawnPoint->GetEntityCollectionDescID() );
+                    if ( poolIter == m_spawnPools.end() )
+                    {
+                        KRG_LOG_ERROR( "AI", "Spawn latency test failed: AI pooling is disabled" );
+                        test.m_stage = SpawnLatencyTest::Stage::None;
+                        return;
+                    }
+
+                    test.m_pPool = poolIter->second;
+                    if ( test.m_pPool->GetNumAvailableInstances() == 0 )
+                    {
+                        return;
+                    }
+
+                    requestTimer.Start();
+                    test.m_spawnedInstanceIdx = test.m_pPool->TrySpawn( pSpawnPoint->GetWorldTransform() );
+                    requestTime = requestTimer.GetElapsedTimeMilliseconds();
+                    KRG_ASSERT( test.m_spawnedInstanceIdx != InvalidIndex );
+
+                    // The instance isnt activated until the next map update, so none of its AI can have updated since the last despawn
+                    bool isCleanSpawn = true;
+                    for ( auto pEntity : test.m_pPool->GetInstanceEntities( test.m_spawnedInstanceIdx ) )
+                    {
+                        test.m_spawnedEntityIDs.emplace_back( pEntity->GetID() );
+
+                        auto pController = pEntity->GetSystem<AIController>();
+                        if ( pController != nullptr && !pController->IsInInitialState() )
+                        {
+                            isCleanSpawn = false;
+                        }
+
+                        for ( auto pComponent : pEntity->GetComponents() )
+                        {
+                            auto pAIComponent = TryCast<AIComponent>( pComponent );
+                            if ( pAIComponent != nullptr && !pAIComponent->IsInInitialState() )
+                            {
+                                isCleanSpawn = false;
+                            }
+                        }
+                    }
+
+                    if ( !isCleanSpawn )
+                    {
+                        stats.m_numDirtySpawns++;
+                    }
+                }
+                else // This is the same as adding the collection, but we need the IDs of the created entities
+                {
+                    TVector<Entity*> const createdEntities = pSpawnPoint->GetEntityCollectionDesc()->InstantiateCollection( pTaskSystem, *pTypeRegistry );
+                    pPersistentMap->AddEntities( createdEntities, pSpawnPoint->GetWorldTransform() );
+                    requestTime = requestTimer.GetElapsedTimeMilliseconds();
+
+                    for ( auto pEntity : createdEntities )
+                    {
+                        test.m_spawnedEntityIDs.emplace_back( pEntity->GetID() );
+                    }
+                }
+
+                stats.m_requestTime += requestTime;
+                stats.m_maxRequestTime = Math::Max( stats.m_maxRequestTime.ToFloat(), requestTime.ToFloat() );
+                test.m_numFrames = 0;
+                test.m_timer.Start();
+                test.m_stage = SpawnLatencyTest::Stage::WaitForActivation;
+            }
+            break;
+
+            case SpawnLatencyTest::Stage::WaitForActivation:
+            {
+                test.m_numFrames++;
+
+                for ( auto const& entityID : test.m_spawnedEntityIDs )
+                {
+                    Entity const* pEntity = pPersistentMap->FindEntity( entityID );
+                    if ( pEntity == nullptr || !pEntity->IsActivated() )
+                    {
+                        return;
+                    }
+                }
+
+                stats.m_numSpawns++;
+                stats.m_activationTime += test.m_timer.GetElapsedTimeMilliseconds();
+                stats.m_numActivationFrames += test.m_numFrames;
+                stats.m_maxActivationFrames = Math::Max( stats.m_maxActivationFrames, test.m_numFrames );
+
+                // Despawn, a pooled instance is despawned as a whole
+                if ( test.m_isPooledPath )
+                {
+                    DespawnAI( ctx, test.m_spawnedEntityIDs[0] );
+                }
+                else
+                {
+                    for ( auto const& entityID : test.m_spawnedEntityIDs )
+                    {
+                        DespawnAI( ctx, entityID );
+                    }
+                }
+
+                test.m_stage = SpawnLatencyTest::Stage::WaitForDespawn;
+            }
+            break;
+
+            case SpawnLatencyTest::Stage::WaitForDespawn:
+            {
+                if ( test.m_isPooledPath )
+                {
+                    if ( !test.m_pPool->IsInstanceAvailable( test.m_spawnedInstanceIdx ) )
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    for ( auto const& entityID : test.m_spawnedEntityIDs )
+                    {
+                        if ( pPersistentMap->FindEntity( entityID ) != nullptr )
+                        {
+                            return;
+                        }
+                    }
+                }
+
+                test.m_spawnedEntityIDs.clear();
+                test.m_stage = SpawnLatencyTest::Stage::Spawn;
+
+                // Switch paths or complete the test
+                if ( stats.m_numSpawns == test.m_numSpawnsPerPath )
+                {
+                    if ( !test.m_isPooledPath )
+                    {
+                        test.m_isPooledPath = true;
+                        break;
+                    }
+
+                    SpawnLatencyStats const& pooledStats = test.m_stats[1];
+                    if ( pooledStats.m_numDirtySpawns > 0 )
+                    {
+                        KRG_LOG_ERROR( "AI", "Spawn latency test failed: %u of %u pooled spawns did not start from a clean AI controller or AI component state", pooledStats.m_numDirtySpawns, pooledStats.m_numSpawns );
+                    }
+
+                    for ( int32_t i = 0; i < 2; i++ )
+                    {
+                        SpawnLatencyStats const& pathStats = test.m_stats[i];
+                        KRG_LOG_MESSAGE( "AI", "Spawn latency test - %s: request avg %.3fms (max %.3fms), activation avg %.2f frames (max %u) / %.2fms", ( i == 0 ) ? "Collection" : "Pooled", pathStats.m_requestTime.ToFloat() / pathStats.m_numSpawns, pathStats.m_maxRequestTime.ToFloat(), float( pathStats.m_numActivationFrames ) / pathStats.m_numSpawns, pathStats.m_maxActivationFrames, pathStats.m_activationTime.ToFloat() / pathStats.m_numSpawns );
+                    }
+
+                    test.m_pPool = nullptr;
+                    test.m_stage = SpawnLatencyTest::Stage::None;
+                }
+            }
+            break;
+
+            default:
+            break;
+        }
+    }
+    #endif
 }
\ No newline at end of file
@@ -1,8 +1,20 @@
 #pragma once
 
 #include "Game/_Module/API.h"
+#include "Game/AI/AIThinkLOD.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Entity/EntityIDs.h"
+#include "System/Resource/ResourceID.h"
 #include "System/Types/IDVector.h"
+#include "System/Types/HashMap.h"
+#include "System/Time/Timers.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG::EntityModel
+{
+    class EntityPool;
+}
 
 //-------------------------------------------------------------------------
 
@@ -20,7 +32,7 @@ namespace KRG::AI
     public:
 
         KRG_REGISTER_TYPE( AIManager );
-        KRG_ENTITY_WORLD_SYSTEM( AIManager, RequiresUpdate( UpdateStage::PrePhysics ) );
+        KRG_ENTITY_WORLD_SYSTEM( AIManager, RequiresUpdate( UpdateStage::FrameStart, UpdatePriority::Low ), RequiresUpdate( UpdateStage::PrePhysics ) );
 
     private:
 
@@ -29,12 +41,80 @@ namespace KRG::AI
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
+        // Spawn an AI at every spawn point, AI are taken from a per-collection pool and only instantiated if the pool is empty
+        // Returns false if the pools are still warming up
         bool TrySpawnAI( EntityWorldUpdateContext const& ctx );
 
+        // Return a spawned AI to its pool (or destroy it if it wasnt pooled)
+        void DespawnAI( EntityWorldUpdateContext const& ctx, EntityID const& AIEntityID );
+
+        // Create the pools for any new spawn collections
+        void UpdateSpawnPools( EntityWorldUpdateContext const& ctx );
+
+        // Select which AIs think this frame, this needs to run before the AI entity update
+        void UpdateThinkLOD( EntityWorldUpdateContext const& ctx );
+
+        #if KRG_DEVELOPMENT_TOOLS
+        // Measures the spawn latency of the pooled path vs instantiating the collection (using the first spawn point)
+        // Runs over multiple frames (spawn, wait for activation, despawn, repeat) and the results are written to the log
+        // Every respawned pooled instance is also checked to start from a clean state (no state carried over from its previous spawn)
+        void StartSpawnLatencyTest( uint32_t numSpawnsPerPath );
+        void UpdateSpawnLatencyTest( EntityWorldUpdateContext const& ctx );
+        #endif
+
+    private:
+
+        #if KRG_DEVELOPMENT_TOOLS
+        struct SpawnLatencyStats
+        {
+            uint32_t                        m_numSpawns = 0;
+            uint32_t                        m_numActivationFrames = 0;
+            uint32_t                        m_maxActivationFrames = 0;
+            uint32_t                        m_numDirtySpawns = 0; // Spawns where an AI controller or AI component was not in its initial state
+            Milliseconds                    m_requestTime = 0.0f;
+            Milliseconds                    m_maxRequestTime = 0.0f;
+            Milliseconds                    m_activationTime = 0.0f;
+        };
+
+        struct SpawnLatencyTest
+        {
+            enum class Stage : uint8_t
+            {
+                None,
+                Spawn,
+                WaitForActivation,
+                WaitForDespawn,
+            };
+
+            inline bool IsRunning() const { return m_stage != Stage::None; }
+
+        public:
+
+            EntityModel::EntityPool*        m_pPool = nullptr;
+            TVector<EntityID>               m_spawnedEntityIDs;
+            Timer<PlatformClock>            m_timer;
+            SpawnLatencyStats               m_stats[2]; // Collection, Pooled
+            uint32_t                        m_numSpawnsPerPath = 0;
+            uint32_t                        m_numFrames = 0;
+            int32_t                         m_spawnedInstanceIdx = InvalidIndex;
+            bool                            m_isPooledPath = false;
+            Stage                           m_stage = Stage::None;
+        };
+        #endif
+
     private:
 
         TVector<AISpawnComponent*>          m_spawnPoints;
+        THashMap<ResourceID, EntityModel::EntityPool*>  m_spawnPools;
         TVector<AIComponent*>               m_AIs;
+        TVector<Entity const*>              m_AIEntities;
+        TVector<ThinkLODState*>             m_thinkLODStates;
+        ThinkLODScheduler                   m_thinkLODScheduler;
+        uint32_t                            m_nextSpawnIndex = 0;
         bool                                m_hasSpawnedAI = false;
+
+        #if KRG_DEVELOPMENT_TOOLS
+        SpawnLatencyTest                    m_spawnLatencyTest;
+        #endif
     };
 } 
\ No newline at end of file
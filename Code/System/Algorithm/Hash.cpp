@@ -7,11 +7,6 @@
 
 namespace KRG::Hash
 {
-    namespace XXHash
-    {
-        constexpr static uint32_t const g_hashSeed = 'KRG8';
-    }
-
     uint32_t XXHash::GetHash32( void const* pData, size_t size )
     {
         return XXH32( pData, size, g_hashSeed );
@@ -14,6 +14,8 @@ namespace KRG::Hash
 
     namespace XXHash
     {
+        constexpr static uint32_t const g_hashSeed = 'KRG8';
+
         KRG_SYSTEM_API uint32_t GetHash32( void const* pData, size_t size );
 
         KRG_FORCE_INLINE uint32_t GetHash32( String const& string )
@@ -49,6 +51,90 @@ namespace KRG::Hash
         {
             return GetHash64( data.data(), data.size() );
         }
+
+        //-------------------------------------------------------------------------
+        // Compile time version of the 32bit hash (XXH32), produces identical results to GetHash32 for the same data
+        // This is slower than the runtime version so should only be used for constant expressions
+
+        namespace ConstExpr
+        {
+            constexpr uint32_t const g_prime32_1 = 0x9E3779B1U;
+            constexpr uint32_t const g_prime32_2 = 0x85EBCA77U;
+            constexpr uint32_t const g_prime32_3 = 0xC2B2AE3DU;
+            constexpr uint32_t const g_prime32_4 = 0x27D4EB2FU;
+            constexpr uint32_t const g_prime32_5 = 0x165667B1U;
+
+            constexpr inline uint32_t RotateLeft( uint32_t value, uint32_t shift ) { return ( value << shift ) | ( value >> ( 32 - shift ) ); }
+
+            constexpr inline uint32_t Read32( char const* pData, size_t offset )
+            {
+                return uint32_t( uint8_t( pData[offset] ) ) | ( uint32_t( uint8_t( pData[offset + 1] ) ) << 8 ) | ( uint32_t( uint8_t( pData[offset + 2] ) ) << 16 ) | ( uint32_t( uint8_t( pData[offset + 3] ) ) << 24 );
+            }
+
+            constexpr inline uint32_t Round( uint32_t accumulator, uint32_t input )
+            {
+                accumulator += input * g_prime32_2;
+                accumulator = RotateLeft( accumulator, 13 );
+                return accumulator * g_prime32_1;
+            }
+
+            constexpr inline uint32_t GetHash32( char const* pData, size_t size, uint32_t seed = g_hashSeed )
+            {
+                size_t offset = 0;
+                uint32_t hash = 0;
+
+                if ( size >= 16 )
+                {
+                    uint32_t v1 = seed + g_prime32_1 + g_prime32_2;
+                    uint32_t v2 = seed + g_prime32_2;
+                    uint32_t v3 = seed;
+                    uint32_t v4 = seed - g_prime32_1;
+
+                    for ( ; offset + 16 <= size; offset += 16 )
+                    {
+                        v1 = Round( v1, Read32( pData, offset ) );
+                        v2 = Round( v2, Read32( pData, offset + 4 ) );
+                        v3 = Round( v3, Read32( pData, offset + 8 ) );
+                        v4 = Round( v4, Read32( pData, offset + 12 ) );
+                    }
+
+                    hash = RotateLeft( v1, 1 ) + RotateLeft( v2, 7 ) + RotateLeft( v3, 12 ) + RotateLeft( v4, 18 );
+                }
+                else
+                {
+                    hash = seed + g_prime32_5;
+                }
+
+                hash += uint32_t( size );
+
+                for ( ; offset + 4 <= size; offset += 4 )
+                {
+                    hash += Read32( pData, offset ) * g_prime32_3;
+                    hash = RotateLeft( hash, 17 ) * g_prime32_4;
+                }
+
+                for ( ; offset < size; offset++ )
+                {
+                    hash += uint32_t( uint8_t( pData[offset] ) ) * g_prime32_5;
+                    hash = RotateLeft( hash, 11 ) * g_prime32_1;
+                }
+
+                // Avalanche
+                hash ^= hash >> 15;
+                hash *= g_prime32_2;
+                hash ^= hash >> 13;
+                hash *= g_prime32_3;
+                hash ^= hash >> 16;
+                return hash;
+            }
+
+            // Hash a string literal, the null terminator is not included
+            template<size_t N>
+            constexpr inline uint32_t GetHash32( char const ( &str )[N] )
+            {
+                return GetHash32( str, N - 1 );
+            }
+        }
     }
 
     // FNV1a
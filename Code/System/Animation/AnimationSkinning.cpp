@@ -0,0 +1,118 @@
+#include "AnimationSkinning.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG::Animation
+{
+    // Generate a single skinning matrix: inverseBindPose * ToMatrix( boneTransform )
+    // Since both are affine, we can skip the multiplications by the known zero/one W components
+    KRG_FORCE_INLINE static void CalculateSkinningMatrix( Matrix const& inverseBindPose, Transform const& boneTransform, Matrix& outSkinningTransform )
+    {
+        Matrix boneMatrix( NoInit );
+        boneMatrix.SetRotation( boneTransform.GetRotation() );
+
+        Vector const& scale = boneTransform.GetScale();
+        Vector const boneRow0 = boneMatrix[0] * scale.GetSplatX();
+        Vector const boneRow1 = boneMatrix[1] * scale.GetSplatY();
+        Vector const boneRow2 = boneMatrix[2] * scale.GetSplatZ();
+        Vector const boneRow3 = boneTransform.GetTranslation().GetWithW1();
+
+        for ( int32_t i = 0; i < 3; i++ )
+        {
+            Vector const& row = inverseBindPose.GetRow( i );
+            Vector result = row.GetSplatX() * boneRow0;
+            result = Vector::MultiplyAdd( row.GetSplatY(), boneRow1, result );
+            result = Vector::MultiplyAdd( row.GetSplatZ(), boneRow2, result );
+            outSkinningTransform[i] = result;
+        }
+
+        Vector const& row = inverseBindPose.GetRow( 3 );
+        Vector result = Vector::MultiplyAdd( row.GetSplatX(), boneRow0, boneRow3 );
+        result = Vector::MultiplyAdd( row.GetSplatY(), boneRow1, result );
+        result = Vector::MultiplyAdd( row.GetSplatZ(), boneRow2, result );
+        outSkinningTransform[3] = result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CalculateSkinningTransforms( Matrix const* pInverseBindPose, Transform const* pBoneTransforms, Matrix* pSkinningTransforms, uint32_t numBones )
+    {
+        KRG_ASSERT( pInverseBindPose != nullptr && pBoneTransforms != nullptr && pSkinningTransforms != nullptr );
+
+        for ( uint32_t i = 0; i < numBones; i++ )
+        {
+            CalculateSkinningMatrix( pInverseBindPose[i], pBoneTransforms[i], pSkinningTransforms[i] );
+        }
+    }
+
+    void ExecuteSkinningTasks( SkinningTask const* pTasks, uint32_t numTasks )
+    {
+        KRG_ASSERT( pTasks != nullptr || numTasks == 0 );
+
+        for ( uint32_t t = 0; t < numTasks; t++ )
+        {
+            SkinningTask const& task = pTasks[t];
+            KRG_ASSERT( task.m_pInverseBindPose != nullptr && task.m_pMeshBoneTransforms != nullptr && task.m_pSkinningTransforms != nullptr );
+
+            // No pose, just regenerate the palette from the current mesh bones
+            if ( task.m_pPoseTransforms == nullptr )
+            {
+                CalculateSkinningTransforms( task.m_pInverseBindPose, task.m_pMeshBoneTransforms, task.m_pSkinningTransforms, task.m_numMeshBones );
+                continue;
+            }
+
+            // Copy the pose into the mesh bones and calculate the skinning matrix for each bone we touch
+            KRG_ASSERT( task.m_pPoseToMeshBoneMap != nullptr );
+            for ( uint32_t poseBoneIdx = 0; poseBoneIdx < task.m_numPoseBones; poseBoneIdx++ )
+            {
+                int32_t const meshBoneIdx = task.m_pPoseToMeshBoneMap[poseBoneIdx];
+                if ( meshBoneIdx != InvalidIndex )
+                {
+                    KRG_ASSERT( (uint32_t) meshBoneIdx < task.m_numMeshBones );
+                    Transform const& boneTransform = task.m_pPoseTransforms[poseBoneIdx];
+                    task.m_pMeshBoneTransforms[meshBoneIdx] = boneTransform;
+                    CalculateSkinningMatrix( task.m_pInverseBindPose[meshBoneIdx], boneTransform, task.m_pSkinningTransforms[meshBoneIdx] );
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CalculateSkinnedBounds( AABB const* pBoneVertexBounds, Matrix const* pSkinningTransforms, uint32_t numBones, AABB& outBounds )
+    {
+        KRG_ASSERT( pBoneVertexBounds != nullptr && pSkinningTransforms != nullptr );
+
+        Vector min( FLT_MAX );
+        Vector max( -FLT_MAX );
+        bool hasBounds = false;
+
+        for ( uint32_t i = 0; i < numBones; i++ )
+        {
+            AABB const& bindBounds = pBoneVertexBounds[i];
+            if ( !bindBounds.IsValid() )
+            {
+                continue;
+            }
+
+            Matrix const& skinningTransform = pSkinningTransforms[i];
+            Vector const center = skinningTransform.TransformPoint( bindBounds.GetCenter() );
+
+            Vector const& bindExtents = bindBounds.GetExtents();
+            Vector extents = skinningTransform[0].GetAbs() * bindExtents.GetSplatX();
+            extents = Vector::MultiplyAdd( skinningTransform[1].GetAbs(), bindExtents.GetSplatY(), extents );
+            extents = Vector::MultiplyAdd( skinningTransform[2].GetAbs(), bindExtents.GetSplatZ(), extents );
+
+            min = Vector::Min( min, center - extents );
+            max = Vector::Max( max, center + extents );
+            hasBounds = true;
+        }
+
+        if ( hasBounds )
+        {
+            outBounds = AABB::FromMinMax( min, max );
+        }
+
+        return hasBounds;
+    }
+}
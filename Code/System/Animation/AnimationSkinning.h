@@ -0,0 +1,37 @@
+#pragma once
+
+#include "System/_Module/API.h"
+#include "System/Math/BoundingVolumes.h"
+
+//-------------------------------------------------------------------------
+// Skinning Palette Generation
+//-------------------------------------------------------------------------
+// Generates the skinning matrices (inverse bind pose * character space bone transform) for skinned meshes
+// The inverse bind pose is expected to already be converted to matrices so that we only need to convert the bone transforms
+// Note: the skinning matrices are calculated via matrix multiplication so non-uniform scales are correctly propagated
+
+namespace KRG::Animation
+{
+    // Describes the palette generation for a single skinned mesh instance
+    struct SkinningTask
+    {
+        Transform const*                m_pPoseTransforms = nullptr;        // Optional: character space pose transforms in skeleton bone order, if not set the mesh bone transforms are used as is
+        int32_t const*                  m_pPoseToMeshBoneMap = nullptr;     // Required if we have pose transforms: maps skeleton bones to mesh bones (InvalidIndex for unmapped bones)
+        Matrix const*                   m_pInverseBindPose = nullptr;       // Per mesh bone
+        Transform*                      m_pMeshBoneTransforms = nullptr;    // Per mesh bone: updated with the pose transforms
+        Matrix*                         m_pSkinningTransforms = nullptr;    // Per mesh bone: output, when using a pose only the mapped bones are updated
+        uint32_t                        m_numPoseBones = 0;
+        uint32_t                        m_numMeshBones = 0;
+    };
+
+    // Calculate the skinning matrices for a set of character space bone transforms
+    KRG_SYSTEM_API void CalculateSkinningTransforms( Matrix const* pInverseBindPose, Transform const* pBoneTransforms, Matrix* pSkinningTransforms, uint32_t numBones );
+
+    // Copy the pose (if set) into the mesh bones and generate the skinning palette for a batch of meshes in a single pass
+    KRG_SYSTEM_API void ExecuteSkinningTasks( SkinningTask const* pTasks, uint32_t numTasks );
+
+    // Transform each bone's bind space vertex bounds by its skinning matrix and merge the results, invalid bone bounds are skipped
+    // Since a skinned vertex is a weighted average of its influences' transformed positions, it is always contained in the union of the transformed boxes
+    // Returns false if none of the bones have valid bounds
+    KRG_SYSTEM_API bool CalculateSkinnedBounds( AABB const* pBoneVertexBounds, Matrix const* pSkinningTransforms, uint32_t numBones, AABB& outBounds );
+}
@@ -7,6 +7,7 @@
 #include "System/Types/String.h"
 #include "System/Types/BitFlags.h"
 #include "System/Threading/Threading.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
@@ -231,39 +232,58 @@ namespace KRG::Drawing
     // Per-Thread command buffer
     //-------------------------------------------------------------------------
     // These are fully cleared each frame
+    // A shared buffer is used by any number of threads (when we run out of per-thread buffers), so all command adds are locked
 
     class ThreadCommandBuffer
     {
+        // Locks the buffer for the duration of the scope, only if the buffer is shared
+        struct SharedBufferScopeLock
+        {
+            SharedBufferScopeLock( ThreadCommandBuffer& buffer ) : m_pMutex( buffer.m_isShared ? &buffer.m_sharedMutex : nullptr ) { if ( m_pMutex != nullptr ) { m_pMutex->lock(); } }
+            ~SharedBufferScopeLock() { if ( m_pMutex != nullptr ) { m_pMutex->unlock(); } }
+
+            Threading::Mutex*       m_pMutex = nullptr;
+        };
 
     public:
 
-        ThreadCommandBuffer( Threading::ThreadID threadID )
+        ThreadCommandBuffer( Threading::ThreadID threadID, bool isShared = false )
             : m_ID( threadID )
+            , m_isShared( isShared )
         {}
 
         inline Threading::ThreadID GetThreadID() const { return m_ID; }
+        inline bool IsShared() const { return m_isShared; }
+
+        // Set once the owning thread has exited, after which the buffer is no longer written to and can be reclaimed
+        inline bool HasThreadExited() const { return m_hasThreadExited.load( std::memory_order_acquire ); }
+        inline void SetThreadExited() { m_hasThreadExited.store( true, std::memory_order_release ); }
 
         KRG_FORCE_INLINE void AddCommand( PointCommand&& cmd, DepthTestState depthTestState )
         {
             CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            SharedBufferScopeLock const lock( *this );
             pBuffer->m_pointCommands.emplace_back( eastl::move( cmd ) );
         }
 
         KRG_FORCE_INLINE void AddCommand( LineCommand&& cmd, DepthTestState depthTestState )
         {
             CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            SharedBufferScopeLock const lock( *this );
             pBuffer->m_lineCommands.emplace_back( eastl::move( cmd ) );
         }
 
         KRG_FORCE_INLINE void AddCommand( TriangleCommand&& cmd, DepthTestState depthTestState )
         {
             CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            SharedBufferScopeLock const lock( *this );
             pBuffer->m_triangleCommands.emplace_back( eastl::move( cmd ) );
         }
 
         KRG_FORCE_INLINE void AddCommand( TextCommand&& cmd, DepthTestState depthTestState )
         {
             CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            SharedBufferScopeLock const lock( *this );
             pBuffer->m_textCommands.emplace_back( eastl::move( cmd ) );
         }
 
@@ -301,6 +321,9 @@ namespace KRG::Drawing
     private:
 
         Threading::ThreadID         m_ID;
+        bool const                  m_isShared = false;
+        std::atomic<bool>           m_hasThreadExited = false;
+        Threading::Mutex            m_sharedMutex;
         CommandBuffer               m_opaqueDepthOn;
         CommandBuffer               m_opaqueDepthOff;
         CommandBuffer               m_transparentDepthOn;
@@ -5,55 +5,273 @@
 #if KRG_DEVELOPMENT_TOOLS
 namespace KRG::Drawing
 {
+    namespace
+    {
+        // Each thread caches the buffers it has registered with the last few drawing systems it has drawn into
+        // Systems are identified by a unique ID rather than by address, so that a new system created at the address of a destroyed one is never matched
+        struct ThreadBufferCacheEntry
+        {
+            uint32_t                    m_systemID = 0;
+            ThreadCommandBuffer*        m_pBuffer = nullptr;
+        };
+
+        static constexpr uint32_t const g_threadBufferCacheSize = 4;
+        thread_local ThreadBufferCacheEntry g_threadBufferCache[g_threadBufferCacheSize];
+        thread_local uint32_t g_nextThreadBufferCacheEntry = 0;
+
+        static std::atomic<uint32_t> g_nextDrawingSystemID = 1;
+
+        // All live drawing systems, the thread exit handler needs to know whether a buffer's system still exists before touching the buffer
+        static Threading::Mutex g_liveSystemsMutex;
+        static DrawingSystem* g_pFirstLiveSystem = nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+
+    // Every per-thread buffer a thread has registered, so that they can be flagged for reclaiming when the thread exits
+    // This never allocates, since it is destroyed on thread exit (potentially after the memory system has shutdown)
+    struct ThreadBufferRecords
+    {
+        static constexpr uint32_t const s_maxRecords = 16;
+
+        ~ThreadBufferRecords()
+        {
+            Threading::ScopeLock lock( g_liveSystemsMutex );
+
+            for ( uint32_t i = 0; i < m_numRecords; i++ )
+            {
+                for ( DrawingSystem* pSystem = g_pFirstLiveSystem; pSystem != nullptr; pSystem = pSystem->m_pNextLiveSystem )
+                {
+                    if ( pSystem->m_systemID == m_records[i].m_systemID )
+                    {
+                        m_records[i].m_pBuffer->SetThreadExited();
+                        break;
+                    }
+                }
+            }
+        }
+
+        // If we run out of records, the buffer will simply never be reclaimed
+        void AddRecord( uint32_t systemID, ThreadCommandBuffer* pBuffer )
+        {
+            // Remove the records for any systems that have been destroyed
+            {
+                Threading::ScopeLock lock( g_liveSystemsMutex );
+
+                for ( int32_t i = (int32_t) m_numRecords - 1; i >= 0; i-- )
+                {
+                    bool isSystemAlive = false;
+                    for ( DrawingSystem* pSystem = g_pFirstLiveSystem; pSystem != nullptr; pSystem = pSystem->m_pNextLiveSystem )
+                    {
+                        if ( pSystem->m_systemID == m_records[i].m_systemID )
+                        {
+                            isSystemAlive = true;
+                            break;
+                        }
+                    }
+
+                    if ( !isSystemAlive )
+                    {
+                        m_records[i] = m_records[m_numRecords - 1];
+                        m_numRecords--;
+                    }
+                }
+            }
+
+            if ( m_numRecords < s_maxRecords )
+            {
+                m_records[m_numRecords].m_systemID = systemID;
+                m_records[m_numRecords].m_pBuffer = pBuffer;
+                m_numRecords++;
+            }
+        }
+
+    public:
+
+        ThreadBufferCacheEntry          m_records[s_maxRecords];
+        uint32_t                        m_numRecords = 0;
+    };
+
+    static thread_local ThreadBufferRecords g_threadBufferRecords;
+
+    //-------------------------------------------------------------------------
+
+    DrawingSystem::DrawingSystem()
+        : m_sharedCommandBuffer( Threading::ThreadID(), true )
+        , m_systemID( g_nextDrawingSystemID++ )
+    {
+        for ( auto& pBuffer : m_threadCommandBuffers )
+        {
+            pBuffer.store( nullptr, std::memory_order_relaxed );
+        }
+
+        Threading::ScopeLock lock( g_liveSystemsMutex );
+        m_pNextLiveSystem = g_pFirstLiveSystem;
+        g_pFirstLiveSystem = this;
+    }
+
+    DrawingSystem::~DrawingSystem()
+    {
+        // Once we are removed from the live list, no exiting thread will touch our buffers
+        {
+            Threading::ScopeLock lock( g_liveSystemsMutex );
+
+            DrawingSystem** ppSystem = &g_pFirstLiveSystem;
+            while ( *ppSystem != this )
+            {
+                KRG_ASSERT( *ppSystem != nullptr );
+                ppSystem = &( *ppSystem )->m_pNextLiveSystem;
+            }
+            *ppSystem = m_pNextLiveSystem;
+        }
+
+        uint32_t const numBuffers = m_numThreadCommandBuffers.load( std::memory_order_acquire );
+        for ( uint32_t i = 0; i < numBuffers; i++ )
+        {
+            ThreadCommandBuffer* pThreadBuffer = m_threadCommandBuffers[i].load( std::memory_order_acquire );
+            KRG::Delete( pThreadBuffer );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     ThreadCommandBuffer& DrawingSystem::GetThreadCommandBuffer()
     {
-        Threading::ScopeLock Lock( m_commandBufferMutex );
+        for ( auto const& cacheEntry : g_threadBufferCache )
+        {
+            if ( cacheEntry.m_systemID == m_systemID )
+            {
+                return *cacheEntry.m_pBuffer;
+            }
+        }
 
+        return RegisterThreadCommandBuffer();
+    }
+
+    ThreadCommandBuffer& DrawingSystem::RegisterThreadCommandBuffer()
+    {
         auto const threadID = Threading::GetCurrentThreadID();
 
-        // Check for an already created buffer for this thread
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+        Threading::ScopeLock lock( m_registrationMutex );
+
+        // Reuse the existing buffer if this thread was evicted from its cache
+        // Thread IDs can be reused by the OS, so we need to skip any buffers whose thread has exited
+        ThreadCommandBuffer* pThreadBuffer = nullptr;
+        int32_t freeSlotIdx = InvalidIndex;
+        uint32_t const numBuffers = m_numThreadCommandBuffers.load( std::memory_order_acquire );
+        for ( uint32_t i = 0; i < numBuffers; i++ )
         {
-            if ( pThreadBuffer->GetThreadID() == threadID )
+            ThreadCommandBuffer* pBuffer = m_threadCommandBuffers[i].load( std::memory_order_acquire );
+            if ( pBuffer == nullptr )
+            {
+                if ( freeSlotIdx == InvalidIndex )
+                {
+                    freeSlotIdx = (int32_t) i;
+                }
+            }
+            else if ( pBuffer->GetThreadID() == threadID && !pBuffer->HasThreadExited() )
             {
-                return *pThreadBuffer;
+                pThreadBuffer = pBuffer;
+                break;
             }
         }
 
-        // Create a new buffer
-        auto& pThreadBuffer = m_threadCommandBuffers.emplace_back( KRG::New<ThreadCommandBuffer>( threadID ) );
+        // Create a new buffer in a free slot (or a new one) and publish it
+        if ( pThreadBuffer == nullptr )
+        {
+            if ( freeSlotIdx != InvalidIndex )
+            {
+                pThreadBuffer = KRG::New<ThreadCommandBuffer>( threadID );
+                m_threadCommandBuffers[freeSlotIdx].store( pThreadBuffer, std::memory_order_release );
+            }
+            else if ( numBuffers < s_maxThreadCommandBuffers )
+            {
+                pThreadBuffer = KRG::New<ThreadCommandBuffer>( threadID );
+                m_threadCommandBuffers[numBuffers].store( pThreadBuffer, std::memory_order_release );
+                m_numThreadCommandBuffers.store( numBuffers + 1, std::memory_order_release );
+            }
+            else // Out of slots, fall back to the shared buffer
+            {
+                pThreadBuffer = &m_sharedCommandBuffer;
+            }
+
+            if ( !pThreadBuffer->IsShared() )
+            {
+                g_threadBufferRecords.AddRecord( m_systemID, pThreadBuffer );
+            }
+        }
+
+        // Cache it for this thread
+        auto& cacheEntry = g_threadBufferCache[g_nextThreadBufferCacheEntry];
+        g_nextThreadBufferCacheEntry = ( g_nextThreadBufferCacheEntry + 1 ) % g_threadBufferCacheSize;
+        cacheEntry.m_systemID = m_systemID;
+        cacheEntry.m_pBuffer = pThreadBuffer;
+
         return *pThreadBuffer;
     }
 
-    DrawingSystem::~DrawingSystem()
+    uint32_t DrawingSystem::GetNumThreadCommandBuffers() const
     {
-        for ( auto& pBuffer : m_threadCommandBuffers )
+        uint32_t numUsedBuffers = 0;
+        uint32_t const numBuffers = m_numThreadCommandBuffers.load( std::memory_order_acquire );
+        for ( uint32_t i = 0; i < numBuffers; i++ )
         {
-            KRG::Delete( pBuffer );
+            if ( m_threadCommandBuffers[i].load( std::memory_order_acquire ) != nullptr )
+            {
+                numUsedBuffers++;
+            }
         }
+
+        return numUsedBuffers;
     }
 
+    //-------------------------------------------------------------------------
+
     void DrawingSystem::ReflectFrameCommandBuffer( Seconds const deltaTime, FrameCommandBuffer& reflectedFrameCommands )
     {
         // Reset the frame buffer for a new frame, flush old commands and only keep ones with a valid TTL
         reflectedFrameCommands.Reset( deltaTime );
 
         // Reflect all the new commands into the frame buffer
-        Threading::ScopeLock Lock( m_commandBufferMutex );
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+        // A slot may be free, in which case it can be skipped
+        uint32_t const numBuffers = m_numThreadCommandBuffers.load( std::memory_order_acquire );
+        for ( uint32_t i = 0; i < numBuffers; i++ )
         {
+            ThreadCommandBuffer* pThreadBuffer = m_threadCommandBuffers[i].load( std::memory_order_acquire );
+            if ( pThreadBuffer == nullptr )
+            {
+                continue;
+            }
+
             reflectedFrameCommands.AddThreadCommands( *pThreadBuffer );
             pThreadBuffer->Clear();
+
+            // Reclaim the slot once the owning thread has exited
+            if ( pThreadBuffer->HasThreadExited() )
+            {
+                Threading::ScopeLock lock( m_registrationMutex );
+                m_threadCommandBuffers[i].store( nullptr, std::memory_order_release );
+                KRG::Delete( pThreadBuffer );
+            }
         }
+
+        reflectedFrameCommands.AddThreadCommands( m_sharedCommandBuffer );
+        m_sharedCommandBuffer.Clear();
     }
 
     void DrawingSystem::Reset()
     {
-        Threading::ScopeLock Lock( m_commandBufferMutex );
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+        uint32_t const numBuffers = m_numThreadCommandBuffers.load( std::memory_order_acquire );
+        for ( uint32_t i = 0; i < numBuffers; i++ )
         {
-            pThreadBuffer->Clear();
+            ThreadCommandBuffer* pThreadBuffer = m_threadCommandBuffers[i].load( std::memory_order_acquire );
+            if ( pThreadBuffer != nullptr )
+            {
+                pThreadBuffer->Clear();
+            }
         }
+
+        m_sharedCommandBuffer.Clear();
     }
 }
 #endif
\ No newline at end of file
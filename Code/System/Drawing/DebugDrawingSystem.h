@@ -3,6 +3,7 @@
 #include "System/_Module/API.h"
 #include "System/Drawing/DebugDrawing.h"
 #include "System/Threading/Threading.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
@@ -11,10 +12,14 @@ namespace KRG::Drawing
 {
     class KRG_SYSTEM_API DrawingSystem
     {
+        friend struct ThreadBufferRecords;
+
+        // The max number of per-thread buffers for a single drawing system, any additional threads will draw into a shared (locked) buffer
+        static constexpr uint32_t const s_maxThreadCommandBuffers = 64;
 
     public:
 
-        DrawingSystem() = default;
+        DrawingSystem();
         ~DrawingSystem();
 
         // Empty all per thread buffers
@@ -24,16 +29,28 @@ namespace KRG::Drawing
         inline DrawContext GetDrawingContext() { return DrawContext( GetThreadCommandBuffer() ); }
 
         // Reflects all the individual per-thread buffers into a single supplied frame command buffer. Clears all thread buffers.
+        // This must not be called while other threads are drawing (i.e. only at frame end)
+        // This also reclaims the buffers of any threads that have exited
         void ReflectFrameCommandBuffer( Seconds const deltaTime, FrameCommandBuffer& reflectedFrameCommands );
 
+        // Debug info: the number of per-thread buffers currently in use
+        uint32_t GetNumThreadCommandBuffers() const;
+
     private:
 
         ThreadCommandBuffer& GetThreadCommandBuffer();
+        ThreadCommandBuffer& RegisterThreadCommandBuffer();
 
     private:
 
-        TVector<ThreadCommandBuffer*>       m_threadCommandBuffers;
-        Threading::Mutex                    m_commandBufferMutex;
+        // Buffers are registered once per thread and only removed (at frame end) once their thread has exited, so they can be gathered without locking
+        // A free slot is set to null and registration (which is rare) is serialized, so claiming a slot never races with another registration
+        std::atomic<ThreadCommandBuffer*>   m_threadCommandBuffers[s_maxThreadCommandBuffers];
+        std::atomic<uint32_t>               m_numThreadCommandBuffers = 0;
+        Threading::Mutex                    m_registrationMutex;
+        ThreadCommandBuffer                 m_sharedCommandBuffer;
+        uint32_t                            m_systemID = 0;
+        DrawingSystem*                      m_pNextLiveSystem = nullptr;    // Intrusive list of all live systems, needed to safely flag buffers on thread exit
     };
 }
 #endif
\ No newline at end of file
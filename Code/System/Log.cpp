@@ -2,6 +2,9 @@
 #include "System/Threading/Threading.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/FileSystem/FileStreams.h"
+#include "System/Memory/Memory.h"
+#include <atomic>
+#include <thread>
 #include <ctime>
 
 //-------------------------------------------------------------------------
@@ -12,17 +15,241 @@ namespace KRG::Log
     {
         static char const* const g_severityLabels[] = { "Message", "Warning", "Error", "Fatal Error" };
 
+        static constexpr uint32_t const g_ringBufferCapacity = 1024;
+        static constexpr uint32_t const g_maxRetainedEntries = 4096;
+        static constexpr uint32_t const g_maxUnhandledWarningsAndErrors = 256;
+        static constexpr uint32_t const g_maxMessageLength = 1024;
+        static constexpr uint32_t const g_maxChannelLength = 64;
+        static constexpr uint32_t const g_maxFilenameLength = 260;
+        static constexpr int32_t const g_logThreadMaxWaitTimeMs = 10; // Upper bound on the latency of a missed wake up
+
+        static_assert( ( g_ringBufferCapacity & ( g_ringBufferCapacity - 1 ) ) == 0, "Ring buffer capacity must be a power of 2" );
+
+        // A single slot in the ring buffer
+        // The sequence number hands the slot over: it equals the enqueue position when the slot is free, and the position + 1 once the entry is written
+        struct alignas( 64 ) QueuedEntry
+        {
+            std::atomic<uint64_t>               m_sequence = { 0 };
+            time_t                              m_time;
+            Severity                            m_severity;
+            uint32_t                            m_lineNumber;
+            char                                m_channel[g_maxChannelLength];
+            char                                m_filename[g_maxFilenameLength];
+            char                                m_message[g_maxMessageLength];
+        };
+
         struct LogData
         {
-            TVector<LogEntry>               m_logEntries;
-            TVector<LogEntry>               m_unhandledWarningsAndErrors;
-            Threading::Mutex                m_mutex;
-            int32_t                           m_fatalErrorIndex = InvalidIndex;
-            int32_t                           m_numWarnings = 0;
-            int32_t                           m_numErrors = 0;
+            LogData()
+            {
+                for ( uint64_t i = 0; i < g_ringBufferCapacity; i++ )
+                {
+                    m_ringBuffer[i].m_sequence.store( i, std::memory_order_relaxed );
+                }
+            }
+
+        public:
+
+            QueuedEntry                         m_ringBuffer[g_ringBufferCapacity];
+            alignas( 64 ) std::atomic<uint64_t> m_enqueuePosition = { 0 };
+            alignas( 64 ) std::atomic<uint64_t> m_dequeuePosition = { 0 };   // Only written by the log thread
+
+            // Log thread
+            std::thread                         m_logThread;
+            Threading::Mutex                    m_wakeMutex;
+            Threading::ConditionVariable        m_wakeCondition;
+            std::atomic<bool>                   m_isLogThreadWaiting = { false };
+            std::atomic<bool>                   m_shouldStop = { false };
+            std::atomic<bool>                   m_isConsoleOutputEnabled = { true };
+
+            // Output
+            Threading::Mutex                    m_outputFileMutex;
+            FileSystem::OutputFileStream*       m_pOutputFile = nullptr;
+
+            // History - written by the log thread
+            Threading::Mutex                    m_historyMutex;
+            TVector<LogEntry>                   m_history;                  // Circular once full
+            uint32_t                            m_historyStartIdx = 0;
+            TVector<LogEntry>                   m_unhandledWarningsAndErrors;
+            LogEntry                            m_fatalError;
+            std::atomic<bool>                   m_hasFatalErrorOccurred = { false };
+
+            // Stats
+            std::atomic<int32_t>                m_numWarnings = { 0 };
+            std::atomic<int32_t>                m_numErrors = { 0 };
+            std::atomic<uint64_t>               m_numProducedEntries = { 0 };
+            std::atomic<uint64_t>               m_numStalls = { 0 };
+            std::atomic<uint64_t>               m_totalProducerTime = { 0 };
+            std::atomic<uint64_t>               m_maxProducerTime = { 0 };
         };
 
-        static LogData*                     g_pLog = nullptr;
+        static LogData*                         g_pLog = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        static void CopyTruncated( char* pDestination, uint32_t destinationSize, char const* pSource )
+        {
+            uint32_t i = 0;
+            if ( pSource != nullptr )
+            {
+                for ( ; i < destinationSize - 1 && pSource[i] != 0; i++ )
+                {
+                    pDestination[i] = pSource[i];
+                }
+            }
+            pDestination[i] = 0;
+        }
+
+        static void WakeLogThread()
+        {
+            if ( g_pLog->m_isLogThreadWaiting.load( std::memory_order_acquire ) )
+            {
+                g_pLog->m_wakeCondition.notify_one();
+            }
+        }
+
+        // Log thread
+        //-------------------------------------------------------------------------
+
+        static void ProcessEntry( QueuedEntry const& queuedEntry, String& fileBuffer )
+        {
+            LogEntry entry;
+            entry.m_message = queuedEntry.m_message;
+            entry.m_channel = queuedEntry.m_channel;
+            entry.m_filename = queuedEntry.m_filename;
+            entry.m_lineNumber = queuedEntry.m_lineNumber;
+            entry.m_severity = queuedEntry.m_severity;
+            entry.m_timestamp.resize( 9 );
+            strftime( entry.m_timestamp.data(), 9, "%H:%M:%S", std::localtime( &queuedEntry.m_time ) );
+
+            // Immediate display of log
+            //-------------------------------------------------------------------------
+            // This uses a less verbose format, if you want more info look at the saved log
+
+            if ( g_pLog->m_isConsoleOutputEnabled.load( std::memory_order_relaxed ) )
+            {
+                char buffer[g_maxMessageLength + 128];
+                Printf( buffer, sizeof( buffer ), "[%s][%s][%s] %s", entry.m_timestamp.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_channel.c_str(), entry.m_message.c_str() );
+
+                // Print to debug trace
+                KRG_TRACE_MSG( buffer );
+
+                // Print to std out
+                printf( "%s\n", buffer );
+            }
+
+            // File output (written out per batch)
+            //-------------------------------------------------------------------------
+
+            {
+                char buffer[g_maxMessageLength + g_maxFilenameLength + 128];
+                Printf( buffer, sizeof( buffer ), "[%s] %s >>> %s: %s, Source: %s, %i\r\n", entry.m_timestamp.c_str(), entry.m_channel.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_message.c_str(), entry.m_filename.c_str(), entry.m_lineNumber );
+                fileBuffer.append( buffer );
+            }
+
+            // History
+            //-------------------------------------------------------------------------
+
+            Threading::ScopeLock lock( g_pLog->m_historyMutex );
+
+            if ( entry.m_severity == Severity::FatalError )
+            {
+                g_pLog->m_fatalError = entry;
+                g_pLog->m_hasFatalErrorOccurred.store( true, std::memory_order_release );
+            }
+
+            if ( entry.m_severity > Severity::Message )
+            {
+                if ( g_pLog->m_unhandledWarningsAndErrors.size() == g_maxUnhandledWarningsAndErrors )
+                {
+                    g_pLog->m_unhandledWarningsAndErrors.erase( g_pLog->m_unhandledWarningsAndErrors.begin() );
+                }
+                g_pLog->m_unhandledWarningsAndErrors.emplace_back( entry );
+            }
+
+            if ( g_pLog->m_history.size() < g_maxRetainedEntries )
+            {
+                g_pLog->m_history.emplace_back( eastl::move( entry ) );
+            }
+            else
+            {
+                g_pLog->m_history[g_pLog->m_historyStartIdx] = eastl::move( entry );
+                g_pLog->m_historyStartIdx = ( g_pLog->m_historyStartIdx + 1 ) % g_maxRetainedEntries;
+            }
+        }
+
+        // Process entries until a stop is requested
+        static void ProcessEntriesUntilStopped()
+        {
+            String fileBuffer;
+            uint64_t dequeuePosition = g_pLog->m_dequeuePosition.load( std::memory_order_relaxed );
+
+            while ( true )
+            {
+                // Process all available entries
+                //-------------------------------------------------------------------------
+
+                bool const shouldStop = g_pLog->m_shouldStop.load( std::memory_order_acquire );
+
+                while ( true )
+                {
+                    QueuedEntry& queuedEntry = g_pLog->m_ringBuffer[dequeuePosition & ( g_ringBufferCapacity - 1 )];
+                    if ( queuedEntry.m_sequence.load( std::memory_order_acquire ) != dequeuePosition + 1 )
+                    {
+                        break;
+                    }
+
+                    ProcessEntry( queuedEntry, fileBuffer );
+
+                    // Release the slot for the next lap around the ring buffer
+                    queuedEntry.m_sequence.store( dequeuePosition + g_ringBufferCapacity, std::memory_order_release );
+                    dequeuePosition++;
+                }
+
+                if ( !fileBuffer.empty() )
+                {
+                    Threading::ScopeLock lock( g_pLog->m_outputFileMutex );
+                    if ( g_pLog->m_pOutputFile != nullptr && g_pLog->m_pOutputFile->IsValid() )
+                    {
+                        g_pLog->m_pOutputFile->Write( fileBuffer.data(), fileBuffer.size() );
+                        g_pLog->m_pOutputFile->GetStream().flush();
+                    }
+                    fileBuffer.clear();
+                }
+
+                // Only update the processed position once the file has been written so that flushing guarantees the entries are on disk
+                g_pLog->m_dequeuePosition.store( dequeuePosition, std::memory_order_release );
+
+                // All entries added before the stop request have been processed
+                if ( shouldStop )
+                {
+                    break;
+                }
+
+                // Wait for more entries
+                //-------------------------------------------------------------------------
+
+                Threading::Lock lock( g_pLog->m_wakeMutex );
+                g_pLog->m_isLogThreadWaiting.store( true, std::memory_order_release );
+                auto HasWork = [dequeuePosition] ()
+                {
+                    return g_pLog->m_shouldStop.load( std::memory_order_acquire ) || g_pLog->m_enqueuePosition.load( std::memory_order_acquire ) != dequeuePosition;
+                };
+                g_pLog->m_wakeCondition.wait_for( lock, std::chrono::milliseconds( g_logThreadMaxWaitTimeMs ), HasWork );
+                g_pLog->m_isLogThreadWaiting.store( false, std::memory_order_release );
+            }
+        }
+
+        // All thread allocations (i.e. the file buffer) need to be released before the thread heap is shutdown
+        static void LogThreadFunction()
+        {
+            Memory::InitializeThreadHeap();
+            Threading::SetCurrentThreadName( "Log Thread" );
+
+            ProcessEntriesUntilStopped();
+
+            Memory::ShutdownThreadHeap();
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -31,11 +258,22 @@ namespace KRG::Log
     {
         KRG_ASSERT( g_pLog == nullptr );
         g_pLog = KRG::New<LogData>();
+        g_pLog->m_history.reserve( g_maxRetainedEntries );
+        g_pLog->m_logThread = std::thread( LogThreadFunction );
     }
 
     void Shutdown()
     {
         KRG_ASSERT( g_pLog != nullptr );
+
+        {
+            Threading::ScopeLock lock( g_pLog->m_wakeMutex );
+            g_pLog->m_shouldStop.store( true, std::memory_order_release );
+        }
+        g_pLog->m_wakeCondition.notify_one();
+        g_pLog->m_logThread.join();
+
+        KRG::Delete( g_pLog->m_pOutputFile );
         KRG::Delete( g_pLog );
     }
 
@@ -46,12 +284,6 @@ namespace KRG::Log
 
     //-------------------------------------------------------------------------
 
-    TVector<KRG::Log::LogEntry> const& GetLogEntries()
-    {
-        KRG_ASSERT( IsInitialized() );
-        return g_pLog->m_logEntries;
-    }
-
     void AddEntry( Severity severity, char const* pChannel, char const* pFilename, int pLineNumber, char const* pMessageFormat, ... )
     {
         KRG_ASSERT( IsInitialized() );
@@ -65,58 +297,136 @@ namespace KRG::Log
     {
         KRG_ASSERT( IsInitialized() && pFilename != nullptr );
 
-        char msgbuffer[1024];
-        VPrintf( msgbuffer, 1024, pMessageFormat, args );
-        va_end( args );
+        uint64_t const startTime = PlatformClock::GetTime().ToU64();
 
+        // Claim a slot
+        //-------------------------------------------------------------------------
+
+        bool hasStalled = false;
+        QueuedEntry* pQueuedEntry = nullptr;
+        uint64_t position = g_pLog->m_enqueuePosition.load( std::memory_order_relaxed );
+        while ( true )
         {
-            std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
+            pQueuedEntry = &g_pLog->m_ringBuffer[position & ( g_ringBufferCapacity - 1 )];
+            uint64_t const sequence = pQueuedEntry->m_sequence.load( std::memory_order_acquire );
+            int64_t const difference = (int64_t) sequence - (int64_t) position;
 
-            if ( severity == Severity::FatalError )
+            if ( difference == 0 )
+            {
+                if ( g_pLog->m_enqueuePosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+                {
+                    break;
+                }
+            }
+            else if ( difference < 0 )
+            {
+                // The ring buffer is full, wait for the log thread to release a slot
+                hasStalled = true;
+                WakeLogThread();
+                std::this_thread::yield();
+                position = g_pLog->m_enqueuePosition.load( std::memory_order_relaxed );
+            }
+            else
             {
-                g_pLog->m_fatalErrorIndex = (int32_t) g_pLog->m_logEntries.size();
+                // Another producer claimed this slot
+                position = g_pLog->m_enqueuePosition.load( std::memory_order_relaxed );
             }
+        }
 
-            auto& entry = g_pLog->m_logEntries.emplace_back( LogEntry() );
+        // Fill and publish the entry
+        //-------------------------------------------------------------------------
 
-            //-------------------------------------------------------------------------
+        pQueuedEntry->m_time = std::time( nullptr );
+        pQueuedEntry->m_severity = severity;
+        pQueuedEntry->m_lineNumber = pLineNumber;
+        CopyTruncated( pQueuedEntry->m_channel, g_maxChannelLength, pChannel );
+        CopyTruncated( pQueuedEntry->m_filename, g_maxFilenameLength, pFilename );
+        VPrintf( pQueuedEntry->m_message, g_maxMessageLength, pMessageFormat, args );
 
-            entry.m_message = msgbuffer;
-            entry.m_channel = pChannel;
-            entry.m_filename = pFilename;
-            entry.m_lineNumber = pLineNumber;
-            entry.m_severity = severity;
-            entry.m_timestamp.resize( 9 );
+        pQueuedEntry->m_sequence.store( position + 1, std::memory_order_release );
+        WakeLogThread();
 
-            auto t = std::time( nullptr );
-            strftime( entry.m_timestamp.data(), 9, "%H:%M:%S", std::localtime( &t ) );
+        // Update stats
+        //-------------------------------------------------------------------------
 
-            // Immediate display of log
-            //-------------------------------------------------------------------------
-            // This uses a less verbose format, if you want more info look at the saved log
+        if ( severity == Severity::Warning )
+        {
+            g_pLog->m_numWarnings.fetch_add( 1, std::memory_order_relaxed );
+        }
+        else if ( severity == Severity::Error )
+        {
+            g_pLog->m_numErrors.fetch_add( 1, std::memory_order_relaxed );
+        }
 
-            Printf( msgbuffer, 1024, "[%s][%s][%s] %s", entry.m_timestamp.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_channel.c_str(), entry.m_message.c_str() );
+        uint64_t const elapsedTime = PlatformClock::GetTime().ToU64() - startTime;
+        g_pLog->m_numProducedEntries.fetch_add( 1, std::memory_order_relaxed );
+        g_pLog->m_numStalls.fetch_add( hasStalled ? 1 : 0, std::memory_order_relaxed );
+        g_pLog->m_totalProducerTime.fetch_add( elapsedTime, std::memory_order_relaxed );
 
-            // Print to debug trace
-            KRG_TRACE_MSG( msgbuffer );
+        uint64_t maxTime = g_pLog->m_maxProducerTime.load( std::memory_order_relaxed );
+        while ( elapsedTime > maxTime && !g_pLog->m_maxProducerTime.compare_exchange_weak( maxTime, elapsedTime, std::memory_order_relaxed ) ) {}
 
-            // Print to std out
-            printf( "%s\n", msgbuffer );
+        // Fatal errors halt immediately after logging, so make sure the entry has been output
+        //-------------------------------------------------------------------------
 
-            // Track unhandled warnings and errors
-            //-------------------------------------------------------------------------
+        if ( severity == Severity::FatalError )
+        {
+            Flush();
+        }
+    }
 
-            if ( entry.m_severity > Severity::Message )
-            {
-                g_pLog->m_numWarnings += ( entry.m_severity == Severity::Warning ) ? 1 : 0;
-                g_pLog->m_numErrors += ( entry.m_severity == Severity::Error ) ? 1 : 0;
-                g_pLog->m_unhandledWarningsAndErrors.emplace_back( entry );
-            }
+    void Flush()
+    {
+        KRG_ASSERT( IsInitialized() );
+
+        uint64_t const targetPosition = g_pLog->m_enqueuePosition.load( std::memory_order_acquire );
+        while ( g_pLog->m_dequeuePosition.load( std::memory_order_acquire ) < targetPosition )
+        {
+            WakeLogThread();
+            std::this_thread::yield();
         }
     }
 
     //-------------------------------------------------------------------------
 
+    TVector<LogEntry> GetLogEntries()
+    {
+        KRG_ASSERT( IsInitialized() );
+        Threading::ScopeLock lock( g_pLog->m_historyMutex );
+
+        // Unroll the circular buffer so that the entries are in order
+        TVector<LogEntry> outEntries;
+        outEntries.reserve( g_pLog->m_history.size() );
+        outEntries.insert( outEntries.end(), g_pLog->m_history.begin() + g_pLog->m_historyStartIdx, g_pLog->m_history.end() );
+        outEntries.insert( outEntries.end(), g_pLog->m_history.begin(), g_pLog->m_history.begin() + g_pLog->m_historyStartIdx );
+        return outEntries;
+    }
+
+    uint64_t GetNumProcessedEntries()
+    {
+        KRG_ASSERT( IsInitialized() );
+        return g_pLog->m_dequeuePosition.load( std::memory_order_acquire );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void SetOutputFile( FileSystem::Path const& logFilePath )
+    {
+        KRG_ASSERT( IsInitialized() && logFilePath.IsValid() && logFilePath.IsFilePath() );
+
+        auto pNewOutputFile = KRG::New<FileSystem::OutputFileStream>( logFilePath );
+
+        Threading::ScopeLock lock( g_pLog->m_outputFileMutex );
+        KRG::Delete( g_pLog->m_pOutputFile );
+        g_pLog->m_pOutputFile = pNewOutputFile;
+    }
+
+    void SetConsoleOutputEnabled( bool isEnabled )
+    {
+        KRG_ASSERT( IsInitialized() );
+        g_pLog->m_isConsoleOutputEnabled.store( isEnabled, std::memory_order_relaxed );
+    }
+
     void SaveToFile( FileSystem::Path const& logFilePath )
     {
         KRG_ASSERT( IsInitialized() && logFilePath.IsValid() && logFilePath.IsFilePath() );
@@ -125,11 +435,10 @@ namespace KRG::Log
 
         String logData;
 
-        char buffer[1024];
-        std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
-        for ( auto const& entry : g_pLog->m_logEntries )
+        char buffer[g_maxMessageLength + g_maxFilenameLength + 128];
+        for ( auto const& entry : GetLogEntries() )
         {
-            Printf( buffer, 1024, "[%s] %s >>> %s: %s, Source: %s, %i\r\n", entry.m_timestamp.c_str(), entry.m_channel.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_message.c_str(), entry.m_filename.c_str(), entry.m_lineNumber );
+            Printf( buffer, sizeof( buffer ), "[%s] %s >>> %s: %s, Source: %s, %i\r\n", entry.m_timestamp.c_str(), entry.m_channel.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_message.c_str(), entry.m_filename.c_str(), entry.m_lineNumber );
             logData.append( buffer );
         }
 
@@ -142,13 +451,13 @@ namespace KRG::Log
     bool HasFatalErrorOccurred()
     {
         KRG_ASSERT( IsInitialized() );
-        return g_pLog->m_fatalErrorIndex != InvalidIndex;
+        return g_pLog->m_hasFatalErrorOccurred.load( std::memory_order_acquire );
     }
 
     LogEntry const& GetFatalError()
     {
-        KRG_ASSERT( IsInitialized() && g_pLog->m_fatalErrorIndex != InvalidIndex );
-        return g_pLog->m_logEntries[g_pLog->m_fatalErrorIndex];
+        KRG_ASSERT( IsInitialized() && HasFatalErrorOccurred() );
+        return g_pLog->m_fatalError;
     }
 
     //-------------------------------------------------------------------------
@@ -156,9 +465,9 @@ namespace KRG::Log
     TVector<Log::LogEntry> GetUnhandledWarningsAndErrors()
     {
         KRG_ASSERT( IsInitialized() );
-        std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
+        Threading::ScopeLock lock( g_pLog->m_historyMutex );
 
-        TVector<Log::LogEntry> outEntries = g_pLog->m_unhandledWarningsAndErrors;
+        TVector<Log::LogEntry> outEntries = eastl::move( g_pLog->m_unhandledWarningsAndErrors );
         g_pLog->m_unhandledWarningsAndErrors.clear();
         return outEntries;
     }
@@ -166,12 +475,24 @@ namespace KRG::Log
     int32_t GetNumWarnings()
     {
         KRG_ASSERT( IsInitialized() );
-        return g_pLog->m_numWarnings;
+        return g_pLog->m_numWarnings.load( std::memory_order_relaxed );
     }
 
     int32_t GetNumErrors()
     {
         KRG_ASSERT( IsInitialized() );
-        return g_pLog->m_numErrors;
+        return g_pLog->m_numErrors.load( std::memory_order_relaxed );
+    }
+
+    ProducerStats GetProducerStats()
+    {
+        KRG_ASSERT( IsInitialized() );
+
+        ProducerStats stats;
+        stats.m_numEntries = g_pLog->m_numProducedEntries.load( std::memory_order_relaxed );
+        stats.m_numStalls = g_pLog->m_numStalls.load( std::memory_order_relaxed );
+        stats.m_totalTime = g_pLog->m_totalProducerTime.load( std::memory_order_relaxed );
+        stats.m_maxTime = g_pLog->m_maxProducerTime.load( std::memory_order_relaxed );
+        return stats;
     }
-}
\ No newline at end of file
+}
@@ -4,8 +4,15 @@
 #include "System/Types/String.h"
 #include "System/Types/Arrays.h"
 #include "System/FileSystem/FileSystemPath.h"
+#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
+// Logging
+//-------------------------------------------------------------------------
+// Adding an entry only formats the message into a slot in a fixed size lock-free ring buffer
+// A background thread then timestamps the entries, prints them, streams them to the log file and records them in the history
+// If the ring buffer is full, the producer will wait for the log thread to free up a slot (this is tracked as a stall)
+// Only a fixed number of the most recent entries are retained in the history
 
 namespace KRG::Log
 {
@@ -27,6 +34,19 @@ namespace KRG::Log
         Severity    m_severity;
     };
 
+    // Statistics for the threads adding entries, this is the cost that logging adds to the calling code
+    struct ProducerStats
+    {
+        inline Microseconds GetAverageTime() const { return ( m_numEntries > 0 ) ? Microseconds( Nanoseconds( m_totalTime.ToU64() / m_numEntries ) ) : Microseconds( 0.0f ); }
+
+    public:
+
+        uint64_t    m_numEntries = 0;
+        uint64_t    m_numStalls = 0;        // The number of times an entry had to wait for a free slot
+        Nanoseconds m_totalTime = 0;
+        Nanoseconds m_maxTime = 0;
+    };
+
     // Lifetime
     //-------------------------------------------------------------------------
 
@@ -39,13 +59,30 @@ namespace KRG::Log
 
     KRG_SYSTEM_API void AddEntry( Severity severity, char const* pChannel, char const* pFilename, int pLineNumber, char const* pMessageFormat, ... );
     KRG_SYSTEM_API void AddEntryVarArgs( Severity severity, char const* pChannel, char const* pFilename, int pLineNumber, char const* pMessageFormat, va_list args );
-    KRG_SYSTEM_API TVector<LogEntry> const& GetLogEntries();
+
+    // Blocks until all entries added before this call have been processed by the log thread
+    KRG_SYSTEM_API void Flush();
+
+    // Returns a copy of the retained history (only the most recent entries are kept)
+    KRG_SYSTEM_API TVector<LogEntry> GetLogEntries();
+
+    // The total number of entries processed so far, this can be used to detect if the history has changed
+    KRG_SYSTEM_API uint64_t GetNumProcessedEntries();
+
     KRG_SYSTEM_API int32_t GetNumWarnings();
     KRG_SYSTEM_API int32_t GetNumErrors();
+    KRG_SYSTEM_API ProducerStats GetProducerStats();
 
     // Output
     //-------------------------------------------------------------------------
 
+    // Stream all processed entries to the specified file, this replaces any previously set file
+    KRG_SYSTEM_API void SetOutputFile( FileSystem::Path const& logFilePath );
+
+    // Enable/disable printing entries to std out and the debug trace
+    KRG_SYSTEM_API void SetConsoleOutputEnabled( bool isEnabled );
+
+    // Save the retained history to a file
     KRG_SYSTEM_API void SaveToFile( FileSystem::Path const& logFilePath );
 
     // Warnings and errors
@@ -62,13 +62,13 @@ namespace KRG::Math
         KRG_ASSERT( newBox.IsValid() );
 
         // All boxes must have a non-zero unique userdata value as that is also used as the ID
-        KRG_ASSERT( userData != 0 && !VectorContains( m_nodes, userData, [] ( Node const& node, uint64_t userData ) { return !node.m_isFree && node.IsLeafNode() && node.m_userData == userData; } ) );
+        KRG_ASSERT( userData != 0 && !ContainsBox( userData ) );
 
         // First box
         if ( m_rootNodeIdx == InvalidIndex )
         {
-            RequestNode( newBox, userData );
-            m_rootNodeIdx = 0;
+            m_rootNodeIdx = RequestNode( newBox, userData );
+            m_leafNodeIndices[userData] = m_rootNodeIdx;
         }
         // If the root node is a leaf, the new box is a sibling
         else if ( m_nodes[m_rootNodeIdx].IsLeafNode() )
@@ -83,6 +83,12 @@ namespace KRG::Math
         }
     }
 
+    void AABBTree::UpdateBox( AABB const& aabb, uint64_t userData )
+    {
+        RemoveBox( userData );
+        InsertBox( aabb, userData );
+    }
+
     void AABBTree::UpdateBranchNodeBounds( int32_t nodeIdx )
     {
         auto& currentNode = m_nodes[nodeIdx];
@@ -111,6 +117,7 @@ namespace KRG::Math
 
         // Create the sibling node and set it as the right child
         int32_t const newSiblingNodeIdx = RequestNode( newSiblingBox, userData );
+        m_leafNodeIndices[userData] = newSiblingNodeIdx;
         m_nodes[newBranchNodeIdx].m_rightNodeIdx = newSiblingNodeIdx;
         m_nodes[m_nodes[newBranchNodeIdx].m_rightNodeIdx].m_parentNodeIdx = newBranchNodeIdx;
 
@@ -145,8 +152,12 @@ namespace KRG::Math
 
     void AABBTree::RemoveBox( uint64_t userData )
     {
-        int32_t const nodeToRemoveIdx = VectorFindIndex( m_nodes, userData, [] ( Node const& node, uint64_t userData ) { return !node.m_isFree && node.IsLeafNode() && node.m_userData == userData; } );
-        KRG_ASSERT( nodeToRemoveIdx != InvalidIndex && m_nodes[nodeToRemoveIdx].IsLeafNode() );
+        auto foundIter = m_leafNodeIndices.find( userData );
+        KRG_ASSERT( foundIter != m_leafNodeIndices.end() );
+
+        int32_t const nodeToRemoveIdx = foundIter->second;
+        KRG_ASSERT( !m_nodes[nodeToRemoveIdx].m_isFree && m_nodes[nodeToRemoveIdx].IsLeafNode() && m_nodes[nodeToRemoveIdx].m_userData == userData );
+        m_leafNodeIndices.erase( foundIter );
         RemoveNode( nodeToRemoveIdx );
     }
 
@@ -241,13 +252,17 @@ namespace KRG::Math
     void AABBTree::FindAllOverlappingLeafNodes( int32_t currentNodeIdx, AABB const& queryBox, TVector<uint64_t>& outResults ) const
     {
         Node const& currentNode = m_nodes[currentNodeIdx];
+
+        // Branch bounds enclose all their children so we can early out of the entire subtree
+        if ( !currentNode.m_bounds.Overlaps( queryBox ) )
+        {
+            return;
+        }
+
         if ( currentNode.IsLeafNode() )
         {
-            if ( currentNode.m_bounds.Overlaps( queryBox ) )
-            {
-                KRG_ASSERT( currentNode.m_userData != 0 );
-                outResults.push_back( currentNode.m_userData );
-            }
+            KRG_ASSERT( currentNode.m_userData != 0 );
+            outResults.push_back( currentNode.m_userData );
         }
         else
         {
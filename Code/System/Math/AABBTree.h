@@ -2,6 +2,7 @@
 
 #include "System/Math/BoundingVolumes.h"
 #include "System/Types/Arrays.h"
+#include "System/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -45,6 +46,12 @@ namespace KRG::Math
         void InsertBox( AABB const& aabb, uint64_t userData );
         void RemoveBox( uint64_t userData );
 
+        // Replace the bounds for an existing box, this is the same as a remove followed by an insert
+        void UpdateBox( AABB const& aabb, uint64_t userData );
+
+        inline bool ContainsBox( uint64_t userData ) const { return m_leafNodeIndices.find( userData ) != m_leafNodeIndices.end(); }
+        inline uint32_t GetNumBoxes() const { return (uint32_t) m_leafNodeIndices.size(); }
+
         KRG_FORCE_INLINE void InsertBox( AABB const& aabb, void* pUserData ) { InsertBox( aabb, reinterpret_cast<uint64_t>( pUserData ) ); }
         KRG_FORCE_INLINE void RemoveBox( void* pUserData ) { RemoveBox( reinterpret_cast<uint64_t>( pUserData ) ); }
 
@@ -81,6 +88,7 @@ namespace KRG::Math
     private:
 
         TVector<Node>       m_nodes;
+        THashMap<uint64_t, int32_t> m_leafNodeIndices;
         int32_t               m_rootNodeIdx = InvalidIndex;
         int32_t               m_freeNodeIdx = 0;
     };
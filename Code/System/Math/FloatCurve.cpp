@@ -2,6 +2,7 @@
 #include "Curves.h"
 #include "Vector.h"
 #include "System/Types/String.h"
+#include <EASTL/algorithm.h>
 
 //-------------------------------------------------------------------------
 
@@ -34,21 +35,7 @@ namespace KRG
 
         if ( parameterRange.ContainsExclusive( parameter ) )
         {
-            int32_t const numPoints = GetNumPoints();
-            int32_t const numCurves = numPoints - 1;
-            for ( int32_t i = 0; i < numCurves; i++ )
-            {
-                int32_t const startIdx = i;
-                int32_t const endIdx = i + 1;
-
-                // If the parameter is within this curve, evaluate it
-                if ( parameter >= m_points[startIdx].m_parameter && parameter <= m_points[endIdx].m_parameter )
-                {
-                    float const T = ( parameter - m_points[startIdx].m_parameter ) / ( m_points[endIdx].m_parameter - m_points[startIdx].m_parameter );
-                    result = Math::CubicHermite::Evaluate( m_points[startIdx].m_value, m_points[startIdx].m_outTangent, m_points[endIdx].m_value, m_points[endIdx].m_inTangent, T );
-                    break;
-                }
-            }
+            result = EvaluateSegment( FindSegment( parameter ), parameter );
         }
         else // Outside curve range
         {
@@ -65,6 +52,59 @@ namespace KRG
         return result;
     }
 
+    void FloatCurve::Evaluate( float const* pParameters, float* pResults, uint32_t numParameters ) const
+    {
+        KRG_ASSERT( ( pParameters != nullptr && pResults != nullptr ) || numParameters == 0 );
+
+        if ( m_points.size() < 2 )
+        {
+            float const value = m_points.empty() ? 0.0f : m_points[0].m_value;
+            for ( uint32_t i = 0; i < numParameters; i++ )
+            {
+                pResults[i] = value;
+            }
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        FloatRange const parameterRange = GetParameterRange();
+        int32_t segmentIdx = 0;
+
+        for ( uint32_t i = 0; i < numParameters; i++ )
+        {
+            float const parameter = pParameters[i];
+
+            if ( parameterRange.ContainsExclusive( parameter ) )
+            {
+                // Only search if the parameter is outside the previous segment
+                if ( parameter < m_points[segmentIdx].m_parameter || parameter >= m_points[segmentIdx + 1].m_parameter )
+                {
+                    segmentIdx = FindSegment( parameter );
+                }
+
+                pResults[i] = EvaluateSegment( segmentIdx, parameter );
+            }
+            else
+            {
+                pResults[i] = ( parameter <= parameterRange.m_begin ) ? m_points[0].m_value : m_points.back().m_value;
+            }
+        }
+    }
+
+    int32_t FloatCurve::FindSegment( float parameter ) const
+    {
+        KRG_ASSERT( m_points.size() >= 2 );
+
+        // Find the first point after the parameter, the segment starts at the point before it
+        // Since the parameter is within the range, this will never be the first point and coincident points will result in skipping the zero length segments
+        auto const Predicate = [] ( float parameter, Point const& point ) { return parameter < point.m_parameter; };
+        auto const iter = eastl::upper_bound( m_points.begin(), m_points.end(), parameter, Predicate );
+
+        int32_t const numCurves = GetNumPoints() - 1;
+        return Math::Clamp( (int32_t) ( iter - m_points.begin() ) - 1, 0, numCurves - 1 );
+    }
+
     void FloatCurve::AddPoint( float parameter, float value, float inTangent, float outTangent )
     {
         m_points.push_back( { parameter, value, inTangent, outTangent } );
@@ -208,4 +248,119 @@ namespace KRG
 
         return curveStr;
     }
+
+    //-------------------------------------------------------------------------
+    // Baked Curve
+    //-------------------------------------------------------------------------
+
+    void BakedFloatCurve::Bake( FloatCurve const& curve, int32_t numSamples )
+    {
+        KRG_ASSERT( numSamples >= 2 );
+
+        FloatRange const parameterRange = curve.GetParameterRange();
+        float const parameterLength = parameterRange.GetLength();
+        float const sampleSpacing = parameterLength / ( numSamples - 1 );
+
+        m_parameterStart = parameterRange.m_begin;
+        m_inverseSampleSpacing = ( parameterLength > 0.0f ) ? 1.0f / sampleSpacing : 0.0f;
+        m_lastSegmentIdx = float( numSamples - 1 );
+
+        m_samples.resize( numSamples );
+        for ( int32_t i = 0; i < numSamples; i++ )
+        {
+            m_samples[i] = curve.Evaluate( m_parameterStart + i * sampleSpacing );
+        }
+
+        // Calculate the max error
+        //-------------------------------------------------------------------------
+        // Between two source points the curve is a single cubic and between two samples the table is linear, so the error is a cubic on every interval bounded by both
+        // Its max is either at the ends of an interval (this covers every source point, where the tangents can be discontinuous) or at a zero of its derivative
+
+        m_maxError = 0.0f;
+        auto MeasureError = [this, &curve] ( float parameter )
+        {
+            m_maxError = Math::Max( m_maxError, Math::Abs( Evaluate( parameter ) - curve.Evaluate( parameter ) ) );
+        };
+
+        int32_t const numPoints = curve.GetNumPoints();
+        for ( int32_t i = 0; i < numPoints; i++ )
+        {
+            MeasureError( curve.GetPoint( i ).m_parameter );
+        }
+
+        for ( int32_t i = 0; i < numPoints - 1; i++ )
+        {
+            auto const& start = curve.GetPoint( i );
+            auto const& end = curve.GetPoint( i + 1 );
+            float const segmentLength = end.m_parameter - start.m_parameter;
+            if ( segmentLength <= 0.0f )
+            {
+                continue;
+            }
+
+            // The segment's cubic: value = start.m_value + b*T + c*T^2 + d*T^3, with T in [0,1]
+            float const b = start.m_outTangent;
+            float const c = 3 * ( end.m_value - start.m_value ) - 2 * start.m_outTangent - end.m_inTangent;
+            float const d = 2 * ( start.m_value - end.m_value ) + start.m_outTangent + end.m_inTangent;
+
+            int32_t const firstSampleIdx = Math::Clamp( (int32_t) ( ( start.m_parameter - m_parameterStart ) * m_inverseSampleSpacing ), 0, numSamples - 2 );
+            for ( int32_t s = firstSampleIdx; s < numSamples - 1; s++ )
+            {
+                float const intervalStart = Math::Max( m_parameterStart + s * sampleSpacing, start.m_parameter );
+                float const intervalEnd = Math::Min( m_parameterStart + ( s + 1 ) * sampleSpacing, end.m_parameter );
+                if ( intervalStart >= end.m_parameter )
+                {
+                    break;
+                }
+
+                MeasureError( intervalStart );
+                MeasureError( intervalEnd );
+
+                // Solve for the zeros of the error derivative: 3d*T^2 + 2c*T + ( b - tableSlope ) = 0, with the table slope expressed per unit of T
+                float const tableSlope = ( m_samples[s + 1] - m_samples[s] ) * m_inverseSampleSpacing * segmentLength;
+                float const qa = 3 * d;
+                float const qb = 2 * c;
+                float const qc = b - tableSlope;
+
+                float roots[2];
+                int32_t numRoots = 0;
+                if ( Math::IsNearZero( qa ) )
+                {
+                    if ( !Math::IsNearZero( qb ) )
+                    {
+                        roots[numRoots++] = -qc / qb;
+                    }
+                }
+                else
+                {
+                    float const discriminant = qb * qb - 4 * qa * qc;
+                    if ( discriminant >= 0.0f )
+                    {
+                        float const sqrtDiscriminant = Math::Sqrt( discriminant );
+                        roots[numRoots++] = ( -qb + sqrtDiscriminant ) / ( 2 * qa );
+                        roots[numRoots++] = ( -qb - sqrtDiscriminant ) / ( 2 * qa );
+                    }
+                }
+
+                for ( int32_t r = 0; r < numRoots; r++ )
+                {
+                    float const parameter = start.m_parameter + roots[r] * segmentLength;
+                    if ( parameter > intervalStart && parameter < intervalEnd )
+                    {
+                        MeasureError( parameter );
+                    }
+                }
+            }
+        }
+    }
+
+    void BakedFloatCurve::Evaluate( float const* pParameters, float* pResults, uint32_t numParameters ) const
+    {
+        KRG_ASSERT( ( pParameters != nullptr && pResults != nullptr ) || numParameters == 0 );
+
+        for ( uint32_t i = 0; i < numParameters; i++ )
+        {
+            pResults[i] = Evaluate( pParameters[i] );
+        }
+    }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "Math.h"
+#include "Curves.h"
 #include "NumericRange.h"
 #include "System/Types/Arrays.h"
 #include "System/Types/String.h"
@@ -79,6 +80,9 @@ namespace KRG
         // If the parameter supplied is outside the parameter range the value returned will be that of the nearest extremity point
         float Evaluate( float parameter ) const;
 
+        // Evaluate the curve for a set of parameters, this is cheapest when the parameters are sorted (or mostly coherent) since we can reuse the previous segment
+        void Evaluate( float const* pParameters, float* pResults, uint32_t numParameters ) const;
+
         // Curve manipulation
         //-------------------------------------------------------------------------
 
@@ -115,6 +119,17 @@ namespace KRG
 
     private:
 
+        // Find the segment (the index of its start point) that contains the parameter, the parameter needs to be within the parameter range
+        int32_t FindSegment( float parameter ) const;
+
+        inline float EvaluateSegment( int32_t segmentIdx, float parameter ) const
+        {
+            Point const& start = m_points[segmentIdx];
+            Point const& end = m_points[segmentIdx + 1];
+            float const T = ( parameter - start.m_parameter ) / ( end.m_parameter - start.m_parameter );
+            return Math::CubicHermite::Evaluate( start.m_value, start.m_outTangent, end.m_value, end.m_inTangent, T );
+        }
+
         inline void SortPoints()
         {
             auto SortPredicate = [] ( Point const& a, Point const& b )
@@ -129,4 +144,49 @@ namespace KRG
 
         TInlineVector<Point, 8>     m_points; // Space for 4 curves
     };
+
+    //-------------------------------------------------------------------------
+    // Baked Curve
+    //-------------------------------------------------------------------------
+    // A uniformly sampled, linearly interpolated approximation of a float curve for hot evaluation paths
+    // Evaluation is a single table lookup, the max error versus the source curve is calculated exactly when baking
+
+    class KRG_SYSTEM_API BakedFloatCurve
+    {
+    public:
+
+        static constexpr int32_t const s_defaultNumSamples = 256;
+
+    public:
+
+        BakedFloatCurve() = default;
+        BakedFloatCurve( FloatCurve const& curve, int32_t numSamples = s_defaultNumSamples ) { Bake( curve, numSamples ); }
+
+        void Bake( FloatCurve const& curve, int32_t numSamples = s_defaultNumSamples );
+
+        inline bool IsBaked() const { return !m_samples.empty(); }
+
+        // The max absolute difference between this table and the source curve
+        inline float GetMaxError() const { return m_maxError; }
+
+        // Same clamping behavior as the source curve
+        inline float Evaluate( float parameter ) const
+        {
+            KRG_ASSERT( IsBaked() );
+            float const samplePosition = Math::Clamp( ( parameter - m_parameterStart ) * m_inverseSampleSpacing, 0.0f, m_lastSegmentIdx );
+            int32_t const sampleIdx = Math::Min( (int32_t) samplePosition, (int32_t) m_lastSegmentIdx - 1 );
+            float const T = samplePosition - sampleIdx;
+            return Math::Lerp( m_samples[sampleIdx], m_samples[sampleIdx + 1], T );
+        }
+
+        void Evaluate( float const* pParameters, float* pResults, uint32_t numParameters ) const;
+
+    private:
+
+        TVector<float>              m_samples;
+        float                       m_parameterStart = 0.0f;
+        float                       m_inverseSampleSpacing = 0.0f;
+        float                       m_lastSegmentIdx = 0.0f;    // Stored as a float to avoid a conversion per evaluation
+        float                       m_maxError = 0.0f;
+    };
 }
\ No newline at end of file
@@ -295,6 +295,8 @@ namespace KRG
         int32_t m_x, m_y;
     };
 
+    KRG_SERIALIZE_AS_PLAIN_DATA( Int2 );
+
     //-------------------------------------------------------------------------
 
     struct KRG_SYSTEM_API Int4
@@ -342,6 +344,8 @@ namespace KRG
         int32_t m_x, m_y, m_z, m_w;
     };
 
+    KRG_SERIALIZE_AS_PLAIN_DATA( Int4 );
+
     //-------------------------------------------------------------------------
 
     struct KRG_SYSTEM_API Float2
@@ -392,6 +396,8 @@ namespace KRG
         float m_x, m_y;
     };
 
+    KRG_SERIALIZE_AS_PLAIN_DATA( Float2 );
+
     //-------------------------------------------------------------------------
 
     struct KRG_SYSTEM_API Float3
@@ -448,6 +454,8 @@ namespace KRG
         float m_x, m_y, m_z;
     };
 
+    KRG_SERIALIZE_AS_PLAIN_DATA( Float3 );
+
     //-------------------------------------------------------------------------
 
     struct KRG_SYSTEM_API Float4
@@ -506,6 +514,8 @@ namespace KRG
         float m_x, m_y, m_z, m_w;
     };
 
+    KRG_SERIALIZE_AS_PLAIN_DATA( Float4 );
+
     // Implicit conversions
     //-------------------------------------------------------------------------
 
@@ -17,6 +17,26 @@ namespace KRG::Math
         KRG_ASSERT( seed != 0 );
     }
 
+    RNG::RNG( uint64_t seed, uint64_t streamID )
+        : m_rng( seed, streamID )
+    {
+        KRG_ASSERT( seed != 0 );
+    }
+
+    void RNG::Reseed( uint64_t seed, uint64_t streamID )
+    {
+        KRG_ASSERT( seed != 0 );
+        m_rng.seed( seed, streamID );
+    }
+
+    //-------------------------------------------------------------------------
+
+    RNG const& GetThreadRNG()
+    {
+        thread_local RNG const threadRNG;
+        return threadRNG;
+    }
+
     //-------------------------------------------------------------------------
 
     namespace
@@ -9,6 +9,8 @@
 namespace KRG::Math
 {
     // Non-threadsafe random number generator based on PCG
+    // RNGs created with the same seed but different stream IDs produce independent sequences,
+    // this allows us to give each thread/entity its own reproducible stream without any locking
     class KRG_SYSTEM_API RNG
     {
 
@@ -16,6 +18,10 @@ namespace KRG::Math
 
         RNG(); // Non-deterministic RNG
         RNG( uint32_t seed ); // Deterministic RNG
+        RNG( uint64_t seed, uint64_t streamID ); // Deterministic RNG, with a unique stream per stream ID
+
+        // Reset this RNG to the start of the specified stream
+        void Reseed( uint64_t seed, uint64_t streamID );
 
         inline uint32_t GetUInt( uint32_t min = 0, uint32_t max = 0xFFFFFFFF ) const
         {
@@ -33,12 +39,30 @@ namespace KRG::Math
             return min + ( ( max - min ) * (float) ldexp( m_rng(), -32 ) );
         }
 
+        inline bool GetBool() const
+        {
+            return ( m_rng() & 1 ) == 1;
+        }
+
+        inline int32_t GetInt( int32_t min = INT_MIN, int32_t max = INT_MAX ) const
+        {
+            KRG_ASSERT( max > min );
+            uint32_t const umax = uint32_t( int64_t( max ) - min );
+            int64_t const randomValue = GetUInt( 0, umax );
+            return static_cast<int32_t>( randomValue + min );
+        }
+
     private:
 
         mutable pcg32 m_rng;
     };
 
-    // Threadsafe global versions - Use in non-performance critical code
+    // Lock-free per-thread RNG - non-deterministic, each thread is seeded independently on first use
+    // Use this instead of the global functions below in any code that runs in parallel (e.g. entity updates)
+    // If you need reproducible results, use an RNG created from a known seed and stream ID (e.g. EntityWorldUpdateContext::GetRandomSeed() and a per-entity stream ID)
+    KRG_SYSTEM_API RNG const& GetThreadRNG();
+
+    // Threadsafe global versions - these all share a single lock, so use in non-performance critical code only
     //-------------------------------------------------------------------------
 
     // Get a random unsigned integer value between [min, max]
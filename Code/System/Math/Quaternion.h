@@ -115,6 +115,8 @@ namespace KRG
         };
     };
 
+    KRG_SERIALIZE_AS_PLAIN_DATA( Quaternion );
+
     static_assert( sizeof( Vector ) == 16, "Quaternion size must be 16 bytes!" );
 
     //-------------------------------------------------------------------------
@@ -417,6 +417,8 @@ namespace KRG
         };
     };
 
+    KRG_SERIALIZE_AS_PLAIN_DATA( Vector );
+
     //-------------------------------------------------------------------------
 
     static_assert( sizeof( Vector ) == 16, "Vector size must be 16 bytes!" );
@@ -0,0 +1,170 @@
+#include "VolumeOverlapTracker.h"
+#include "System/Profiling.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG::Math
+{
+    void VolumeOverlapTracker::AddVolume( uint64_t volumeID, AABB const& bounds )
+    {
+        KRG_ASSERT( volumeID != 0 && m_volumes.find( volumeID ) == m_volumes.end() );
+
+        Volume& volume = m_volumes[volumeID];
+        volume.m_bounds = bounds;
+        volume.m_inflatedBounds = GetInflatedBounds( bounds );
+        m_volumeTree.InsertBox( volume.m_inflatedBounds, volumeID );
+
+        m_numPendingTreeUpdates++;
+        m_volumesChanged = true;
+    }
+
+    void VolumeOverlapTracker::UpdateVolume( uint64_t volumeID, AABB const& bounds )
+    {
+        auto foundIter = m_volumes.find( volumeID );
+        KRG_ASSERT( foundIter != m_volumes.end() );
+
+        Volume& volume = foundIter->second;
+        volume.m_bounds = bounds;
+
+        // Only modify the tree if we have moved outside of the inflated bounds
+        bool const isContained = volume.m_inflatedBounds.GetMin().IsLessThanEqual3( bounds.GetMin() ) && bounds.GetMax().IsLessThanEqual3( volume.m_inflatedBounds.GetMax() );
+        if ( !isContained )
+        {
+            volume.m_inflatedBounds = GetInflatedBounds( bounds );
+            m_volumeTree.UpdateBox( volume.m_inflatedBounds, volumeID );
+            m_numPendingTreeUpdates++;
+        }
+
+        m_volumesChanged = true;
+    }
+
+    void VolumeOverlapTracker::RemoveVolume( uint64_t volumeID )
+    {
+        auto foundIter = m_volumes.find( volumeID );
+        KRG_ASSERT( foundIter != m_volumes.end() );
+        m_volumes.erase( foundIter );
+        m_volumeTree.RemoveBox( volumeID );
+
+        // Any existing overlaps will generate exit events on the next update since this volume will no longer be found
+        m_numPendingTreeUpdates++;
+        m_volumesChanged = true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    int32_t VolumeOverlapTracker::FindTriggererIndex( uint64_t triggererID ) const
+    {
+        return VectorFindIndex( m_triggerers, triggererID, [] ( Triggerer const& triggerer, uint64_t triggererID ) { return triggerer.m_ID == triggererID; } );
+    }
+
+    void VolumeOverlapTracker::AddTriggerer( uint64_t triggererID, AABB const& bounds )
+    {
+        KRG_ASSERT( triggererID != 0 && FindTriggererIndex( triggererID ) == InvalidIndex );
+
+        Triggerer& triggerer = m_triggerers.emplace_back();
+        triggerer.m_ID = triggererID;
+        triggerer.m_bounds = bounds;
+        triggerer.m_isDirty = true;
+    }
+
+    void VolumeOverlapTracker::UpdateTriggerer( uint64_t triggererID, AABB const& bounds )
+    {
+        int32_t const triggererIdx = FindTriggererIndex( triggererID );
+        KRG_ASSERT( triggererIdx != InvalidIndex );
+        m_triggerers[triggererIdx].m_bounds = bounds;
+        m_triggerers[triggererIdx].m_isDirty = true;
+    }
+
+    void VolumeOverlapTracker::RemoveTriggerer( uint64_t triggererID )
+    {
+        int32_t const triggererIdx = FindTriggererIndex( triggererID );
+        KRG_ASSERT( triggererIdx != InvalidIndex );
+
+        for ( uint64_t volumeID : m_triggerers[triggererIdx].m_overlappingVolumes )
+        {
+            m_pendingExitEvents.emplace_back( Event::Type::Exit, volumeID, triggererID );
+        }
+
+        m_triggerers.erase_unsorted( m_triggerers.begin() + triggererIdx );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void VolumeOverlapTracker::Update( NarrowPhaseFunction const& narrowPhaseFunction )
+    {
+        KRG_PROFILE_FUNCTION();
+
+        m_events.clear();
+        m_events.swap( m_pendingExitEvents );
+
+        //-------------------------------------------------------------------------
+
+        for ( Triggerer& triggerer : m_triggerers )
+        {
+            // Nothing has changed so all previous overlaps persist
+            if ( !triggerer.m_isDirty && !m_volumesChanged )
+            {
+                for ( uint64_t volumeID : triggerer.m_overlappingVolumes )
+                {
+                    m_events.emplace_back( Event::Type::Stay, volumeID, triggerer.m_ID );
+                }
+                continue;
+            }
+
+            // Broadphase query against the inflated bounds, then test against the actual bounds
+            m_newOverlaps.clear();
+            m_volumeTree.FindOverlaps( triggerer.m_bounds, m_candidates );
+            for ( uint64_t volumeID : m_candidates )
+            {
+                auto foundIter = m_volumes.find( volumeID );
+                KRG_ASSERT( foundIter != m_volumes.end() );
+                if ( !foundIter->second.m_bounds.Overlaps( triggerer.m_bounds ) )
+                {
+                    continue;
+                }
+
+                if ( narrowPhaseFunction != nullptr && !narrowPhaseFunction( volumeID, triggerer.m_ID ) )
+                {
+                    continue;
+                }
+
+                m_newOverlaps.emplace_back( volumeID );
+            }
+
+            eastl::sort( m_newOverlaps.begin(), m_newOverlaps.end() );
+
+            // Diff the sorted overlap sets
+            auto const& oldOverlaps = triggerer.m_overlappingVolumes;
+            size_t oldIdx = 0, newIdx = 0;
+            while ( oldIdx < oldOverlaps.size() || newIdx < m_newOverlaps.size() )
+            {
+                if ( newIdx == m_newOverlaps.size() || ( oldIdx < oldOverlaps.size() && oldOverlaps[oldIdx] < m_newOverlaps[newIdx] ) )
+                {
+                    m_events.emplace_back( Event::Type::Exit, oldOverlaps[oldIdx], triggerer.m_ID );
+                    oldIdx++;
+                }
+                else if ( oldIdx == oldOverlaps.size() || m_newOverlaps[newIdx] < oldOverlaps[oldIdx] )
+                {
+                    m_events.emplace_back( Event::Type::Enter, m_newOverlaps[newIdx], triggerer.m_ID );
+                    newIdx++;
+                }
+                else
+                {
+                    m_events.emplace_back( Event::Type::Stay, m_newOverlaps[newIdx], triggerer.m_ID );
+                    oldIdx++;
+                    newIdx++;
+                }
+            }
+
+            triggerer.m_overlappingVolumes.swap( m_newOverlaps );
+            triggerer.m_isDirty = false;
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_numTreeUpdates = m_numPendingTreeUpdates;
+        m_numPendingTreeUpdates = 0;
+        m_volumesChanged = false;
+    }
+}
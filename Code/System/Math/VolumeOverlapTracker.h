@@ -0,0 +1,117 @@
+#pragma once
+
+#include "System/Math/AABBTree.h"
+#include "System/Types/Function.h"
+
+//-------------------------------------------------------------------------
+// Volume Overlap Tracker
+//-------------------------------------------------------------------------
+// Tracks overlaps between a large set of (mostly static) volumes and a small set of moving triggerers
+// Volumes are stored in an AABB tree using slightly inflated bounds, so small movements do not require the tree to be modified
+// Each update generates an enter/stay/exit event for every changed/persisting overlap pair, events are only valid until the next update
+// Triggerers that have not moved since the last update reuse their previous results unless the volume set was modified
+
+namespace KRG::Math
+{
+    class KRG_SYSTEM_API VolumeOverlapTracker
+    {
+    public:
+
+        struct Event
+        {
+            enum class Type : uint8_t
+            {
+                Enter = 0,
+                Stay,
+                Exit,
+            };
+
+            Event() = default;
+            Event( Type type, uint64_t volumeID, uint64_t triggererID ) : m_volumeID( volumeID ), m_triggererID( triggererID ), m_type( type ) {}
+
+            uint64_t                        m_volumeID = 0;
+            uint64_t                        m_triggererID = 0;
+            Type                            m_type = Type::Enter;
+        };
+
+        // Optional narrow phase test, called for each broadphase candidate pair (volumeID, triggererID)
+        using NarrowPhaseFunction = TFunction<bool( uint64_t, uint64_t )>;
+
+    private:
+
+        struct Volume
+        {
+            AABB                            m_bounds;
+            AABB                            m_inflatedBounds;
+        };
+
+        struct Triggerer
+        {
+            uint64_t                        m_ID = 0;
+            AABB                            m_bounds;
+            TVector<uint64_t>               m_overlappingVolumes; // Sorted
+            bool                            m_isDirty = true;
+        };
+
+    public:
+
+        VolumeOverlapTracker( float boundsInflation = 0.25f ) : m_boundsInflation( boundsInflation ) { KRG_ASSERT( boundsInflation >= 0.0f ); }
+
+        // Volumes - all IDs must be non-zero and unique
+        //-------------------------------------------------------------------------
+
+        void AddVolume( uint64_t volumeID, AABB const& bounds );
+        void UpdateVolume( uint64_t volumeID, AABB const& bounds );
+        void RemoveVolume( uint64_t volumeID );
+        inline uint32_t GetNumVolumes() const { return (uint32_t) m_volumes.size(); }
+
+        // Triggerers - all IDs must be non-zero and unique
+        //-------------------------------------------------------------------------
+
+        void AddTriggerer( uint64_t triggererID, AABB const& bounds );
+        void UpdateTriggerer( uint64_t triggererID, AABB const& bounds );
+        void RemoveTriggerer( uint64_t triggererID );
+        inline uint32_t GetNumTriggerers() const { return (uint32_t) m_triggerers.size(); }
+
+        // Update
+        //-------------------------------------------------------------------------
+
+        // Recalculate all overlaps and generate the events for this update
+        void Update( NarrowPhaseFunction const& narrowPhaseFunction = nullptr );
+
+        // Get the events generated by the last update
+        inline TVector<Event> const& GetEvents() const { return m_events; }
+
+        // Get the number of broadphase tree modifications that occurred between the last two updates (useful to evaluate the inflation amount)
+        inline uint32_t GetNumTreeUpdates() const { return m_numTreeUpdates; }
+
+        #if KRG_DEVELOPMENT_TOOLS
+        inline void DrawDebug( Drawing::DrawContext& drawingContext ) const { m_volumeTree.DrawDebug( drawingContext ); }
+        #endif
+
+    private:
+
+        inline AABB GetInflatedBounds( AABB const& bounds ) const
+        {
+            AABB inflatedBounds = bounds;
+            inflatedBounds.Grow( Vector( m_boundsInflation ) );
+            return inflatedBounds;
+        }
+
+        int32_t FindTriggererIndex( uint64_t triggererID ) const;
+
+    private:
+
+        AABBTree                            m_volumeTree;
+        THashMap<uint64_t, Volume>          m_volumes;
+        TVector<Triggerer>                  m_triggerers;
+        TVector<Event>                      m_events;
+        TVector<Event>                      m_pendingExitEvents; // Exits for removed triggerers, emitted on the next update
+        TVector<uint64_t>                   m_candidates;
+        TVector<uint64_t>                   m_newOverlaps;
+        float                               m_boundsInflation = 0.25f;
+        uint32_t                            m_numTreeUpdates = 0;
+        uint32_t                            m_numPendingTreeUpdates = 0;
+        bool                                m_volumesChanged = false;
+    };
+}
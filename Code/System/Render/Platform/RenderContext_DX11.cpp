@@ -1,4 +1,5 @@
 #include "RenderContext_DX11.h"
+#if _WIN32 && !KRG_RENDER_NULL
 #include "System/Types/Color.h"
 
 //-------------------------------------------------------------------------
@@ -503,4 +504,6 @@ namespace KRG::Render
         auto pSwapChain = reinterpret_cast<IDXGISwapChain*>( window.m_pSwapChain );
         pSwapChain->Present( 0, 0 );
     }
-}
\ No newline at end of file
+}
+
+#endif
\ No newline at end of file
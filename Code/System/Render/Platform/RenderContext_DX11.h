@@ -1,5 +1,5 @@
 #pragma once
-#ifdef _WIN32
+#if _WIN32 && !KRG_RENDER_NULL
 
 #include "System/_Module/API.h"
 
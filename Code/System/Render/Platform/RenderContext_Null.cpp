@@ -0,0 +1,255 @@
+#include "RenderContext_Null.h"
+#if !_WIN32 || KRG_RENDER_NULL
+
+//-------------------------------------------------------------------------
+
+namespace KRG::Render
+{
+    void RenderCommandLog::Reset()
+    {
+        m_commands.clear();
+        Memory::MemsetZero( m_commandCounts, sizeof( m_commandCounts ) );
+        m_numVerticesSubmitted = 0;
+        m_numBytesWritten = 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    RenderContext::RenderContext( RenderCommandLog* pCommandLog )
+        : m_pCommandLog( pCommandLog )
+    {
+        KRG_ASSERT( m_pCommandLog != nullptr );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderContext::SetPipelineState( PipelineState const& pipelineState ) const
+    {
+        KRG_ASSERT( IsValid() );
+
+        RecordedCommand cmd( RecordedCommandType::SetPipelineState );
+        cmd.m_pResource = ( pipelineState.m_pVertexShader != nullptr ) ? pipelineState.m_pVertexShader->GetShaderHandle().m_pData : nullptr;
+        cmd.m_args[0] = ( pipelineState.m_pPixelShader != nullptr ) ? 1 : 0;
+        cmd.m_args[1] = ( pipelineState.m_pGeometryShader != nullptr ) ? 1 : 0;
+        cmd.m_args[2] = ( pipelineState.m_pComputeShader != nullptr ) ? 1 : 0;
+        m_pCommandLog->Record( cmd );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderContext::SetShaderInputBinding( ShaderInputBindingHandle const& inputBinding ) const
+    {
+        KRG_ASSERT( IsValid() );
+        m_pCommandLog->Record( RecordedCommand( RecordedCommandType::SetShaderInputBinding, inputBinding.m_pData ) );
+    }
+
+    void RenderContext::SetShaderResource( PipelineStage stage, uint32_t slot, ViewSRVHandle const& shaderResourceView ) const
+    {
+        KRG_ASSERT( IsValid() && stage != PipelineStage::None );
+        RecordedCommand cmd( RecordedCommandType::SetShaderResource, shaderResourceView.m_pData, stage );
+        cmd.m_args[0] = slot;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::ClearShaderResource( PipelineStage stage, uint32_t slot ) const
+    {
+        KRG_ASSERT( IsValid() && stage != PipelineStage::None );
+        RecordedCommand cmd( RecordedCommandType::ClearShaderResource, nullptr, stage );
+        cmd.m_args[0] = slot;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::SetUnorderedAccess( PipelineStage stage, uint32_t slot, ViewUAVHandle const& unorderedAccessView ) const
+    {
+        KRG_ASSERT( IsValid() && stage == PipelineStage::Compute );
+        RecordedCommand cmd( RecordedCommandType::SetUnorderedAccess, unorderedAccessView.m_pData, stage );
+        cmd.m_args[0] = slot;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::ClearUnorderedAccess( PipelineStage stage, uint32_t slot ) const
+    {
+        KRG_ASSERT( IsValid() && stage == PipelineStage::Compute );
+        RecordedCommand cmd( RecordedCommandType::ClearUnorderedAccess, nullptr, stage );
+        cmd.m_args[0] = slot;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::SetSampler( PipelineStage stage, uint32_t slot, SamplerState const& state ) const
+    {
+        KRG_ASSERT( IsValid() && stage != PipelineStage::None );
+        RecordedCommand cmd( RecordedCommandType::SetSampler, state.GetResourceHandle().m_pData, stage );
+        cmd.m_args[0] = slot;
+        m_pCommandLog->Record( cmd );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void* RenderContext::MapBuffer( RenderBuffer const& buffer ) const
+    {
+        KRG_ASSERT( IsValid() && buffer.IsValid() && buffer.m_usage == RenderBuffer::Usage::CPU_and_GPU );
+        auto pNullBuffer = reinterpret_cast<NullResource*>( buffer.GetResourceHandle().m_pData );
+        KRG_ASSERT( pNullBuffer->m_type == ResourceType::Buffer );
+        m_pCommandLog->Record( RecordedCommand( RecordedCommandType::MapBuffer, pNullBuffer ) );
+        return pNullBuffer->m_data.data();
+    }
+
+    void RenderContext::UnmapBuffer( RenderBuffer const& buffer ) const
+    {
+        KRG_ASSERT( IsValid() && buffer.IsValid() && buffer.m_usage == RenderBuffer::Usage::CPU_and_GPU );
+        m_pCommandLog->Record( RecordedCommand( RecordedCommandType::UnmapBuffer, buffer.GetResourceHandle().m_pData ) );
+    }
+
+    void RenderContext::WriteToBuffer( RenderBuffer const& buffer, void const* pData, size_t const dataSize ) const
+    {
+        KRG_ASSERT( IsValid() && buffer.IsValid() && buffer.m_usage == RenderBuffer::Usage::CPU_and_GPU );
+        KRG_ASSERT( pData != nullptr && buffer.m_byteSize >= dataSize );
+
+        // Write directly into the backing storage, a write is a single command (no map/unmap pair)
+        auto pNullBuffer = reinterpret_cast<NullResource*>( buffer.GetResourceHandle().m_pData );
+        KRG_ASSERT( pNullBuffer->m_type == ResourceType::Buffer );
+        memcpy( pNullBuffer->m_data.data(), pData, dataSize );
+
+        RecordedCommand cmd( RecordedCommandType::WriteToBuffer, pNullBuffer );
+        cmd.m_args[0] = (uint32_t) dataSize;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::SetVertexBuffer( RenderBuffer const& buffer, uint32_t offset ) const
+    {
+        KRG_ASSERT( IsValid() && buffer.IsValid() && buffer.m_type == RenderBuffer::Type::Vertex );
+        RecordedCommand cmd( RecordedCommandType::SetVertexBuffer, buffer.GetResourceHandle().m_pData );
+        cmd.m_args[0] = offset;
+        cmd.m_args[1] = buffer.m_byteStride;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::SetIndexBuffer( RenderBuffer const& buffer, uint32_t offset ) const
+    {
+        KRG_ASSERT( IsValid() && buffer.IsValid() && buffer.m_type == RenderBuffer::Type::Index );
+        RecordedCommand cmd( RecordedCommandType::SetIndexBuffer, buffer.GetResourceHandle().m_pData );
+        cmd.m_args[0] = offset;
+        cmd.m_args[1] = buffer.m_byteStride;
+        m_pCommandLog->Record( cmd );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderContext::SetViewport( Float2 dimensions, Float2 topLeft, Float2 rangeZ ) const
+    {
+        KRG_ASSERT( IsValid() );
+        RecordedCommand cmd( RecordedCommandType::SetViewport );
+        cmd.m_args[0] = (uint32_t) dimensions.m_x;
+        cmd.m_args[1] = (uint32_t) dimensions.m_y;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::SetDepthTestMode( DepthTestMode mode ) const
+    {
+        KRG_ASSERT( IsValid() );
+        RecordedCommand cmd( RecordedCommandType::SetDepthTestMode );
+        cmd.m_args[0] = (uint32_t) mode;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::SetRasterizerScissorRectangles( ScissorRect const* pScissorRects, uint32_t numRects ) const
+    {
+        KRG_ASSERT( IsValid() );
+        KRG_ASSERT( numRects == 0 || pScissorRects != nullptr );
+        RecordedCommand cmd( RecordedCommandType::SetScissorRects );
+        cmd.m_args[0] = numRects;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::SetBlendState( BlendState const& blendState ) const
+    {
+        KRG_ASSERT( IsValid() );
+        m_pCommandLog->Record( RecordedCommand( RecordedCommandType::SetBlendState, blendState.GetResourceHandle().m_pData ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderContext::SetRenderTarget( RenderTarget const& renderTarget ) const
+    {
+        KRG_ASSERT( IsValid() && renderTarget.IsValid() );
+        RecordedCommand cmd( RecordedCommandType::SetRenderTarget, renderTarget.GetRenderTargetHandle().m_pData );
+        cmd.m_args[0] = renderTarget.HasPickingRT() ? 2 : 1;
+        cmd.m_args[1] = renderTarget.HasDepthStencil() ? 1 : 0;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::SetRenderTarget( ViewDSHandle const& dsView ) const
+    {
+        KRG_ASSERT( IsValid() && dsView.IsValid() );
+        RecordedCommand cmd( RecordedCommandType::SetRenderTarget, dsView.m_pData );
+        cmd.m_args[1] = 1;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::SetRenderTarget( nullptr_t ) const
+    {
+        KRG_ASSERT( IsValid() );
+        m_pCommandLog->Record( RecordedCommand( RecordedCommandType::SetRenderTarget ) );
+    }
+
+    void RenderContext::ClearDepthStencilView( ViewDSHandle const& dsView, float depth, uint8_t stencil ) const
+    {
+        KRG_ASSERT( IsValid() && dsView.IsValid() );
+        RecordedCommand cmd( RecordedCommandType::ClearDepthStencilView, dsView.m_pData );
+        cmd.m_args[0] = stencil;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::ClearRenderTargetViews( RenderTarget const& renderTarget ) const
+    {
+        KRG_ASSERT( IsValid() && renderTarget.IsValid() );
+        m_pCommandLog->Record( RecordedCommand( RecordedCommandType::ClearRenderTargetViews, renderTarget.GetRenderTargetHandle().m_pData ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderContext::SetPrimitiveTopology( Topology topology ) const
+    {
+        KRG_ASSERT( IsValid() );
+        RecordedCommand cmd( RecordedCommandType::SetPrimitiveTopology );
+        cmd.m_args[0] = (uint32_t) topology;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::Draw( uint32_t vertexCount, uint32_t vertexStartIndex ) const
+    {
+        KRG_ASSERT( IsValid() );
+        RecordedCommand cmd( RecordedCommandType::Draw );
+        cmd.m_args[0] = vertexCount;
+        cmd.m_args[1] = vertexStartIndex;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::DrawIndexed( uint32_t vertexCount, uint32_t indexStartIndex, uint32_t vertexStartIndex ) const
+    {
+        KRG_ASSERT( IsValid() );
+        RecordedCommand cmd( RecordedCommandType::DrawIndexed );
+        cmd.m_args[0] = vertexCount;
+        cmd.m_args[1] = indexStartIndex;
+        cmd.m_args[2] = vertexStartIndex;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::Dispatch( uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ ) const
+    {
+        KRG_ASSERT( IsValid() );
+        RecordedCommand cmd( RecordedCommandType::Dispatch );
+        cmd.m_args[0] = numGroupsX;
+        cmd.m_args[1] = numGroupsY;
+        cmd.m_args[2] = numGroupsZ;
+        m_pCommandLog->Record( cmd );
+    }
+
+    void RenderContext::Present( RenderWindow& window ) const
+    {
+        KRG_ASSERT( IsValid() && window.IsValid() );
+        m_pCommandLog->Record( RecordedCommand( RecordedCommandType::Present, window.m_pSwapChain ) );
+    }
+}
+
+#endif
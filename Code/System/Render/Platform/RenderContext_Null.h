@@ -0,0 +1,202 @@
+#pragma once
+#if !_WIN32 || KRG_RENDER_NULL
+
+#include "System/_Module/API.h"
+
+#include "System/Render/RenderStates.h"
+#include "System/Render/RenderShader.h"
+#include "System/Render/RenderTexture.h"
+#include "System/Render/RenderBuffer.h"
+#include "System/Render/RenderTarget.h"
+#include "System/Render/RenderWindow.h"
+#include "System/Render/RenderPipelineState.h"
+
+//-------------------------------------------------------------------------
+// Null Render Backend
+//-------------------------------------------------------------------------
+// Implements the render device/context API without a GPU
+// All context calls are recorded into a command log that can be inspected (draw counts, bindings, buffer writes)
+// Used for headless servers and for measuring the CPU-side cost of the renderers
+
+namespace KRG::Render
+{
+    // Backing object for every resource handle created by the null device
+    struct NullResource
+    {
+        NullResource( ResourceType type ) : m_type( type ) {}
+
+        ResourceType                m_type = ResourceType::None;
+        Blob                        m_data; // CPU-side storage for buffers, so that map/write calls have somewhere to go
+    };
+
+    //-------------------------------------------------------------------------
+
+    enum class RecordedCommandType : uint8_t
+    {
+        SetPipelineState = 0,
+        SetShaderInputBinding,
+        SetShaderResource,
+        ClearShaderResource,
+        SetUnorderedAccess,
+        ClearUnorderedAccess,
+        SetSampler,
+        MapBuffer,
+        UnmapBuffer,
+        WriteToBuffer,
+        SetVertexBuffer,
+        SetIndexBuffer,
+        SetViewport,
+        SetDepthTestMode,
+        SetScissorRects,
+        SetBlendState,
+        SetRenderTarget,
+        ClearDepthStencilView,
+        ClearRenderTargetViews,
+        SetPrimitiveTopology,
+        Draw,
+        DrawIndexed,
+        Dispatch,
+        Present,
+
+        NumCommands,
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct RecordedCommand
+    {
+        RecordedCommand() = default;
+
+        RecordedCommand( RecordedCommandType type, void const* pResource = nullptr, PipelineStage stage = PipelineStage::None )
+            : m_pResource( pResource )
+            , m_type( type )
+            , m_stage( stage )
+        {}
+
+    public:
+
+        void const*                 m_pResource = nullptr;      // The null-backend object for the bound/written resource (if any)
+        uint32_t                    m_args[3] = { 0, 0, 0 };    // Command specific arguments (slot, counts, offsets, sizes...)
+        RecordedCommandType         m_type = RecordedCommandType::NumCommands;
+        PipelineStage               m_stage = PipelineStage::None;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class KRG_SYSTEM_API RenderCommandLog
+    {
+    public:
+
+        RenderCommandLog() { Reset(); }
+
+        // Clear all recorded commands and stats - call at the start of a capture
+        void Reset();
+
+        // Should we store the individual commands or only update the stats (useful for long running headless servers)
+        inline void SetRecordingEnabled( bool isEnabled ) { m_isRecordingEnabled = isEnabled; }
+        inline bool IsRecordingEnabled() const { return m_isRecordingEnabled; }
+
+        inline void Record( RecordedCommand const& command )
+        {
+            KRG_ASSERT( command.m_type < RecordedCommandType::NumCommands );
+            m_commandCounts[(uint8_t) command.m_type]++;
+
+            if ( command.m_type == RecordedCommandType::Draw || command.m_type == RecordedCommandType::DrawIndexed )
+            {
+                m_numVerticesSubmitted += command.m_args[0];
+            }
+            else if ( command.m_type == RecordedCommandType::WriteToBuffer )
+            {
+                m_numBytesWritten += command.m_args[0];
+            }
+
+            if ( m_isRecordingEnabled )
+            {
+                m_commands.emplace_back( command );
+            }
+        }
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        inline TVector<RecordedCommand> const& GetCommands() const { return m_commands; }
+        inline uint32_t GetCommandCount( RecordedCommandType type ) const { KRG_ASSERT( type < RecordedCommandType::NumCommands ); return m_commandCounts[(uint8_t) type]; }
+        inline uint32_t GetNumDrawCalls() const { return GetCommandCount( RecordedCommandType::Draw ) + GetCommandCount( RecordedCommandType::DrawIndexed ); }
+        inline uint64_t GetNumVerticesSubmitted() const { return m_numVerticesSubmitted; }
+        inline uint64_t GetNumBytesWritten() const { return m_numBytesWritten; }
+
+    private:
+
+        TVector<RecordedCommand>    m_commands;
+        uint32_t                    m_commandCounts[(uint8_t) RecordedCommandType::NumCommands];
+        uint64_t                    m_numVerticesSubmitted = 0;
+        uint64_t                    m_numBytesWritten = 0;
+        bool                        m_isRecordingEnabled = true;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class KRG_SYSTEM_API RenderContext
+    {
+        friend class RenderDevice;
+
+    public:
+
+        RenderContext() = default;
+
+        inline bool IsValid() const { return m_pCommandLog != nullptr; }
+
+        void SetPipelineState( PipelineState const& pipelineState ) const;
+
+        // Shaders
+        void SetShaderInputBinding( ShaderInputBindingHandle const& inputBinding ) const;
+        void SetShaderResource( PipelineStage stage, uint32_t slot, ViewSRVHandle const& shaderResourceView ) const;
+        void ClearShaderResource( PipelineStage stage, uint32_t slot ) const;
+        void SetUnorderedAccess( PipelineStage stage, uint32_t slot, ViewUAVHandle const& shaderResourceView ) const;
+        void ClearUnorderedAccess( PipelineStage stage, uint32_t slot ) const;
+        void SetSampler( PipelineStage stage, uint32_t slot, SamplerState const& state ) const;
+
+        // Buffers
+        void* MapBuffer( RenderBuffer const& buffer ) const;
+        void UnmapBuffer( RenderBuffer const& buffer ) const;
+        void WriteToBuffer( RenderBuffer const& buffer, void const* pData, size_t const dataSize ) const;
+        void SetVertexBuffer( RenderBuffer const& buffer, uint32_t offset = 0 ) const;
+        void SetIndexBuffer( RenderBuffer const& buffer, uint32_t offset = 0 ) const;
+
+        // Rasterizer
+        void SetViewport( Float2 dimensions, Float2 topLeft, Float2 zRange = Float2( 0, 1 ) ) const;
+        void SetDepthTestMode( DepthTestMode mode ) const;
+        void SetRasterizerScissorRectangles( ScissorRect const* pScissorRects, uint32_t numRects = 0 ) const;
+        void SetBlendState( BlendState const& blendState ) const;
+
+        // Render Targets
+        void SetRenderTarget( RenderTarget const& renderTarget ) const;
+        void SetRenderTarget( ViewDSHandle const& dsView ) const;
+        void SetRenderTarget( nullptr_t ) const;
+        void ClearDepthStencilView( ViewDSHandle const& dsView, float depth, uint8_t stencil ) const;
+        void ClearRenderTargetViews( RenderTarget const& renderTarget ) const;
+
+        // Drawing
+        void SetPrimitiveTopology( Topology topology ) const;
+        void Draw( uint32_t vertexCount, uint32_t vertexStartIndex = 0 ) const;
+        void DrawIndexed( uint32_t vertexCount, uint32_t indexStartIndex = 0, uint32_t vertexStartIndex = 0 ) const;
+
+        void Dispatch( uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ ) const;
+
+        // Window
+        void Present( RenderWindow& window ) const;
+
+        // Command log
+        inline RenderCommandLog const& GetCommandLog() const { KRG_ASSERT( IsValid() ); return *m_pCommandLog; }
+
+    private:
+
+        RenderContext( RenderCommandLog* pCommandLog );
+
+    private:
+
+        RenderCommandLog*           m_pCommandLog = nullptr;
+    };
+}
+
+#endif
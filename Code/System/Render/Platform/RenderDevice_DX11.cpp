@@ -1,4 +1,5 @@
 #include "RenderDevice_DX11.h"
+#if _WIN32 && !KRG_RENDER_NULL
 #include "TextureLoader_Win32.h"
 #include "System/Render/RenderDefaultResources.h"
 #include "System/ThirdParty/iniparser/krg_ini.h"
@@ -607,7 +608,9 @@ namespace KRG::Render
             DXGI_FORMAT_R32G32B32_FLOAT,
             DXGI_FORMAT_R32G32B32A32_FLOAT,
 
-            DXGI_FORMAT_R32_TYPELESS
+            DXGI_FORMAT_R32_TYPELESS,
+
+            DXGI_FORMAT_R16G16_SNORM
         };
 
         KRG_FORCE_INLINE static DXGI_FORMAT GetDXGIFormat( DataFormat format  )
@@ -663,7 +666,7 @@ namespace KRG::Render
                     D3D11_INPUT_ELEMENT_DESC elementDesc;
                     elementDesc.SemanticName = DX11::GetNameForSemantic( shaderVertexElementDesc.m_semantic );
                     elementDesc.SemanticIndex = shaderVertexElementDesc.m_semanticIndex;
-                    elementDesc.Format = DX11::GetDXGIFormat( shaderVertexElementDesc.m_format );
+                    elementDesc.Format = DX11::GetDXGIFormat( vertexElement.m_format ); // Use the buffer format, the input assembler will convert to the shader input type
                     elementDesc.InputSlot = 0;
                     elementDesc.AlignedByteOffset = vertexElement.m_offset;
                     elementDesc.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
@@ -1252,4 +1255,6 @@ namespace KRG::Render
 
         return pickingID;
     }
-}
\ No newline at end of file
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,369 @@
+#include "RenderDevice_Null.h"
+#if !_WIN32 || KRG_RENDER_NULL
+
+#include "System/Render/RenderDefaultResources.h"
+#include "System/ThirdParty/iniparser/krg_ini.h"
+#include "System/Profiling.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG::Render
+{
+    RenderDevice::~RenderDevice()
+    {
+        KRG_ASSERT( !m_immediateContext.IsValid() );
+        KRG_ASSERT( !m_primaryWindow.IsValid() );
+        KRG_ASSERT( !m_primaryWindow.m_renderTarget.IsValid() );
+        KRG_ASSERT( !m_isInitialized );
+    }
+
+    bool RenderDevice::IsInitialized() const
+    {
+        return m_isInitialized;
+    }
+
+    bool RenderDevice::Initialize( IniFile const& iniFile )
+    {
+        KRG_ASSERT( iniFile.IsValid() );
+
+        m_resolution.m_x = iniFile.GetIntOrDefault( "Render:ResolutionX", 1280 );
+        m_resolution.m_y = iniFile.GetIntOrDefault( "Render:ResolutionY", 720 );
+
+        //-------------------------------------------------------------------------
+
+        if ( m_resolution.m_x < 0 || m_resolution.m_y < 0 )
+        {
+            KRG_LOG_ERROR( "Render", "Invalid render settings read from ini file." );
+            return false;
+        }
+
+        return Initialize();
+    }
+
+    bool RenderDevice::Initialize()
+    {
+        KRG_ASSERT( !m_isInitialized );
+
+        m_commandLog.Reset();
+        m_immediateContext.m_pCommandLog = &m_commandLog;
+        m_isInitialized = true;
+
+        // Create primary window
+        m_primaryWindow.m_pSwapChain = KRG::New<NullResource>( ResourceType::RenderTarget );
+        CreateWindowRenderTarget( m_primaryWindow, m_resolution );
+
+        // Set OM default state
+        m_immediateContext.SetRenderTarget( m_primaryWindow.m_renderTarget );
+        m_immediateContext.ClearRenderTargetViews( m_primaryWindow.m_renderTarget );
+        m_immediateContext.SetDepthTestMode( DepthTestMode::On );
+
+        DefaultResources::Initialize( this );
+
+        return true;
+    }
+
+    void RenderDevice::Shutdown()
+    {
+        DefaultResources::Shutdown( this );
+
+        DestroyWindowRenderTarget( m_primaryWindow );
+        auto pSwapChain = reinterpret_cast<NullResource*>( m_primaryWindow.m_pSwapChain );
+        KRG::Delete( pSwapChain );
+        m_primaryWindow.m_pSwapChain = nullptr;
+
+        if ( m_numLiveResources != 0 )
+        {
+            KRG_LOG_WARNING( "Render", "Null render device shutdown with %u live resources!", m_numLiveResources );
+        }
+
+        m_immediateContext.m_pCommandLog = nullptr;
+        m_isInitialized = false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::PresentFrame()
+    {
+        KRG_PROFILE_FUNCTION_RENDER();
+
+        KRG_ASSERT( IsInitialized() );
+
+        m_immediateContext.Present( m_primaryWindow );
+        m_immediateContext.SetRenderTarget( m_primaryWindow.m_renderTarget );
+        m_immediateContext.ClearRenderTargetViews( m_primaryWindow.m_renderTarget );
+    }
+
+    void RenderDevice::ResizePrimaryWindowRenderTarget( Int2 const& dimensions )
+    {
+        KRG_ASSERT( dimensions.m_x > 0 && dimensions.m_y > 0 );
+        ResizeWindow( m_primaryWindow, dimensions );
+        m_immediateContext.SetRenderTarget( m_primaryWindow.m_renderTarget );
+        m_immediateContext.ClearRenderTargetViews( m_primaryWindow.m_renderTarget );
+        m_resolution = dimensions;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateSecondaryRenderWindow( RenderWindow& window, void* platformWindowHandle )
+    {
+        KRG_ASSERT( IsInitialized() && !window.IsValid() );
+        window.m_pSwapChain = KRG::New<NullResource>( ResourceType::RenderTarget );
+        CreateWindowRenderTarget( window, m_resolution );
+    }
+
+    void RenderDevice::DestroySecondaryRenderWindow( RenderWindow& window )
+    {
+        KRG_ASSERT( window.IsValid() );
+        DestroyWindowRenderTarget( window );
+
+        auto pSwapChain = reinterpret_cast<NullResource*>( window.m_pSwapChain );
+        KRG::Delete( pSwapChain );
+        window.m_pSwapChain = nullptr;
+    }
+
+    void RenderDevice::CreateWindowRenderTarget( RenderWindow& window, Int2 dimensions )
+    {
+        KRG_ASSERT( window.m_pSwapChain != nullptr );
+        CreateRenderTarget( window.m_renderTarget, dimensions );
+    }
+
+    void RenderDevice::DestroyWindowRenderTarget( RenderWindow& window )
+    {
+        if ( window.m_renderTarget.IsValid() )
+        {
+            DestroyRenderTarget( window.m_renderTarget );
+        }
+    }
+
+    void RenderDevice::ResizeWindow( RenderWindow& window, Int2 const& dimensions )
+    {
+        KRG_ASSERT( window.IsValid() );
+        m_immediateContext.SetRenderTarget( nullptr );
+        DestroyWindowRenderTarget( window );
+        CreateWindowRenderTarget( window, dimensions );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateShader( Shader& shader )
+    {
+        KRG_ASSERT( IsInitialized() && !shader.IsValid() );
+        KRG_ASSERT( shader.GetPipelineStage() != PipelineStage::None );
+
+        CreateNullResource( shader.m_shaderHandle );
+
+        for ( auto& cbuffer : shader.m_cbuffers )
+        {
+            CreateBuffer( cbuffer );
+            KRG_ASSERT( cbuffer.IsValid() );
+        }
+    }
+
+    void RenderDevice::DestroyShader( Shader& shader )
+    {
+        KRG_ASSERT( IsInitialized() && shader.IsValid() );
+
+        DestroyNullResource( shader.m_shaderHandle );
+
+        for ( auto& cbuffer : shader.m_cbuffers )
+        {
+            DestroyBuffer( cbuffer );
+        }
+        shader.m_cbuffers.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateBuffer( RenderBuffer& buffer, void const* pInitializationData )
+    {
+        KRG_ASSERT( IsInitialized() && !buffer.IsValid() );
+        KRG_ASSERT( buffer.m_type != RenderBuffer::Type::Unknown );
+        KRG_ASSERT( buffer.m_type != RenderBuffer::Type::Index || buffer.m_byteStride == 2 || buffer.m_byteStride == 4 ); // only 16/32 bit indices support
+
+        CreateNullResource( buffer.m_resourceHandle );
+
+        // Only dynamic buffers need CPU-side storage since they are the only ones that can be mapped
+        if ( buffer.m_usage == RenderBuffer::Usage::CPU_and_GPU )
+        {
+            auto pNullBuffer = reinterpret_cast<NullResource*>( buffer.m_resourceHandle.m_pData );
+            pNullBuffer->m_data.resize( buffer.m_byteSize );
+
+            if ( pInitializationData != nullptr )
+            {
+                memcpy( pNullBuffer->m_data.data(), pInitializationData, buffer.m_byteSize );
+            }
+        }
+    }
+
+    void RenderDevice::ResizeBuffer( RenderBuffer& buffer, uint32_t newSize )
+    {
+        KRG_ASSERT( buffer.IsValid() && newSize % buffer.m_byteStride == 0 );
+        DestroyNullResource( buffer.m_resourceHandle );
+        buffer.m_byteSize = newSize;
+        CreateBuffer( buffer );
+    }
+
+    void RenderDevice::DestroyBuffer( RenderBuffer& buffer )
+    {
+        KRG_ASSERT( IsInitialized() );
+
+        if ( buffer.IsValid() )
+        {
+            DestroyNullResource( buffer.m_resourceHandle );
+            buffer = RenderBuffer();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateShaderInputBinding( VertexShader const& shader, VertexLayoutDescriptor const& vertexLayoutDesc, ShaderInputBindingHandle& inputBinding )
+    {
+        KRG_ASSERT( IsInitialized() && shader.IsValid() && vertexLayoutDesc.IsValid() );
+        CreateNullResource( inputBinding );
+    }
+
+    void RenderDevice::DestroyShaderInputBinding( ShaderInputBindingHandle& inputBinding )
+    {
+        KRG_ASSERT( IsInitialized() && inputBinding.IsValid() );
+        DestroyNullResource( inputBinding );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateRasterizerState( RasterizerState& state )
+    {
+        KRG_ASSERT( IsInitialized() && !state.IsValid() );
+        CreateNullResource( state.m_resourceHandle );
+    }
+
+    void RenderDevice::DestroyRasterizerState( RasterizerState& state )
+    {
+        KRG_ASSERT( IsInitialized() && state.IsValid() );
+        DestroyNullResource( state.m_resourceHandle );
+    }
+
+    void RenderDevice::CreateBlendState( BlendState& state )
+    {
+        KRG_ASSERT( IsInitialized() && !state.IsValid() );
+        CreateNullResource( state.m_resourceHandle );
+    }
+
+    void RenderDevice::DestroyBlendState( BlendState& state )
+    {
+        KRG_ASSERT( IsInitialized() && state.IsValid() );
+        DestroyNullResource( state.m_resourceHandle );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateDataTexture( Texture& texture, TextureFormat format, uint8_t const* pRawData, size_t rawDataSize )
+    {
+        KRG_ASSERT( IsInitialized() && !texture.IsValid() );
+        KRG_ASSERT( pRawData != nullptr && rawDataSize > 0 );
+
+        // We dont decode the data, so we have no idea about the real dimensions
+        CreateNullResource( texture.m_textureHandle );
+        CreateNullResource( texture.m_shaderResourceView );
+        texture.m_dimensions = Int2( 1, 1 );
+    }
+
+    void RenderDevice::CreateTexture( Texture& texture, DataFormat format, Int2 dimensions, uint32_t usage )
+    {
+        KRG_ASSERT( IsInitialized() && !texture.IsValid() );
+
+        texture.m_dimensions = dimensions;
+        CreateNullResource( texture.m_textureHandle );
+
+        if ( usage & USAGE_SRV )
+        {
+            CreateNullResource( texture.m_shaderResourceView );
+        }
+
+        if ( usage & USAGE_UAV )
+        {
+            CreateNullResource( texture.m_unorderedAccessView );
+        }
+
+        if ( usage & USAGE_RT_DS )
+        {
+            if ( format == DataFormat::Float_X32 )
+            {
+                CreateNullResource( texture.m_depthStencilView );
+            }
+            else
+            {
+                CreateNullResource( texture.m_renderTargetView );
+            }
+        }
+    }
+
+    void RenderDevice::DestroyTexture( Texture& texture )
+    {
+        KRG_ASSERT( IsInitialized() && texture.IsValid() );
+        DestroyNullResource( texture.m_textureHandle );
+        DestroyNullResource( texture.m_shaderResourceView );
+        DestroyNullResource( texture.m_unorderedAccessView );
+        DestroyNullResource( texture.m_renderTargetView );
+        DestroyNullResource( texture.m_depthStencilView );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateSamplerState( SamplerState& state )
+    {
+        KRG_ASSERT( IsInitialized() );
+        CreateNullResource( state.m_resourceHandle );
+    }
+
+    void RenderDevice::DestroySamplerState( SamplerState& state )
+    {
+        KRG_ASSERT( IsInitialized() && state.IsValid() );
+        DestroyNullResource( state.m_resourceHandle );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateRenderTarget( RenderTarget& renderTarget, Int2 const& dimensions, bool createPickingTarget )
+    {
+        KRG_ASSERT( IsInitialized() && !renderTarget.IsValid() );
+        KRG_ASSERT( dimensions.m_x >= 0 && dimensions.m_y >= 0 );
+        CreateTexture( renderTarget.m_RT, DataFormat::UNorm_R8G8B8A8, dimensions, USAGE_SRV | USAGE_RT_DS );
+        CreateTexture( renderTarget.m_DS, DataFormat::Float_X32, dimensions, USAGE_RT_DS );
+
+        if ( createPickingTarget )
+        {
+            CreateTexture( renderTarget.m_pickingRT, DataFormat::UInt_R32G32B32A32, dimensions, USAGE_SRV | USAGE_RT_DS );
+            CreateTexture( renderTarget.m_pickingStagingTexture, DataFormat::UInt_R32G32B32A32, Int2( 1, 1 ), USAGE_STAGING );
+        }
+    }
+
+    void RenderDevice::ResizeRenderTarget( RenderTarget& renderTarget, Int2 const& newDimensions )
+    {
+        KRG_ASSERT( IsInitialized() && renderTarget.IsValid() );
+        bool const createPickingRT = renderTarget.HasPickingRT();
+        DestroyRenderTarget( renderTarget );
+        CreateRenderTarget( renderTarget, newDimensions, createPickingRT );
+    }
+
+    void RenderDevice::DestroyRenderTarget( RenderTarget& renderTarget )
+    {
+        KRG_ASSERT( IsInitialized() && renderTarget.IsValid() );
+        DestroyTexture( renderTarget.m_RT );
+        DestroyTexture( renderTarget.m_DS );
+
+        if ( renderTarget.m_pickingRT.IsValid() )
+        {
+            DestroyTexture( renderTarget.m_pickingRT );
+            DestroyTexture( renderTarget.m_pickingStagingTexture );
+        }
+    }
+
+    PickingID RenderDevice::ReadBackPickingID( RenderTarget const& renderTarget, Int2 const& pixelCoords )
+    {
+        KRG_ASSERT( IsInitialized() && renderTarget.IsValid() );
+        return PickingID();
+    }
+}
+
+#endif
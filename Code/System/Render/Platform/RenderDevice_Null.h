@@ -0,0 +1,146 @@
+#pragma once
+#if !_WIN32 || KRG_RENDER_NULL
+
+#include "RenderContext_Null.h"
+#include "System/Types/Color.h"
+#include "System/Threading/Threading.h"
+
+//-------------------------------------------------------------------------
+
+namespace KRG { class IniFile; }
+
+//-------------------------------------------------------------------------
+// Null Render Device
+//-------------------------------------------------------------------------
+// Creates CPU-only backing objects for all resources, nothing is ever sent to a GPU
+// The immediate context records into the device's command log
+
+namespace KRG::Render
+{
+    class KRG_SYSTEM_API RenderDevice
+    {
+
+    public:
+
+        RenderDevice() = default;
+        ~RenderDevice();
+
+        //-------------------------------------------------------------------------
+
+        bool IsInitialized() const;
+        bool Initialize( IniFile const& iniFile );
+        bool Initialize();
+        void Shutdown();
+
+        inline RenderContext const& GetImmediateContext() const { return m_immediateContext; }
+        void PresentFrame();
+
+        // Command log for the immediate context
+        inline RenderCommandLog& GetCommandLog() { return m_commandLog; }
+        inline RenderCommandLog const& GetCommandLog() const { return m_commandLog; }
+
+        // Number of live resources created through this device
+        inline uint32_t GetNumLiveResources() const { return m_numLiveResources; }
+
+        // Device locking: required since we create/destroy resources while rendering
+        //-------------------------------------------------------------------------
+
+        void LockDevice() { m_deviceMutex.lock(); }
+        void UnlockDevice() { m_deviceMutex.unlock(); }
+
+        // Swap Chains
+        //-------------------------------------------------------------------------
+
+        RenderTarget const* GetPrimaryWindowRenderTarget() const { return &m_primaryWindow.m_renderTarget; }
+        RenderTarget* GetPrimaryWindowRenderTarget() { return &m_primaryWindow.m_renderTarget; }
+        inline Int2 GetPrimaryWindowDimensions() const { return m_resolution; }
+
+        void CreateSecondaryRenderWindow( RenderWindow& window, void* platformWindowHandle );
+        void DestroySecondaryRenderWindow( RenderWindow& window );
+
+        void ResizeWindow( RenderWindow& window, Int2 const& dimensions );
+        void ResizePrimaryWindowRenderTarget( Int2 const& dimensions );
+
+        // Resource and state management
+        //-------------------------------------------------------------------------
+
+        // Shaders
+        void CreateShader( Shader& shader );
+        void DestroyShader( Shader& shader );
+
+        // Buffers
+        void CreateBuffer( RenderBuffer& buffer, void const* pInitializationData = nullptr );
+        void ResizeBuffer( RenderBuffer& buffer, uint32_t newSize );
+        void DestroyBuffer( RenderBuffer& buffer );
+
+        // Vertex shader input mappings
+        void CreateShaderInputBinding( VertexShader const& shader, VertexLayoutDescriptor const& vertexLayoutDesc, ShaderInputBindingHandle& inputBinding );
+        void DestroyShaderInputBinding( ShaderInputBindingHandle& inputBinding );
+
+        // Rasterizer
+        void CreateRasterizerState( RasterizerState& stateDesc );
+        void DestroyRasterizerState( RasterizerState& state );
+
+        void CreateBlendState( BlendState& stateDesc );
+        void DestroyBlendState( BlendState& state );
+
+        // Textures and Sampling
+        void CreateDataTexture( Texture& texture, TextureFormat format, uint8_t const* rawData, size_t size );
+        inline void CreateDataTexture( Texture& texture, TextureFormat format, Blob const& rawData ) { CreateDataTexture( texture, format, rawData.data(), rawData.size() ); }
+        void CreateTexture( Texture& texture, DataFormat format, Int2 dimensions, uint32_t usage );
+        void DestroyTexture( Texture& texture );
+
+        void CreateSamplerState( SamplerState& state );
+        void DestroySamplerState( SamplerState& state );
+
+        // Render Targets
+        void CreateRenderTarget( RenderTarget& renderTarget, Int2 const& dimensions, bool createPickingTarget = false );
+        void ResizeRenderTarget( RenderTarget& renderTarget, Int2 const& newDimensions );
+        void DestroyRenderTarget( RenderTarget& renderTarget );
+
+        // Picking - there is nothing rendered so this never returns a valid ID
+        PickingID ReadBackPickingID( RenderTarget const& renderTarget, Int2 const& pixelCoords );
+
+    private:
+
+        template<ResourceType T>
+        void CreateNullResource( ObjectHandle<T>& handle )
+        {
+            KRG_ASSERT( !handle.IsValid() );
+            handle.m_pData = KRG::New<NullResource>( T );
+            m_numLiveResources++;
+        }
+
+        template<ResourceType T>
+        void DestroyNullResource( ObjectHandle<T>& handle )
+        {
+            if ( handle.IsValid() )
+            {
+                auto pNullResource = reinterpret_cast<NullResource*>( handle.m_pData );
+                KRG_ASSERT( pNullResource->m_type == T );
+                KRG::Delete( pNullResource );
+                handle.Reset();
+
+                KRG_ASSERT( m_numLiveResources > 0 );
+                m_numLiveResources--;
+            }
+        }
+
+        void CreateWindowRenderTarget( RenderWindow& renderWindow, Int2 dimensions );
+        void DestroyWindowRenderTarget( RenderWindow& renderWindow );
+
+    private:
+
+        Int2                        m_resolution = Int2( 1280, 720 );
+        RenderWindow                m_primaryWindow;
+        RenderContext               m_immediateContext;
+        RenderCommandLog            m_commandLog;
+        uint32_t                    m_numLiveResources = 0;
+        bool                        m_isInitialized = false;
+
+        // Lock to allow loading resources while rendering across different threads
+        Threading::RecursiveMutex   m_deviceMutex;
+    };
+}
+
+#endif
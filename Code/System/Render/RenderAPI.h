@@ -53,6 +53,9 @@ namespace KRG::Render
         // Special case format that changes based on texture usage
         Float_X32,
 
+        // Added formats need to go at the end since the values are serialized
+        SNorm_R16G16,
+
         Count,
     };
 
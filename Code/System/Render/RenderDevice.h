@@ -4,8 +4,11 @@
 
 #include "RenderAPI.h"
 
-#ifdef _WIN32
+//-------------------------------------------------------------------------
+// Define KRG_RENDER_NULL (msbuild /p:KRG_RENDER_NULL=true) to use the recording (no GPU) backend on windows, it is always used on other platforms
+
+#if _WIN32 && !KRG_RENDER_NULL
 #include "Platform/RenderDevice_DX11.h"
 #else
-#error 
+#include "Platform/RenderDevice_Null.h"
 #endif
\ No newline at end of file
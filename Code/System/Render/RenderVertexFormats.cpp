@@ -1,4 +1,5 @@
 #include "RenderVertexFormats.h"
+#include "System/Math/Vector.h"
 
 //-------------------------------------------------------------------------
 
@@ -35,6 +36,8 @@ namespace KRG::Render
         12,
         16,
 
+        4,
+
         4
     };
 
@@ -50,6 +53,92 @@ namespace KRG::Render
 
     //-------------------------------------------------------------------------
 
+    void EncodeOctahedralNormal( Float3 const& normal, int16_t encodedNormal[2] )
+    {
+        // Project onto the octahedron and then fold the lower hemisphere over the diagonals
+        float const invL1Norm = 1.0f / ( Math::Abs( normal.m_x ) + Math::Abs( normal.m_y ) + Math::Abs( normal.m_z ) );
+        float x = normal.m_x * invL1Norm;
+        float y = normal.m_y * invL1Norm;
+
+        if ( normal.m_z < 0.0f )
+        {
+            float const foldedX = ( 1.0f - Math::Abs( y ) ) * ( x >= 0.0f ? 1.0f : -1.0f );
+            float const foldedY = ( 1.0f - Math::Abs( x ) ) * ( y >= 0.0f ? 1.0f : -1.0f );
+            x = foldedX;
+            y = foldedY;
+        }
+
+        encodedNormal[0] = (int16_t) Math::RoundToInt( Math::Clamp( x, -1.0f, 1.0f ) * 32767.0f );
+        encodedNormal[1] = (int16_t) Math::RoundToInt( Math::Clamp( y, -1.0f, 1.0f ) * 32767.0f );
+    }
+
+    Float3 DecodeOctahedralNormal( int16_t const encodedNormal[2] )
+    {
+        float const x = Math::Max( encodedNormal[0] / 32767.0f, -1.0f );
+        float const y = Math::Max( encodedNormal[1] / 32767.0f, -1.0f );
+
+        Vector normal( x, y, 1.0f - Math::Abs( x ) - Math::Abs( y ), 0.0f );
+        float const t = Math::Max( -normal.m_z, 0.0f );
+        normal.m_x += ( normal.m_x >= 0.0f ) ? -t : t;
+        normal.m_y += ( normal.m_y >= 0.0f ) ? -t : t;
+        return normal.GetNormalized3().ToFloat3();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CalculateBoneVertexBounds( SkeletalMeshVertex const* pVertices, uint32_t numVertices, uint32_t numBones, TVector<AABB>& outBoneVertexBounds )
+    {
+        outBoneVertexBounds.resize( numBones );
+        for ( auto& bounds : outBoneVertexBounds )
+        {
+            bounds.Reset();
+        }
+
+        for ( uint32_t v = 0; v < numVertices; v++ )
+        {
+            auto const& vertex = pVertices[v];
+            Vector const position( vertex.m_position );
+
+            for ( auto i = 0; i < 4; i++ )
+            {
+                if ( vertex.m_boneWeights[i] == 0 )
+                {
+                    continue;
+                }
+
+                KRG_ASSERT( vertex.m_boneIndices[i] < numBones );
+                AABB& bounds = outBoneVertexBounds[vertex.m_boneIndices[i]];
+                if ( bounds.IsValid() )
+                {
+                    bounds.AddPoint( position );
+                }
+                else
+                {
+                    bounds = AABB( position );
+                }
+            }
+        }
+    }
+
+    Vector CalculateSkinnedVertexPosition( SkeletalMeshVertex const& vertex, Matrix const* pSkinningTransforms )
+    {
+        Vector const position( vertex.m_position );
+
+        Vector skinnedPosition = Vector::Zero;
+        for ( auto i = 0; i < 4; i++ )
+        {
+            if ( vertex.m_boneWeights[i] > 0 )
+            {
+                Vector const weight( vertex.m_boneWeights[i] / 255.0f );
+                skinnedPosition = Vector::MultiplyAdd( pSkinningTransforms[vertex.m_boneIndices[i]].TransformPoint( position ), weight, skinnedPosition );
+            }
+        }
+
+        return skinnedPosition;
+    }
+
+    //-------------------------------------------------------------------------
+
     void VertexLayoutDescriptor::CalculateByteSize()
     {
         m_byteSize = 0;
@@ -71,21 +160,20 @@ namespace KRG::Render
 
             if ( format == VertexFormat::StaticMesh )
             {
-                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Position, DataFormat::Float_R32G32B32A32, 0, 0 ) );
-                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Normal, DataFormat::Float_R32G32B32A32, 0, 16 ) );
-                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R32G32, 0, 32 ) );
-                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R32G32, 1, 40 ) );
-
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Position, DataFormat::Float_R32G32B32, 0, 0 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Normal, DataFormat::SNorm_R16G16, 0, 12 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 0, 16 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 1, 20 ) );
             }
             else if ( format == VertexFormat::SkeletalMesh )
             {
-                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Position, DataFormat::Float_R32G32B32A32, 0, 0 ) );
-                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Normal, DataFormat::Float_R32G32B32A32, 0, 16 ) );
-                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R32G32, 0, 32 ) );
-                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R32G32, 1, 40 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Position, DataFormat::Float_R32G32B32, 0, 0 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Normal, DataFormat::SNorm_R16G16, 0, 12 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 0, 16 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 1, 20 ) );
 
-                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendIndex, DataFormat::SInt_R32G32B32A32, 0, 48 ) );
-                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendWeight, DataFormat::Float_R32G32B32A32, 0, 64 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendIndex, DataFormat::UInt_R8G8B8A8, 0, 24 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendWeight, DataFormat::UNorm_R8G8B8A8, 0, 28 ) );
             }
 
             //-------------------------------------------------------------------------
@@ -5,6 +5,7 @@
 #include "System/Serialization/BinarySerialization.h"
 #include "System/Types/Arrays.h"
 #include "System/Math/Math.h"
+#include "System/Math/BoundingVolumes.h"
 
 //-------------------------------------------------------------------------
 
@@ -23,21 +24,37 @@ namespace KRG::Render
     };
 
     // CPU format for the static mesh vertex - this is what the mesh compiler fills the vertex data array with
+    // Normals are octahedral encoded (snorm16) and UVs are stored as half floats
     struct StaticMeshVertex
     {
-        Float4  m_position;
-        Float4  m_normal;
-        Float2  m_UV0;
-        Float2  m_UV1;
+        Float3      m_position;
+        int16_t     m_normal[2];
+        uint16_t    m_UV0[2];
+        uint16_t    m_UV1[2];
     };
 
+    static_assert( sizeof( StaticMeshVertex ) == 24, "Unexpected static mesh vertex size, update the vertex layout registry" );
+
     // CPU format for the skeletal mesh vertex - this is what the mesh compiler fills the vertex data array with
+    // Unused influences have a zero weight, weights are unorm8 and always sum to 255
     struct SkeletalMeshVertex : public StaticMeshVertex
     {
-        Int4    m_boneIndices;
-        Float4  m_boneWeights;
+        uint8_t     m_boneIndices[4];
+        uint8_t     m_boneWeights[4];
     };
 
+    static_assert( sizeof( SkeletalMeshVertex ) == 32, "Unexpected skeletal mesh vertex size, update the vertex layout registry" );
+
+    // Octahedral normal encoding - the normal needs to be normalized
+    KRG_SYSTEM_API void EncodeOctahedralNormal( Float3 const& normal, int16_t encodedNormal[2] );
+    KRG_SYSTEM_API Float3 DecodeOctahedralNormal( int16_t const encodedNormal[2] );
+
+    // Calculate the bind space bounds of all the vertices influenced by each bone, bones without any influenced vertices get invalid bounds
+    KRG_SYSTEM_API void CalculateBoneVertexBounds( SkeletalMeshVertex const* pVertices, uint32_t numVertices, uint32_t numBones, TVector<AABB>& outBoneVertexBounds );
+
+    // CPU skin a vertex position with the same quantized weights as the GPU
+    KRG_SYSTEM_API Vector CalculateSkinnedVertexPosition( SkeletalMeshVertex const& vertex, Matrix const* pSkinningTransforms );
+
     //-------------------------------------------------------------------------
 
     struct KRG_SYSTEM_API VertexLayoutDescriptor
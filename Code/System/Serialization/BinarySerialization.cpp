@@ -137,6 +137,24 @@ namespace KRG::Serialization
         mpack_done_str( m_pReader );
     }
 
+    void BinaryReader::ReadBytes( void* pDestination, size_t expectedSize )
+    {
+        size_t const size = mpack_expect_bin( m_pReader );
+        if ( size != expectedSize )
+        {
+            mpack_reader_flag_error( m_pReader, mpack_error_invalid );
+            return;
+        }
+
+        if ( size > 0 )
+        {
+            KRG_ASSERT( pDestination != nullptr );
+            mpack_read_bytes( m_pReader, (char*) pDestination, size );
+        }
+
+        mpack_done_bin( m_pReader );
+    }
+
     //-------------------------------------------------------------------------
 
     static void MPackWriterError( mpack_writer_t* pWriter, mpack_error_t error )
@@ -238,6 +256,13 @@ namespace KRG::Serialization
         mpack_write_bin( m_pWriter, (char*) blob.data(), (uint32_t) blob.size() );
     }
 
+    void BinaryWriter::WriteBytes( void const* pSource, size_t size )
+    {
+        KRG_ASSERT( size == 0 || pSource != nullptr );
+        KRG_ASSERT( size <= UINT32_MAX );
+        mpack_write_bin( m_pWriter, (char const*) pSource, (uint32_t) size );
+    }
+
     void BinaryWriter::WriteValue( String const& v )
     {
         mpack_write_cstr_or_nil( m_pWriter, v.c_str() );
@@ -15,6 +15,16 @@ namespace KRG::FileSystem { class Path; }
 
 namespace KRG::Serialization
 {
+    //-------------------------------------------------------------------------
+    // Plain Data Types
+    //-------------------------------------------------------------------------
+    // Arrays of plain data types are serialized as a single raw block of memory rather than element by element
+    // This is the case for all numeric types (except bool) and enums, other types can opt in via KRG_SERIALIZE_AS_PLAIN_DATA (declared in the KRG namespace)
+    // NOTE: The in-memory layout is written as is, so only opt in types whose layout is identical on all target platforms
+
+    template<typename T>
+    struct IsPlainDataType : std::bool_constant<( std::is_arithmetic<T>::value && !std::is_same<T, bool>::value ) || std::is_enum<T>::value> {};
+
     //-------------------------------------------------------------------------
     // Binary Reader/Writer
     //-------------------------------------------------------------------------
@@ -48,6 +58,9 @@ namespace KRG::Serialization
         void ReadValue( String& v );
         void ReadValue( StringID& v);
 
+        // Read a raw block of memory, the size of the block is validated against the expected size
+        void ReadBytes( void* pDestination, size_t expectedSize );
+
     private:
 
         mpack_reader_t* m_pReader = nullptr;
@@ -85,6 +98,9 @@ namespace KRG::Serialization
         void WriteValue( String const& v );
         void WriteValue( StringID const& v );
 
+        // Write a raw block of memory
+        void WriteBytes( void const* pSource, size_t size );
+
     private:
 
         mpack_writer_t*     m_pWriter = nullptr;
@@ -191,11 +207,7 @@ namespace KRG::Serialization
                 }
 
                 // Serialize elements
-                for ( auto i = 0u; i < size; i++ )
-                {
-                    operator<<( pArrayData[i] );
-                }
-
+                SerializeElements( pArrayData, size );
                 return *this;
             }
 
@@ -232,11 +244,7 @@ namespace KRG::Serialization
                 }
 
                 // Serialize elements
-                for ( auto i = 0u; i < size; i++ )
-                {
-                    operator<<( arr[i] );
-                }
-
+                SerializeElements( arr.data(), size );
                 return *this;
             }
 
@@ -267,11 +275,7 @@ namespace KRG::Serialization
                 }
 
                 // Serialize elements
-                for ( auto i = 0u; i < size; i++ )
-                {
-                    operator<<( arr[i] );
-                }
-
+                SerializeElements( arr.data(), size );
                 return *this;
             }
 
@@ -361,6 +365,32 @@ namespace KRG::Serialization
                 return *this;
             }
 
+        protected:
+
+            // Serialize a contiguous range of array elements, plain data is serialized as a single block
+            template<typename T>
+            void SerializeElements( T* pElements, uint64_t numElements )
+            {
+                if constexpr ( IsPlainDataType<T>::value )
+                {
+                    if constexpr ( std::is_same<Serializer, BinaryReader>::value )
+                    {
+                        m_serializer.ReadBytes( pElements, numElements * sizeof( T ) );
+                    }
+                    else
+                    {
+                        m_serializer.WriteBytes( pElements, numElements * sizeof( T ) );
+                    }
+                }
+                else
+                {
+                    for ( auto i = 0u; i < numElements; i++ )
+                    {
+                        operator<<( pElements[i] );
+                    }
+                }
+            }
+
         protected:
 
             Serializer m_serializer;
@@ -413,6 +443,10 @@ Serialization::Internal::Archive<Serialization::BinaryWriter>& Serialize( Serial
 
 #define KRG_SERIALIZE_BASE( BaseTypeName ) Serialization::Internal::SerializeBaseType<BaseTypeName>( this )
 
+// Flag a type as plain data, arrays of this type will be serialized as a single raw block (see Serialization::IsPlainDataType)
+#define KRG_SERIALIZE_AS_PLAIN_DATA( TypeName ) \
+template<> struct Serialization::IsPlainDataType<TypeName> : std::true_type { static_assert( std::is_trivially_copyable<TypeName>::value, "Only trivially copyable types can be serialized as plain data" ); }
+
 //-------------------------------------------------------------------------
 
 #define KRG_CUSTOM_SERIALIZE_READ_FUNCTION( archive )\
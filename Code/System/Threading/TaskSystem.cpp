@@ -38,10 +38,14 @@ namespace KRG
     //-------------------------------------------------------------------------
 
     TaskSystem::TaskSystem()
+        : TaskSystem( UINT32_MAX )
+    {}
+
+    TaskSystem::TaskSystem( uint32_t maxWorkers )
     {
         // Get number of worker threads that we should create (excluding main thread)
         auto const processorInfo = Threading::GetProcessorInfo();
-        const_cast<uint32_t&>( m_numWorkers ) = processorInfo.m_numPhysicalCores - 1;
+        const_cast<uint32_t&>( m_numWorkers ) = Math::Min( (uint32_t) processorInfo.m_numPhysicalCores - 1, maxWorkers );
         KRG_ASSERT( m_numWorkers >= 0 );
     }
 
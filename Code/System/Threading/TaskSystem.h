@@ -33,6 +33,7 @@ namespace KRG
     public:
 
         TaskSystem();
+        explicit TaskSystem( uint32_t maxWorkers ); // Cap the number of worker threads created (e.g. when running alongside other processes)
         ~TaskSystem();
 
         inline bool IsInitialized() const { return m_initialized; }
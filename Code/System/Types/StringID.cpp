@@ -1,77 +1,125 @@
 #include "StringID.h"
-#include "System/Memory/Memory.h"
 #include "System/Algorithm/Hash.h"
-#include "System/Threading/Threading.h"
 #include "String.h"
-#include "EASTL/hash_map.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
+// String ID Cache
+//-------------------------------------------------------------------------
+// A fixed size table of buckets, each bucket is a singly-linked list of interned strings
+// Nodes are only ever pushed onto the head of a bucket (via CAS) and are never removed, so lookups can walk the lists without any locks
+// Nodes are allocated directly from the CRT since string IDs are created before/after the memory system is initialized
 
 namespace KRG
 {
-    class StringID_CustomAllocator
+    struct StringIDNode
     {
-    public:
+        StringIDNode const*                 m_pNext = nullptr;
+        char const*                         m_pString = nullptr;
+        uint32_t                            m_ID = 0;
+    };
 
-        EASTL_ALLOCATOR_EXPLICIT StringID_CustomAllocator( const char* pName = EASTL_NAME_VAL( EASTL_ALLOCATOR_DEFAULT_NAME ) ) {}
-        StringID_CustomAllocator( const StringID_CustomAllocator& x ) {}
-        StringID_CustomAllocator( const StringID_CustomAllocator& x, const char* pName ) {}
-        StringID_CustomAllocator& operator=( const StringID_CustomAllocator& x ) { return *this; }
-        const char* get_name() const { return "StringID"; }
-        void set_name( const char* pName ) {}
+    //-------------------------------------------------------------------------
 
-        void* allocate( size_t n, int flags = 0 )
-        {
-            return allocate( n, EASTL_SYSTEM_ALLOCATOR_MIN_ALIGNMENT, 0, flags );
-        }
+    namespace
+    {
+        constexpr static uint32_t const g_numBuckets = 1 << 16;
 
-        void* allocate( size_t n, size_t alignment, size_t offset, int flags = 0 )
+        struct StringIDCache
         {
-            size_t adjustedAlignment = ( alignment > EA_PLATFORM_PTR_SIZE ) ? alignment : EA_PLATFORM_PTR_SIZE;
+            ~StringIDCache()
+            {
+                for ( auto& bucket : m_buckets )
+                {
+                    StringIDNode const* pNode = bucket.load( std::memory_order_acquire );
+                    while ( pNode != nullptr )
+                    {
+                        StringIDNode const* pNext = pNode->m_pNext;
+                        DestroyNode( pNode );
+                        pNode = pNext;
+                    }
+
+                    bucket.store( nullptr, std::memory_order_relaxed );
+                }
+            }
 
-            void* p = new char[n + adjustedAlignment + EA_PLATFORM_PTR_SIZE];
-            void* pPlusPointerSize = (void*) ( (uintptr_t) p + EA_PLATFORM_PTR_SIZE );
-            void* pAligned = (void*) ( ( (uintptr_t) pPlusPointerSize + adjustedAlignment - 1 ) & ~( adjustedAlignment - 1 ) );
+            static StringIDNode const* FindNode( StringIDNode const* pNode, uint32_t ID )
+            {
+                while ( pNode != nullptr )
+                {
+                    if ( pNode->m_ID == ID )
+                    {
+                        return pNode;
+                    }
 
-            void** pStoredPtr = (void**) pAligned - 1;
-            EASTL_ASSERT( pStoredPtr >= p );
-            *( pStoredPtr ) = p;
+                    pNode = pNode->m_pNext;
+                }
 
-            EASTL_ASSERT( ( (size_t) pAligned & ~( alignment - 1 ) ) == (size_t) pAligned );
-            return pAligned;
-        }
+                return nullptr;
+            }
 
-        void deallocate( void* p, size_t n )
-        {
-            if ( p != nullptr )
+            // The string is stored directly after the node in a single allocation
+            static StringIDNode* CreateNode( uint32_t ID, char const* pStr )
             {
-                void* pOriginalAllocation = *( (void**) p - 1 );
-                delete[]( char* )pOriginalAllocation;
+                size_t const stringLength = strlen( pStr );
+                char* pMemory = new char[sizeof( StringIDNode ) + stringLength + 1];
+                char* pStringMemory = pMemory + sizeof( StringIDNode );
+                memcpy( pStringMemory, pStr, stringLength + 1 );
+
+                auto pNode = new ( pMemory ) StringIDNode();
+                pNode->m_pString = pStringMemory;
+                pNode->m_ID = ID;
+                return pNode;
             }
-        }
-    };
 
-    inline bool operator==( const StringID_CustomAllocator&, const StringID_CustomAllocator& ) { return true; }
-    inline bool operator!=( const StringID_CustomAllocator&, const StringID_CustomAllocator& ) { return false; }
+            static void DestroyNode( StringIDNode const* pNode )
+            {
+                delete[] reinterpret_cast<char const*>( pNode );
+            }
 
-    //-------------------------------------------------------------------------
+            void Intern( uint32_t ID, char const* pStr )
+            {
+                std::atomic<StringIDNode const*>& bucket = m_buckets[ID & ( g_numBuckets - 1 )];
+
+                StringIDNode const* pHead = bucket.load( std::memory_order_acquire );
+                if ( FindNode( pHead, ID ) != nullptr )
+                {
+                    return;
+                }
+
+                // Try to push the new node, if another thread modified the bucket in the meantime check whether it added the same ID
+                StringIDNode* pNewNode = CreateNode( ID, pStr );
+                pNewNode->m_pNext = pHead;
+                while ( !bucket.compare_exchange_weak( pNewNode->m_pNext, pNewNode, std::memory_order_acq_rel, std::memory_order_acquire ) )
+                {
+                    if ( FindNode( pNewNode->m_pNext, ID ) != nullptr )
+                    {
+                        DestroyNode( pNewNode );
+                        return;
+                    }
+                }
+            }
 
-    using CachedString = eastl::basic_string<char, StringID_CustomAllocator>;
+            char const* GetString( uint32_t ID ) const
+            {
+                StringIDNode const* pNode = FindNode( m_buckets[ID & ( g_numBuckets - 1 )].load( std::memory_order_acquire ), ID );
+                return ( pNode != nullptr ) ? pNode->m_pString : nullptr;
+            }
 
-    class StringIDHashMap : public eastl::hash_map<uint32_t, CachedString, eastl::hash<uint32_t>, eastl::equal_to<uint32_t>, StringID_CustomAllocator>
-    {
-    public:
-      
-        eastl::hash_node<value_type, false> const* const* GetBuckets() const { return mpBucketArray; }
-    };
+        public:
 
-    //-------------------------------------------------------------------------
+            std::atomic<StringIDNode const*>        m_buckets[g_numBuckets] = {};
+        };
+
+        static_assert( sizeof( std::atomic<StringIDNode const*> ) == sizeof( StringIDNode const* ), "The debugger info reads the buckets as raw pointers" );
+
+        StringIDCache g_stringCache;
+    }
 
-    StringIDHashMap g_stringCache;
-    Threading::Mutex g_stringCacheMutex;
+    //-------------------------------------------------------------------------
 
     // Natvis/Debugger info to print out human-readable strings
-    StringID::DebuggerInfo g_debuggerInfo;
+    StringID::DebuggerInfo g_debuggerInfo = { reinterpret_cast<StringIDNode const* const*>( g_stringCache.m_buckets ), g_numBuckets };
     KRG::StringID::DebuggerInfo const* StringID::s_pDebuggerInfo = &g_debuggerInfo;
 
     //-------------------------------------------------------------------------
@@ -81,16 +129,7 @@ namespace KRG
         if ( pStr != nullptr )
         {
             m_ID = Hash::GetHash32( pStr );
-
-            // Cache the string
-            Threading::ScopeLock lock( g_stringCacheMutex );
-            auto iter = g_stringCache.find( m_ID );
-            if ( iter == g_stringCache.end() )
-            {
-                g_stringCache[m_ID] = CachedString( pStr );
-                g_debuggerInfo.m_pBuckets = g_stringCache.GetBuckets();
-                g_debuggerInfo.m_numBuckets = g_stringCache.bucket_count();
-            }
+            g_stringCache.Intern( m_ID, pStr );
         }
     }
 
@@ -105,17 +144,7 @@ namespace KRG
             return nullptr;
         }
 
-        {
-            // Get cached string
-            Threading::ScopeLock lock( g_stringCacheMutex );
-            auto iter = g_stringCache.find( m_ID );
-            if ( iter != g_stringCache.end() )
-            {
-                return iter->second.c_str();
-            }
-        }
-
-        // ID likely directly created via uint32_t
-        return nullptr;
+        // Returns null if the ID was created directly via uint32_t or at compile time
+        return g_stringCache.GetString( m_ID );
     }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "System/_Module/API.h"
 #include "System/Types/Containers_ForwardDecl.h"
+#include "System/Algorithm/Hash.h"
 #include "System/KRG.h"
 
 //-------------------------------------------------------------------------
@@ -9,21 +10,14 @@
 //-------------------------------------------------------------------------
 // Deterministic numeric ID generated from a string
 // StringIDs are CASE-SENSITIVE!
-
-namespace eastl
-{
-    template <typename Value, bool bCacheHashCode>
-    struct hash_node;
-
-    template <typename T1, typename T2>
-    struct pair;
-}
-
-//-------------------------------------------------------------------------
+//
+// Strings are interned in a global lock-free table so that the string can be retrieved via c_str()
+// Use KRG_STRING_ID( "literal" ) to create an ID at compile time, this does no hashing or interning at runtime
+// Note: Compile time IDs are not interned, so c_str() will only return a string if the same string was also used to create an ID at runtime
 
 namespace KRG
 {
-    class StringID_CustomAllocator;
+    struct StringIDNode;
 
     //-------------------------------------------------------------------------
 
@@ -31,11 +25,9 @@ namespace KRG
     {
     public:
 
-        using StringIDHashNode = eastl::hash_node<eastl::pair<const uint32_t, eastl::basic_string<char, KRG::StringID_CustomAllocator>>, false>;
-
         struct DebuggerInfo
         {
-            StringIDHashNode const* const*  m_pBuckets = nullptr;
+            StringIDNode const* const*      m_pBuckets = nullptr;
             size_t                          m_numBuckets = 0;
         };
 
@@ -46,7 +38,7 @@ namespace KRG
         StringID() = default;
         explicit StringID( nullptr_t ) : m_ID( 0 ) {}
         explicit StringID( char const* pStr );
-        explicit StringID( uint32_t ID ) : m_ID( ID ) {}
+        constexpr explicit StringID( uint32_t ID ) : m_ID( ID ) {}
         explicit StringID( String const& str );
 
         inline bool IsValid() const { return m_ID != 0; }
@@ -68,6 +60,11 @@ namespace KRG
 
 //-------------------------------------------------------------------------
 
+// Create a string ID from a string literal at compile time
+#define KRG_STRING_ID( str ) KRG::StringID( std::integral_constant<uint32_t, KRG::Hash::XXHash::ConstExpr::GetHash32( str )>::value )
+
+//-------------------------------------------------------------------------
+
 namespace eastl
 {
     template <typename T> struct hash;